@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <vector>
 #include "ck/host/device_gemm_multiple_d/operation.hpp"
+#include "ck/host/device_gemm_universal/operation.hpp"
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/operation.hpp"
 #include "ck/host/stringutils.hpp"
 
 using ck::host::Transform;
@@ -46,6 +48,10 @@ int main(int argc, const char* argv[])
     Emitters e;
     e.Register<ck::host::device_gemm_multiple_d::Operation_Xdl_CShuffle>(
         "DeviceGemmMultipleD_Xdl_CShuffle");
+    e.Register<ck::host::device_gemm_universal::Operation_Xdl_CShuffle_V3>(
+        "DeviceGemm_Xdl_CShuffleV3");
+    e.Register<ck::host::device_grouped_conv_fwd_multiple_abd::Operation_Xdl_CShuffle>(
+        "DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle");
 
     if(args.empty() or std::any_of(args.begin(), args.end(), [](auto arg) {
            return arg == "-h" or arg == "--help";
@@ -34,6 +34,17 @@ struct Operation_Xdl_CShuffle
     operation::CShuffleDesc cshuffle{};
     operation::CBlockTransferDesc c_block_transfer{};
 
+    // whether the vector loads and stores and the LDS footprint of the instance are legal for the
+    // problem, the same checks as DeviceGemmMultipleD_Xdl_CShuffle::IsSupportedArgument
+    bool IsSupported(const Problem& prob, const std::string& arch) const;
+
+    // LDS bytes of the A and B block tiles
+    std::size_t GetLdsSize() const;
+
+    // Host-only estimate in [0, 1] of the fraction of peak throughput the instance reaches on the
+    // problem, see operation::EstimateEfficiency
+    double EstimateEfficiency(const Problem& prob, const std::string& arch) const;
+
     Solution ToSolution() const;
 };
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -31,7 +31,11 @@ struct Problem
 
     std::string GetIncludeHeader() const;
 
-    std::vector<Solution> GetSolutions(const std::string& arch) const;
+    // Solutions that can run the problem, best first by an analytic estimate of their throughput
+    // (see Operation_Xdl_CShuffle::EstimateEfficiency). At most max_solutions are returned when it
+    // is not 0, so JIT users can compile only the most promising ones.
+    std::vector<Solution> GetSolutions(const std::string& arch,
+                                       std::size_t max_solutions = 0) const;
 };
 
 } // namespace device_gemm_multiple_d
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include "ck/host/types.hpp"
+#include "ck/host/operation/gemm.hpp"
+#include "ck/host/device_gemm_universal/problem.hpp"
+
+namespace ck {
+namespace host {
+namespace device_gemm_universal {
+
+struct Operation_Xdl_CShuffle_V3
+{
+    static std::vector<std::vector<Operation_Xdl_CShuffle_V3>> CreateOperations();
+    static std::vector<Operation_Xdl_CShuffle_V3> CreateOperations(const Problem& prob);
+    TensorDesc A{};
+    TensorDesc B{};
+    DataType acc     = DataType::Float;
+    DataType cs_type = DataType::Half;
+    TensorDesc C{};
+    std::string a_elem_op           = PassThrough;
+    std::string b_elem_op           = PassThrough;
+    std::string c_elem_op           = PassThrough;
+    std::string gemm_specialization = "ck::tensor_operation::device::GemmSpecialization::Default";
+    operation::TileDesc tile_desc{};
+    operation::BlockTransferDesc a_block_transfer{};
+    operation::BlockTransferDesc b_block_transfer{};
+    operation::CShuffleDesc cshuffle{};
+    operation::CBlockTransferDesc c_block_transfer{};
+    operation::BlockGemmPipelineDesc pipeline{};
+
+    // whether the vector loads and stores and the LDS footprint of the instance are legal for the
+    // problem, the same checks as DeviceGemm_Xdl_CShuffleV3::IsSupportedArgument
+    bool IsSupported(const Problem& prob, const std::string& arch) const;
+
+    // LDS bytes of the A and B block tiles, twice the tiles for the ping-pong pipeline v4
+    std::size_t GetLdsSize() const;
+
+    // see operation::EstimateEfficiency
+    double EstimateEfficiency(const Problem& prob, const std::string& arch) const;
+
+    Solution ToSolution() const;
+};
+
+} // namespace device_gemm_universal
+} // namespace host
+} // namespace ck
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include "ck/host/types.hpp"
+
+namespace ck {
+namespace host {
+namespace device_gemm_universal {
+
+// C = A * B solved by DeviceGemm_Xdl_CShuffleV3, the universal GEMM with the blockwise GEMM
+// pipelines. Only row major A and C are supported, like the instances of the library.
+struct Problem
+{
+    std::size_t M          = 0;
+    std::size_t N          = 0;
+    std::size_t K          = 0;
+    bool TransA            = false;
+    bool TransB            = false;
+    bool TransC            = false;
+    DataType ADataType     = DataType::Half;
+    DataType BDataType     = DataType::Half;
+    DataType CDataType     = DataType::Half;
+    std::string AElementOp = PassThrough;
+    std::string BElementOp = PassThrough;
+    std::string CElementOp = PassThrough;
+
+    std::string GetIncludeHeader() const;
+
+    // Solutions that can run the problem, best first by an analytic estimate of their throughput
+    // (see operation::EstimateEfficiency), at most max_solutions when it is not 0
+    std::vector<Solution> GetSolutions(const std::string& arch,
+                                       std::size_t max_solutions = 0) const;
+};
+
+} // namespace device_gemm_universal
+} // namespace host
+} // namespace ck
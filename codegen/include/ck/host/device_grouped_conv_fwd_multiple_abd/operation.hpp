@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include "ck/host/types.hpp"
+#include "ck/host/operation/gemm.hpp"
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/problem.hpp"
+
+namespace ck {
+namespace host {
+namespace device_grouped_conv_fwd_multiple_abd {
+
+struct Operation_Xdl_CShuffle
+{
+    static std::vector<std::vector<Operation_Xdl_CShuffle>> CreateOperations();
+    static std::vector<Operation_Xdl_CShuffle> CreateOperations(const Problem& prob);
+    std::size_t num_dim           = 2;
+    DataType a_type               = DataType::Half;
+    DataType b_type               = DataType::Half;
+    DataType acc                  = DataType::Float;
+    DataType cs_type              = DataType::Half;
+    std::vector<DataType> ds_type = {};
+    DataType e_type               = DataType::Half;
+    std::string a_elem_op         = PassThrough;
+    std::string b_elem_op         = PassThrough;
+    std::string cde_elem_op       = PassThrough;
+    std::string conv_specialization =
+        "ck::tensor_operation::device::ConvolutionForwardSpecialization::Default";
+    std::string gemm_specialization =
+        "ck::tensor_operation::device::GemmSpecialization::MNKPadding";
+    operation::TileDesc tile_desc{};
+    operation::BlockTransferDesc a_block_transfer{};
+    operation::BlockTransferDesc b_block_transfer{};
+    operation::CShuffleDesc cshuffle{};
+    operation::CBlockTransferDesc c_block_transfer{};
+
+    // whether the vector loads along C, the vector stores along K and the LDS footprint of the
+    // instance are legal for the problem, the same checks as
+    // DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle::IsSupportedArgument
+    bool IsSupported(const Problem& prob, const std::string& arch) const;
+
+    // LDS bytes of the A and B block tiles
+    std::size_t GetLdsSize() const;
+
+    // see operation::EstimateEfficiency, the groups are independent GEMMs
+    double EstimateEfficiency(const Problem& prob, const std::string& arch) const;
+
+    Solution ToSolution() const;
+};
+
+} // namespace device_grouped_conv_fwd_multiple_abd
+} // namespace host
+} // namespace ck
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include "ck/host/types.hpp"
+
+namespace ck {
+namespace host {
+namespace device_grouped_conv_fwd_multiple_abd {
+
+// Grouped forward convolution E = CDE(A * B, Ds) with NHWGC input A, GKYXC weight B and NHWGK
+// output E (NWGC/GKXC/NWGK in 1D, NDHWGC/GKZYXC/NDHWGK in 3D). The number of spatial dimensions
+// is the size of InputSpatialLengths. Strides and dilations default to 1 and pads to 0 when they
+// are left empty.
+struct Problem
+{
+    std::size_t G                                 = 1;
+    std::size_t N                                 = 0;
+    std::size_t C                                 = 0;
+    std::size_t K                                 = 0;
+    std::vector<std::size_t> InputSpatialLengths  = {};
+    std::vector<std::size_t> FilterSpatialLengths = {};
+    std::vector<std::size_t> ConvStrides          = {};
+    std::vector<std::size_t> ConvDilations        = {};
+    std::vector<std::size_t> InLeftPads           = {};
+    std::vector<std::size_t> InRightPads          = {};
+    DataType ADataType                            = DataType::Half;
+    DataType BDataType                            = DataType::Half;
+    DataType EDataType                            = DataType::Half;
+    std::vector<DataType> DsDataType              = {};
+    std::string AElementOp                        = PassThrough;
+    std::string BElementOp                        = PassThrough;
+    std::string CDEElementOp                      = PassThrough;
+
+    std::size_t GetNumDim() const;
+    std::vector<std::size_t> GetOutputSpatialLengths() const;
+
+    // the implicit GEMM of a group: M = N * Ho * Wo, N = K and K = C * Y * X
+    std::size_t GetGemmM() const;
+    std::size_t GetGemmN() const;
+    std::size_t GetGemmK() const;
+
+    // Filter1x1Stride1Pad0 or Filter1x1Pad0 when the filter allows it, Default otherwise
+    std::string GetConvSpecialization() const;
+
+    std::string GetIncludeHeader() const;
+
+    // Solutions that can run the problem, best first by an analytic estimate of their throughput
+    // (see operation::EstimateEfficiency), at most max_solutions when it is not 0
+    std::vector<Solution> GetSolutions(const std::string& arch,
+                                       std::size_t max_solutions = 0) const;
+};
+
+} // namespace device_grouped_conv_fwd_multiple_abd
+} // namespace host
+} // namespace ck
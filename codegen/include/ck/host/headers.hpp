@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -12,7 +13,23 @@
 namespace ck {
 namespace host {
 
-std::unordered_map<std::string_view, std::string_view> GetHeaders();
+// A header embedded in the library. Both views refer to the read-only data of the library, which
+// is mapped with the library and lives as long as the process.
+struct Header
+{
+    std::string_view name;
+    std::string_view content;
+};
+
+// name to content of every embedded header, built on first use
+const std::unordered_map<std::string_view, std::string_view>& GetHeaders();
+
+// the embedded headers sorted by name, so the order does not depend on the hash map, built on
+// first use
+const std::vector<Header>& GetHeaderList();
+
+// content of the embedded header, nothing is copied
+std::optional<std::string_view> FindHeader(std::string_view name);
 
 } // namespace host
 } // namespace ck
@@ -1,9 +1,15 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <utility>
+#include <vector>
+#include "ck/host/types.hpp"
 
 namespace ck {
 namespace host {
@@ -43,6 +49,77 @@ struct CBlockTransferDesc
     std::string cluster_lengths_m_block_m_wave_m_per_Xdl_n_block_n_wave_n_per_Xdl = "";
     int scalar_per_vector_n_wave_n_per_Xdl                                        = 0;
 };
+struct BlockGemmPipelineDesc
+{
+    std::string scheduler = "ck::BlockGemmPipelineScheduler::Intrawave";
+    std::string version   = "ck::BlockGemmPipelineVersion::v1";
+};
+
+// GemmSpecialization that pads the dimensions of an m x n x k problem not divisible by the tile
+std::string
+GetGemmSpecialization(std::size_t m, std::size_t n, std::size_t k, const TileDesc& tile);
+
+// whether the vector loads of packed A and B along their vector dimensions and the vector stores
+// of E along N are legal for an m x n x k problem
+bool IsVectorAccessSupported(std::size_t m,
+                             std::size_t n,
+                             std::size_t k,
+                             const TensorDesc& a,
+                             const BlockTransferDesc& a_block_transfer,
+                             const TensorDesc& b,
+                             const BlockTransferDesc& b_block_transfer,
+                             const TensorDesc& e,
+                             const CBlockTransferDesc& c_block_transfer);
+
+// LDS bytes of the A and B block tiles
+std::size_t GetLdsSize(const TileDesc& tile,
+                       const BlockTransferDesc& a_block_transfer,
+                       const BlockTransferDesc& b_block_transfer,
+                       DataType a,
+                       DataType b);
+
+// Host-only estimate in [0, 1] of the fraction of peak throughput a tile configuration reaches on
+// batch independent m x n x k problems, used to order solutions before they are compiled and
+// timed. It is the product of the padding efficiency, the utilization of the CUs by the tiles, the
+// latency hiding the LDS footprint allows, the arithmetic intensity of the block and wave tiles and
+// the length of the main loop against the prologue and epilogue.
+double EstimateEfficiency(std::size_t m,
+                          std::size_t n,
+                          std::size_t k,
+                          std::size_t batch,
+                          const TileDesc& tile,
+                          std::size_t lds_size,
+                          DataType a,
+                          DataType b,
+                          const std::string& arch);
+
+// The solutions of the operations that support the problem, best EstimateEfficiency first. Ties
+// keep the order of the instance table and max_solutions = 0 keeps all of them.
+template <class Operation, class Problem>
+std::vector<Solution> GetRankedSolutions(const std::vector<Operation>& ops,
+                                         const Problem& prob,
+                                         const std::string& arch,
+                                         std::size_t max_solutions)
+{
+    std::vector<std::pair<double, const Operation*>> ranked;
+    for(const auto& op : ops)
+    {
+        if(op.IsSupported(prob, arch))
+            ranked.emplace_back(op.EstimateEfficiency(prob, arch), &op);
+    }
+
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& x, const auto& y) {
+        return x.first > y.first;
+    });
+    if(max_solutions != 0 and ranked.size() > max_solutions)
+        ranked.resize(max_solutions);
+
+    std::vector<Solution> result;
+    std::transform(ranked.begin(), ranked.end(), std::back_inserter(result), [&](const auto& r) {
+        return r.second->ToSolution();
+    });
+    return result;
+}
 
 } // namespace operation
 } // namespace host
@@ -1,8 +1,9 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <sstream>
 #include <utility>
@@ -38,11 +39,15 @@ enum class DataType
     Half,
     Float,
     Int8,
-    Int32
+    Int32,
+    BFloat16,
+    Float8
 };
 
 std::string ToString(DataType dt);
 
+std::size_t SizeOf(DataType dt);
+
 enum class Layout
 {
     Row,
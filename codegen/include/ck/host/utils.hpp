@@ -1,9 +1,10 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <unordered_set>
 
 namespace ck {
@@ -13,5 +14,11 @@ std::size_t integer_divide_ceil(std::size_t x, std::size_t y);
 
 const std::unordered_set<std::string>& get_xdlop_archs();
 
+// number of compute units of the smallest device of the architecture
+std::size_t get_cu_count(const std::string& arch);
+
+// LDS bytes available to a workgroup
+std::size_t get_lds_size(const std::string& arch);
+
 } // namespace host
 } // namespace ck
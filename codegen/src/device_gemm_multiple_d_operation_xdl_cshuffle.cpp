@@ -4,32 +4,13 @@
 #include "ck/host/device_gemm_multiple_d/operation.hpp"
 #include "ck/host/stringutils.hpp"
 #include "ck/host/utils.hpp"
+#include <algorithm>
 #include <cassert>
 
 namespace ck {
 namespace host {
 namespace device_gemm_multiple_d {
 
-static std::string GetGemmSpec(const std::size_t m,
-                               const std::size_t n,
-                               const std::size_t k,
-                               const std::size_t m_per_block,
-                               const std::size_t n_per_block,
-                               const std::size_t k_per_block)
-{
-    std::string spec = "";
-    if(integer_divide_ceil(m, m_per_block) * m_per_block - m != 0)
-        spec += "M";
-    if(integer_divide_ceil(n, n_per_block) * n_per_block - n != 0)
-        spec += "N";
-    if(integer_divide_ceil(k, k_per_block) * k_per_block - k != 0)
-        spec += "K";
-    if(spec == "")
-        return "ck::tensor_operation::device::GemmSpecialization::Default";
-
-    return "ck::tensor_operation::device::GemmSpecialization::" + spec + "Padding";
-}
-
 static Layout ToLayout(bool Trans) { return Trans ? Layout::Column : Layout::Row; }
 
 std::vector<Operation_Xdl_CShuffle> Operation_Xdl_CShuffle::CreateOperations(const Problem& prob)
@@ -182,12 +163,8 @@ std::vector<Operation_Xdl_CShuffle> Operation_Xdl_CShuffle::CreateOperations(con
         x.a_elem_op           = prob.AElementOp;
         x.b_elem_op           = prob.BElementOp;
         x.cde_elem_op         = prob.CDEElementOp;
-        x.gemm_specialization = GetGemmSpec(prob.M,
-                                            prob.N,
-                                            prob.K,
-                                            x.tile_desc.m_per_block,
-                                            x.tile_desc.n_per_block,
-                                            x.tile_desc.k_per_block);
+        x.gemm_specialization =
+            operation::GetGemmSpecialization(prob.M, prob.N, prob.K, x.tile_desc);
         result.push_back(x);
     }
     return result;
@@ -207,6 +184,51 @@ std::vector<std::vector<Operation_Xdl_CShuffle>> Operation_Xdl_CShuffle::CreateO
     return Transform(problems, [](const Problem& p) { return CreateOperations(p); });
 }
 
+bool Operation_Xdl_CShuffle::IsSupported(const Problem& prob, const std::string& arch) const
+{
+    if(not operation::IsVectorAccessSupported(prob.M,
+                                              prob.N,
+                                              prob.K,
+                                              this->A,
+                                              this->a_block_transfer,
+                                              this->B,
+                                              this->b_block_transfer,
+                                              this->E,
+                                              this->c_block_transfer))
+        return false;
+
+    // Ds are only supported row major
+    if(std::any_of(this->Ds.begin(), this->Ds.end(), [](const auto& d) {
+           return d.layout != Layout::Row;
+       }))
+        return false;
+
+    return this->GetLdsSize() <= get_lds_size(arch);
+}
+
+std::size_t Operation_Xdl_CShuffle::GetLdsSize() const
+{
+    return operation::GetLdsSize(this->tile_desc,
+                                 this->a_block_transfer,
+                                 this->b_block_transfer,
+                                 this->A.element,
+                                 this->B.element);
+}
+
+double Operation_Xdl_CShuffle::EstimateEfficiency(const Problem& prob,
+                                                  const std::string& arch) const
+{
+    return operation::EstimateEfficiency(prob.M,
+                                         prob.N,
+                                         prob.K,
+                                         1,
+                                         this->tile_desc,
+                                         this->GetLdsSize(),
+                                         this->A.element,
+                                         this->B.element,
+                                         arch);
+}
+
 static const char* const DeviceGemmMultipleD_Xdl_CShuffleTemplate =
     "ck::tensor_operation::device::DeviceGemmMultipleD_Xdl_CShuffle<${LayoutA}, ${LayoutB}, "
     "${LayoutDs}, ${LayoutE}, ${ADataType}, ${BDataType}, ${AccDataType}, ${CShuffleDataType}, "
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/host/device_gemm_universal/problem.hpp"
+#include "ck/host/device_gemm_universal/operation.hpp"
+#include "ck/host/utils.hpp"
+#include <algorithm>
+
+namespace ck {
+namespace host {
+namespace device_gemm_universal {
+
+std::string Problem::GetIncludeHeader() const
+{
+    return "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_cshuffle_v3.hpp";
+}
+
+std::vector<Solution> Problem::GetSolutions(const std::string& arch,
+                                            std::size_t max_solutions) const
+{
+    if(get_xdlop_archs().count(arch) == 0)
+        return {};
+    return operation::GetRankedSolutions(
+        Operation_Xdl_CShuffle_V3::CreateOperations(*this), *this, arch, max_solutions);
+}
+
+} // namespace device_gemm_universal
+} // namespace host
+} // namespace ck
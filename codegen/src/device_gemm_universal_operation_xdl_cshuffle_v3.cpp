@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/host/device_gemm_universal/operation.hpp"
+#include "ck/host/stringutils.hpp"
+#include "ck/host/utils.hpp"
+#include <cassert>
+
+namespace ck {
+namespace host {
+namespace device_gemm_universal {
+
+static Layout ToLayout(bool Trans) { return Trans ? Layout::Column : Layout::Row; }
+
+static DataType GetAccDataType(DataType a)
+{
+    return a == DataType::Int8 ? DataType::Int32 : DataType::Float;
+}
+
+std::vector<Operation_Xdl_CShuffle_V3>
+Operation_Xdl_CShuffle_V3::CreateOperations(const Problem& prob)
+{
+    std::vector<Operation_Xdl_CShuffle_V3> result;
+
+    // compute bound instances first, then the memory bound ones with small tiles
+    std::vector<operation::TileDesc> tile_descriptions = {
+        // clang-format off
+//  Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|
+//   Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|
+//       |      |      |      |    |    |     |     | Wave| Wave|
+//       |      |      |      |    |    |     |     |     |     |
+  {   256,   256,   256,    32,   8,   8,   32,   32,    4,    4},
+  {   256,   128,   128,    64,   8,   8,   32,   32,    2,    2},
+  {   256,   224,   256,    64,   8,   8,   16,   16,    7,    8},
+  {   256,   128,   256,    32,   8,   8,   32,   32,    2,    4},
+  {   256,   256,   128,    32,   8,   8,   32,   32,    4,    2},
+  {   128,    32,    16,    64,   8,   8,   16,   16,    1,    1},
+  {    64,    16,    16,    64,   8,   8,   16,   16,    1,    1},
+  {   256,   256,    32,    64,   8,   8,   32,   32,    2,    1},
+  {   128,   128,    32,    64,   8,   8,   32,   32,    2,    1},
+  {   128,    32,    64,    64,   8,   8,   32,   32,    1,    1},
+  {   128,    32,   128,    64,   8,   8,   32,   32,    1,    2},
+  {   256,    32,   256,    64,   8,   8,   32,   32,    1,    2},
+  {   128,    64,    32,    64,   8,   8,   32,   32,    1,    1},
+        // clang-format on
+    };
+
+    std::vector<operation::BlockTransferDesc> a_block_descriptions_rowmajor = {
+        // clang-format off
+//  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|
+//   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|
+// Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          |
+//                |               |               |               |               |               |          |
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {     S<8, 8, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+        // clang-format on
+    };
+
+    std::vector<operation::BlockTransferDesc> b_block_descriptions_rowmajor = {
+        // clang-format off
+//  BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|
+//   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN|
+// Lengths_K0_N_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          |
+//                |               |               |               |               |               |          |
+  {    S<8, 32, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {   S<16, 16, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {    S<8, 32, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              8,         0},
+  {    S<8, 32, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {    S<8, 32, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              4,              4,         0},
+  {    S<16, 8, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              2,              4,         0},
+  {    S<16, 4, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              4,              4,         0},
+  {    S<32, 8, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              4,              2,         0},
+  {    S<16, 8, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              4,              4,         0},
+  {    S<16, 8, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {    S<8, 16, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {    S<8, 32, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              8,              4,         0},
+  {    S<16, 8, 1>,     S<0, 2, 1>,     S<0, 2, 1>,              1,              4,              4,         0},
+        // clang-format on
+    };
+
+    std::vector<operation::BlockTransferDesc> b_block_descriptions_colmajor = {
+        // clang-format off
+//  BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|
+//   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN|
+// Lengths_K0_N_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          |
+//                |               |               |               |               |               |          |
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {     S<8, 8, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+  {    S<8, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         0},
+        // clang-format on
+    };
+
+    std::vector<operation::CShuffleDesc> cshuffle_descriptions = {
+        // clang-format off
+//    CShuffle|    CShuffle|
+// MXdlPerWave| NXdlPerWave|
+//  PerShuffle|  PerShuffle|
+//            |            |
+  {          1,           1},
+  {          1,           1},
+  {          1,           2},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+  {          1,           1},
+        // clang-format on
+    };
+
+    std::vector<operation::CBlockTransferDesc> c_block_descriptions = {
+        // clang-format off
+// CBlockTransferClusterLengths|  CBlockTransfer
+//         _MBlock_MWaveMPerXdl| ScalarPerVector
+//         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl
+//                             |
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 16, 1, 8>,               2},
+  {              S<1, 16, 1, 4>,               4},
+  {              S<1, 32, 1, 8>,               4},
+  {              S<1, 16, 1, 8>,               4},
+  {              S<1, 16, 1, 8>,               8},
+  {              S<1, 16, 1, 8>,               8},
+  {             S<1, 16, 1, 16>,               8},
+  {              S<1, 16, 1, 8>,               4},
+        // clang-format on
+    };
+
+    std::vector<operation::BlockGemmPipelineDesc> pipeline_descriptions = {
+        // clang-format off
+//                        BlockGemmPipelineScheduler|        BlockGemmPipelineVersion|
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v4"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v3"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v3"},
+  {"ck::BlockGemmPipelineScheduler::Interwave", "ck::BlockGemmPipelineVersion::v1"},
+  {"ck::BlockGemmPipelineScheduler::Interwave", "ck::BlockGemmPipelineVersion::v1"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v1"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v1"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+  {"ck::BlockGemmPipelineScheduler::Intrawave", "ck::BlockGemmPipelineVersion::v2"},
+        // clang-format on
+    };
+
+    // there are no instances for column major A, IsSupported rejects them
+    const auto& a_block_descriptions = a_block_descriptions_rowmajor;
+    const auto& b_block_descriptions =
+        prob.TransB ? b_block_descriptions_colmajor : b_block_descriptions_rowmajor;
+
+    assert(tile_descriptions.size() == a_block_descriptions.size());
+    assert(tile_descriptions.size() == b_block_descriptions.size());
+    assert(tile_descriptions.size() == cshuffle_descriptions.size());
+    assert(tile_descriptions.size() == c_block_descriptions.size());
+    assert(tile_descriptions.size() == pipeline_descriptions.size());
+
+    for(std::size_t i = 0; i < tile_descriptions.size(); i++)
+    {
+        Operation_Xdl_CShuffle_V3 x;
+        x.tile_desc        = tile_descriptions[i];
+        x.a_block_transfer = a_block_descriptions[i];
+        x.b_block_transfer = b_block_descriptions[i];
+        x.cshuffle         = cshuffle_descriptions[i];
+        x.c_block_transfer = c_block_descriptions[i];
+        x.pipeline         = pipeline_descriptions[i];
+        x.A                = TensorDesc{prob.ADataType, ToLayout(prob.TransA)};
+        x.B                = TensorDesc{prob.BDataType, ToLayout(prob.TransB)};
+        x.C                = TensorDesc{prob.CDataType, ToLayout(prob.TransC)};
+        x.acc              = GetAccDataType(prob.ADataType);
+        x.cs_type          = prob.CDataType;
+        x.a_elem_op        = prob.AElementOp;
+        x.b_elem_op        = prob.BElementOp;
+        x.c_elem_op        = prob.CElementOp;
+        // row major B is written to LDS with the vector width it is read with
+        x.tile_desc.bk1 = x.b_block_transfer.dst_scalar_per_vector_k1;
+        x.gemm_specialization =
+            operation::GetGemmSpecialization(prob.M, prob.N, prob.K, x.tile_desc);
+        result.push_back(x);
+    }
+    return result;
+}
+
+std::vector<std::vector<Operation_Xdl_CShuffle_V3>> Operation_Xdl_CShuffle_V3::CreateOperations()
+{
+    std::vector<Problem> problems;
+    for(bool TransB : {true, false})
+    {
+        Problem prob;
+        prob.TransB = TransB;
+        problems.push_back(prob);
+    }
+    return Transform(problems, [](const Problem& p) { return CreateOperations(p); });
+}
+
+bool Operation_Xdl_CShuffle_V3::IsSupported(const Problem& prob, const std::string& arch) const
+{
+    return operation::IsVectorAccessSupported(prob.M,
+                                              prob.N,
+                                              prob.K,
+                                              this->A,
+                                              this->a_block_transfer,
+                                              this->B,
+                                              this->b_block_transfer,
+                                              this->C,
+                                              this->c_block_transfer) and
+           this->GetLdsSize() <= get_lds_size(arch);
+}
+
+std::size_t Operation_Xdl_CShuffle_V3::GetLdsSize() const
+{
+    const std::size_t size = operation::GetLdsSize(this->tile_desc,
+                                                   this->a_block_transfer,
+                                                   this->b_block_transfer,
+                                                   this->A.element,
+                                                   this->B.element);
+    return this->pipeline.version == "ck::BlockGemmPipelineVersion::v4" ? 2 * size : size;
+}
+
+double Operation_Xdl_CShuffle_V3::EstimateEfficiency(const Problem& prob,
+                                                     const std::string& arch) const
+{
+    return operation::EstimateEfficiency(prob.M,
+                                         prob.N,
+                                         prob.K,
+                                         1,
+                                         this->tile_desc,
+                                         this->GetLdsSize(),
+                                         this->A.element,
+                                         this->B.element,
+                                         arch);
+}
+
+static const char* const DeviceGemm_Xdl_CShuffleV3Template =
+    "ck::tensor_operation::device::DeviceGemm_Xdl_CShuffleV3<${LayoutA}, ${LayoutB}, ${LayoutC}, "
+    "${ADataType}, ${BDataType}, ${CDataType}, ${AccDataType}, ${CShuffleDataType}, "
+    "${AElementwiseOperation}, ${BElementwiseOperation}, ${CElementwiseOperation}, "
+    "${GemmSpecialization}, ${BlockSize}, ${MPerBlock}, ${NPerBlock}, ${KPerBlock}, ${AK1}, "
+    "${BK1}, ${MPerXDL}, ${NPerXDL}, ${MXdlPerWave}, ${NXdlPerWave}, "
+    "${ABlockTransferThreadClusterLengths_AK0_M_AK1}, "
+    "${ABlockTransferThreadClusterArrangeOrder}, ${ABlockTransferSrcAccessOrder}, "
+    "${ABlockTransferSrcVectorDim}, ${ABlockTransferSrcScalarPerVector}, "
+    "${ABlockTransferDstScalarPerVector_AK1}, ${ABlockLdsExtraM}, "
+    "${BBlockTransferThreadClusterLengths_BK0_N_BK1}, ${BBlockTransferThreadClusterArrangeOrder}, "
+    "${BBlockTransferSrcAccessOrder}, ${BBlockTransferSrcVectorDim}, "
+    "${BBlockTransferSrcScalarPerVector}, ${BBlockTransferDstScalarPerVector_BK1}, "
+    "${BBlockLdsExtraN}, ${CShuffleMXdlPerWavePerShuffle}, ${CShuffleNXdlPerWavePerShuffle}, "
+    "${CShuffleBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock}, "
+    "${CShuffleBlockTransferScalarPerVector_NPerBlock}, ${BlkGemmPipeSched}, "
+    "${BlkGemmPipelineVer}>";
+
+Solution Operation_Xdl_CShuffle_V3::ToSolution() const
+{
+    std::unordered_map<std::string, std::string> values = {
+        {"LayoutA", ToString(this->A.layout)},
+        {"LayoutB", ToString(this->B.layout)},
+        {"LayoutC", ToString(this->C.layout)},
+        {"ADataType", ToString(this->A.element)},
+        {"BDataType", ToString(this->B.element)},
+        {"CDataType", ToString(this->C.element)},
+        {"AccDataType", ToString(this->acc)},
+        {"CShuffleDataType", ToString(this->cs_type)},
+        {"AElementwiseOperation", this->a_elem_op},
+        {"BElementwiseOperation", this->b_elem_op},
+        {"CElementwiseOperation", this->c_elem_op},
+        {"GemmSpecialization", this->gemm_specialization},
+        {"BlockSize", std::to_string(this->tile_desc.block_size)},
+        {"MPerBlock", std::to_string(this->tile_desc.m_per_block)},
+        {"NPerBlock", std::to_string(this->tile_desc.n_per_block)},
+        {"KPerBlock", std::to_string(this->tile_desc.k_per_block)},
+        {"AK1", std::to_string(this->tile_desc.ak1)},
+        {"BK1", std::to_string(this->tile_desc.bk1)},
+        {"MPerXDL", std::to_string(this->tile_desc.m_per_XDL)},
+        {"NPerXDL", std::to_string(this->tile_desc.n_per_XDL)},
+        {"MXdlPerWave", std::to_string(this->tile_desc.m_Xdl_per_wave)},
+        {"NXdlPerWave", std::to_string(this->tile_desc.n_Xdl_per_wave)},
+        {"ABlockTransferThreadClusterLengths_AK0_M_AK1",
+         this->a_block_transfer.thread_cluster_length},
+        {"ABlockTransferThreadClusterArrangeOrder",
+         this->a_block_transfer.thread_cluster_arrange_order},
+        {"ABlockTransferSrcAccessOrder", this->a_block_transfer.src_access_order},
+        {"ABlockTransferSrcVectorDim", std::to_string(this->a_block_transfer.src_vec_dim)},
+        {"ABlockTransferSrcScalarPerVector",
+         std::to_string(this->a_block_transfer.src_scalar_per_vector)},
+        {"ABlockTransferDstScalarPerVector_AK1",
+         std::to_string(this->a_block_transfer.dst_scalar_per_vector_k1)},
+        {"ABlockLdsExtraM", this->a_block_transfer.lds_add_extra_dim ? "true" : "false"},
+        {"BBlockTransferThreadClusterLengths_BK0_N_BK1",
+         this->b_block_transfer.thread_cluster_length},
+        {"BBlockTransferThreadClusterArrangeOrder",
+         this->b_block_transfer.thread_cluster_arrange_order},
+        {"BBlockTransferSrcAccessOrder", this->b_block_transfer.src_access_order},
+        {"BBlockTransferSrcVectorDim", std::to_string(this->b_block_transfer.src_vec_dim)},
+        {"BBlockTransferSrcScalarPerVector",
+         std::to_string(this->b_block_transfer.src_scalar_per_vector)},
+        {"BBlockTransferDstScalarPerVector_BK1",
+         std::to_string(this->b_block_transfer.dst_scalar_per_vector_k1)},
+        {"BBlockLdsExtraN", this->b_block_transfer.lds_add_extra_dim ? "true" : "false"},
+        {"CShuffleMXdlPerWavePerShuffle",
+         std::to_string(this->cshuffle.m_Xdl_per_wave_per_shuffle)},
+        {"CShuffleNXdlPerWavePerShuffle",
+         std::to_string(this->cshuffle.n_Xdl_per_wave_per_shuffle)},
+        {"CShuffleBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock",
+         this->c_block_transfer.cluster_lengths_m_block_m_wave_m_per_Xdl_n_block_n_wave_n_per_Xdl},
+        {"CShuffleBlockTransferScalarPerVector_NPerBlock",
+         std::to_string(this->c_block_transfer.scalar_per_vector_n_wave_n_per_Xdl)},
+        {"BlkGemmPipeSched", this->pipeline.scheduler},
+        {"BlkGemmPipelineVer", this->pipeline.version},
+    };
+
+    return Solution{InterpolateString(DeviceGemm_Xdl_CShuffleV3Template, values),
+                    std::move(values)};
+}
+
+} // namespace device_gemm_universal
+} // namespace host
+} // namespace ck
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/problem.hpp"
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/operation.hpp"
+#include "ck/host/utils.hpp"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace ck {
+namespace host {
+namespace device_grouped_conv_fwd_multiple_abd {
+
+static std::size_t
+GetOrDefault(const std::vector<std::size_t>& v, std::size_t i, std::size_t default_value)
+{
+    return i < v.size() ? v[i] : default_value;
+}
+
+static std::size_t Product(const std::vector<std::size_t>& v)
+{
+    return std::accumulate(v.begin(), v.end(), std::size_t{1}, std::multiplies<std::size_t>{});
+}
+
+std::size_t Problem::GetNumDim() const { return this->InputSpatialLengths.size(); }
+
+std::vector<std::size_t> Problem::GetOutputSpatialLengths() const
+{
+    std::vector<std::size_t> result;
+    for(std::size_t i = 0; i < this->GetNumDim(); i++)
+    {
+        const std::size_t x        = GetOrDefault(this->FilterSpatialLengths, i, 1);
+        const std::size_t stride   = GetOrDefault(this->ConvStrides, i, 1);
+        const std::size_t dilation = GetOrDefault(this->ConvDilations, i, 1);
+        const std::size_t padded   = this->InputSpatialLengths[i] +
+                                   GetOrDefault(this->InLeftPads, i, 0) +
+                                   GetOrDefault(this->InRightPads, i, 0);
+        const std::size_t x_eff = dilation * (x - 1) + 1;
+
+        result.push_back(padded < x_eff ? 0 : (padded - x_eff) / stride + 1);
+    }
+    return result;
+}
+
+std::size_t Problem::GetGemmM() const { return this->N * Product(this->GetOutputSpatialLengths()); }
+
+std::size_t Problem::GetGemmN() const { return this->K; }
+
+std::size_t Problem::GetGemmK() const
+{
+    std::size_t k = this->C;
+    for(std::size_t i = 0; i < this->GetNumDim(); i++)
+        k *= GetOrDefault(this->FilterSpatialLengths, i, 1);
+    return k;
+}
+
+std::string Problem::GetConvSpecialization() const
+{
+    bool filter1x1 = true;
+    bool stride1   = true;
+    for(std::size_t i = 0; i < this->GetNumDim(); i++)
+    {
+        filter1x1 = filter1x1 and GetOrDefault(this->FilterSpatialLengths, i, 1) == 1 and
+                    GetOrDefault(this->InLeftPads, i, 0) == 0 and
+                    GetOrDefault(this->InRightPads, i, 0) == 0;
+        stride1 = stride1 and GetOrDefault(this->ConvStrides, i, 1) == 1;
+    }
+
+    const std::string spec = "ck::tensor_operation::device::ConvolutionForwardSpecialization::";
+    if(filter1x1 and stride1)
+        return spec + "Filter1x1Stride1Pad0";
+    if(filter1x1)
+        return spec + "Filter1x1Pad0";
+    return spec + "Default";
+}
+
+std::string Problem::GetIncludeHeader() const
+{
+    return "ck/tensor_operation/gpu/device/impl/"
+           "device_grouped_conv_fwd_multiple_abd_xdl_cshuffle.hpp";
+}
+
+std::vector<Solution> Problem::GetSolutions(const std::string& arch,
+                                            std::size_t max_solutions) const
+{
+    if(get_xdlop_archs().count(arch) == 0)
+        return {};
+    return operation::GetRankedSolutions(
+        Operation_Xdl_CShuffle::CreateOperations(*this), *this, arch, max_solutions);
+}
+
+} // namespace device_grouped_conv_fwd_multiple_abd
+} // namespace host
+} // namespace ck
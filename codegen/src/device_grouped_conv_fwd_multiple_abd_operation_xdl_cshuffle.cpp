@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/operation.hpp"
+#include "ck/host/stringutils.hpp"
+#include "ck/host/utils.hpp"
+#include <cassert>
+#include <stdexcept>
+
+namespace ck {
+namespace host {
+namespace device_grouped_conv_fwd_multiple_abd {
+
+// layouts of the input, weight and output of a convolution with num_dim spatial dimensions
+static std::vector<std::string> GetLayouts(std::size_t num_dim)
+{
+    const std::string prefix = "ck::tensor_layout::convolution::";
+    switch(num_dim)
+    {
+    case 1: return {prefix + "NWGC", prefix + "GKXC", prefix + "NWGK"};
+    case 2: return {prefix + "NHWGC", prefix + "GKYXC", prefix + "NHWGK"};
+    case 3: return {prefix + "NDHWGC", prefix + "GKZYXC", prefix + "NDHWGK"};
+    }
+    throw std::runtime_error("Incorrect number of spatial dimensions");
+}
+
+static DataType GetAccDataType(DataType a)
+{
+    return a == DataType::Int8 ? DataType::Int32 : DataType::Float;
+}
+
+std::vector<Operation_Xdl_CShuffle> Operation_Xdl_CShuffle::CreateOperations(const Problem& prob)
+{
+    std::vector<Operation_Xdl_CShuffle> result;
+
+    // the first instance loads scalars, it runs any number of channels
+    std::vector<operation::TileDesc> tile_descriptions = {
+        // clang-format off
+//  Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl| NumGemmK|
+//   Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per| Prefetch|
+//       |      |      |      |    |    |     |     | Wave| Wave|    Stage|
+//       |      |      |      |    |    |     |     |     |     |         |
+  {    64,    64,    64,    32,   8,   8,   32,   32,    2,    2,        1},
+  {    64,    64,    32,    32,   8,   8,   32,   32,    2,    1,        1},
+  {   256,   128,   128,    32,   8,   8,   32,   32,    2,    2,        1},
+  {   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,        1},
+  {   256,   128,   256,    32,   8,   8,   32,   32,    2,    4,        1},
+  {   128,   128,   128,    32,   8,   8,   32,   32,    4,    2,        1},
+  {   256,   128,   128,    32,   8,   8,   32,   32,    2,    2,        1},
+  {   128,   128,    64,    32,   8,   8,   32,   32,    2,    2,        1},
+  {   128,    64,   128,    32,   8,   8,   32,   32,    2,    2,        1},
+  {    64,    64,    64,    32,   8,   8,   32,   32,    2,    2,        1},
+  {   256,   128,    64,    32,   8,   8,   32,   32,    2,    1,        1},
+  {   256,    64,   128,    32,   8,   8,   32,   32,    1,    2,        1},
+  {   128,   128,    32,    32,   8,   8,   32,   32,    2,    1,        1},
+  {   128,    32,   128,    32,   8,   8,   32,   32,    1,    2,        1},
+  {    64,    64,    32,    32,   8,   8,   32,   32,    2,    1,        1},
+  {    64,    32,    64,    32,   8,   8,   32,   32,    1,    2,        1},
+        // clang-format on
+    };
+
+    std::vector<operation::BlockTransferDesc> a_block_descriptions = {
+        // clang-format off
+//  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|
+//   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|
+// Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          |
+//                |               |               |               |               |               |          |
+  {    S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              1,              8,         1},
+  {    S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              1,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+  {    S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1},
+        // clang-format on
+    };
+
+    // the weight is read along C like the input
+    const auto& b_block_descriptions = a_block_descriptions;
+
+    std::vector<operation::CShuffleDesc> cshuffle_descriptions(tile_descriptions.size(), {1, 1});
+
+    std::vector<operation::CBlockTransferDesc> c_block_descriptions = {
+        // clang-format off
+// CBlockTransferClusterLengths|  CBlockTransfer
+//         _MBlock_MWaveMPerXdl| ScalarPerVector
+//         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl
+//                             |
+  {              S<1, 16, 1, 4>,               1},
+  {              S<1, 16, 1, 4>,               1},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 16, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 4>,               8},
+  {              S<1, 16, 1, 8>,               8},
+  {              S<1, 16, 1, 4>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 8>,               8},
+  {              S<1, 32, 1, 4>,               8},
+  {              S<1, 16, 1, 8>,               8},
+  {              S<1, 16, 1, 4>,               8},
+  {              S<1, 16, 1, 4>,               8},
+        // clang-format on
+    };
+
+    assert(tile_descriptions.size() == a_block_descriptions.size());
+    assert(tile_descriptions.size() == c_block_descriptions.size());
+
+    for(std::size_t i = 0; i < tile_descriptions.size(); i++)
+    {
+        Operation_Xdl_CShuffle x;
+        x.tile_desc           = tile_descriptions[i];
+        x.a_block_transfer    = a_block_descriptions[i];
+        x.b_block_transfer    = b_block_descriptions[i];
+        x.cshuffle            = cshuffle_descriptions[i];
+        x.c_block_transfer    = c_block_descriptions[i];
+        x.num_dim             = prob.GetNumDim();
+        x.a_type              = prob.ADataType;
+        x.b_type              = prob.BDataType;
+        x.acc                 = GetAccDataType(prob.ADataType);
+        x.cs_type             = prob.EDataType;
+        x.ds_type             = prob.DsDataType;
+        x.e_type              = prob.EDataType;
+        x.a_elem_op           = prob.AElementOp;
+        x.b_elem_op           = prob.BElementOp;
+        x.cde_elem_op         = prob.CDEElementOp;
+        x.conv_specialization = prob.GetConvSpecialization();
+        result.push_back(x);
+    }
+    return result;
+}
+
+std::vector<std::vector<Operation_Xdl_CShuffle>> Operation_Xdl_CShuffle::CreateOperations()
+{
+    std::vector<Problem> problems;
+    for(std::size_t num_dim : {1, 2, 3})
+    {
+        Problem prob;
+        prob.InputSpatialLengths  = std::vector<std::size_t>(num_dim, 8);
+        prob.FilterSpatialLengths = std::vector<std::size_t>(num_dim, 3);
+        problems.push_back(prob);
+    }
+    return Transform(problems, [](const Problem& p) { return CreateOperations(p); });
+}
+
+bool Operation_Xdl_CShuffle::IsSupported(const Problem& prob, const std::string& arch) const
+{
+    if(this->num_dim < 1 or this->num_dim > 3)
+        return false;
+
+    // A and B are read along C, Ds and E are written along K
+    const auto a_vec = static_cast<std::size_t>(this->a_block_transfer.src_scalar_per_vector);
+    const auto b_vec = static_cast<std::size_t>(this->b_block_transfer.src_scalar_per_vector);
+    const auto e_vec =
+        static_cast<std::size_t>(this->c_block_transfer.scalar_per_vector_n_wave_n_per_Xdl);
+    if(prob.C % a_vec != 0 or prob.C % b_vec != 0 or prob.K % e_vec != 0)
+        return false;
+
+    return this->GetLdsSize() <= get_lds_size(arch);
+}
+
+std::size_t Operation_Xdl_CShuffle::GetLdsSize() const
+{
+    return operation::GetLdsSize(this->tile_desc,
+                                 this->a_block_transfer,
+                                 this->b_block_transfer,
+                                 this->a_type,
+                                 this->b_type);
+}
+
+double Operation_Xdl_CShuffle::EstimateEfficiency(const Problem& prob,
+                                                  const std::string& arch) const
+{
+    return operation::EstimateEfficiency(prob.GetGemmM(),
+                                         prob.GetGemmN(),
+                                         prob.GetGemmK(),
+                                         prob.G,
+                                         this->tile_desc,
+                                         this->GetLdsSize(),
+                                         this->a_type,
+                                         this->b_type,
+                                         arch);
+}
+
+static const char* const DeviceGroupedConvFwdMultipleABD_Xdl_CShuffleTemplate =
+    "ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle<${NDimSpatial}, "
+    "${ALayout}, ${BLayout}, ${DsLayout}, ${ELayout}, ${ADataType}, ${BDataType}, "
+    "${AccDataType}, ${CShuffleDataType}, ${DsDataType}, ${EDataType}, "
+    "${AElementwiseOperation}, ${BElementwiseOperation}, ${CDEElementwiseOperation}, "
+    "${ConvForwardSpecialization}, ${GemmSpecialization}, ${NumGemmKPrefetchStage}, "
+    "${BlockSize}, ${MPerBlock}, ${NPerBlock}, ${KPerBlock}, ${AK1}, ${BK1}, ${MPerXDL}, "
+    "${NPerXDL}, ${MXdlPerWave}, ${NXdlPerWave}, "
+    "${ABlockTransferThreadClusterLengths_AK0_M_AK1}, "
+    "${ABlockTransferThreadClusterArrangeOrder}, ${ABlockTransferSrcAccessOrder}, "
+    "${ABlockTransferSrcVectorDim}, ${ABlockTransferSrcScalarPerVector}, "
+    "${ABlockTransferDstScalarPerVector_AK1}, ${ABlockLdsExtraM}, "
+    "${BBlockTransferThreadClusterLengths_BK0_N_BK1}, ${BBlockTransferThreadClusterArrangeOrder}, "
+    "${BBlockTransferSrcAccessOrder}, ${BBlockTransferSrcVectorDim}, "
+    "${BBlockTransferSrcScalarPerVector}, ${BBlockTransferDstScalarPerVector_BK1}, "
+    "${BBlockLdsExtraN}, ${CShuffleMXdlPerWavePerShuffle}, ${CShuffleNXdlPerWavePerShuffle}, "
+    "${CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock}, "
+    "${CDEBlockTransferScalarPerVector_NPerBlock}>";
+
+Solution Operation_Xdl_CShuffle::ToSolution() const
+{
+    const auto layouts = GetLayouts(this->num_dim);
+
+    std::unordered_map<std::string, std::string> values = {
+        {"NDimSpatial", std::to_string(this->num_dim)},
+        {"ALayout", layouts[0]},
+        {"BLayout", layouts[1]},
+        {"DsLayout", MakeTuple(Transform(this->ds_type, [&](auto) { return layouts[2]; }))},
+        {"ELayout", layouts[2]},
+        {"ADataType", ToString(this->a_type)},
+        {"BDataType", ToString(this->b_type)},
+        {"AccDataType", ToString(this->acc)},
+        {"CShuffleDataType", ToString(this->cs_type)},
+        {"DsDataType", MakeTuple(Transform(this->ds_type, [](auto dt) { return ToString(dt); }))},
+        {"EDataType", ToString(this->e_type)},
+        {"AElementwiseOperation", this->a_elem_op},
+        {"BElementwiseOperation", this->b_elem_op},
+        {"CDEElementwiseOperation", this->cde_elem_op},
+        {"ConvForwardSpecialization", this->conv_specialization},
+        {"GemmSpecialization", this->gemm_specialization},
+        {"NumGemmKPrefetchStage", std::to_string(this->tile_desc.num_gemmk_prefetch_stage)},
+        {"BlockSize", std::to_string(this->tile_desc.block_size)},
+        {"MPerBlock", std::to_string(this->tile_desc.m_per_block)},
+        {"NPerBlock", std::to_string(this->tile_desc.n_per_block)},
+        {"KPerBlock", std::to_string(this->tile_desc.k_per_block)},
+        {"AK1", std::to_string(this->tile_desc.ak1)},
+        {"BK1", std::to_string(this->tile_desc.bk1)},
+        {"MPerXDL", std::to_string(this->tile_desc.m_per_XDL)},
+        {"NPerXDL", std::to_string(this->tile_desc.n_per_XDL)},
+        {"MXdlPerWave", std::to_string(this->tile_desc.m_Xdl_per_wave)},
+        {"NXdlPerWave", std::to_string(this->tile_desc.n_Xdl_per_wave)},
+        {"ABlockTransferThreadClusterLengths_AK0_M_AK1",
+         this->a_block_transfer.thread_cluster_length},
+        {"ABlockTransferThreadClusterArrangeOrder",
+         this->a_block_transfer.thread_cluster_arrange_order},
+        {"ABlockTransferSrcAccessOrder", this->a_block_transfer.src_access_order},
+        {"ABlockTransferSrcVectorDim", std::to_string(this->a_block_transfer.src_vec_dim)},
+        {"ABlockTransferSrcScalarPerVector",
+         std::to_string(this->a_block_transfer.src_scalar_per_vector)},
+        {"ABlockTransferDstScalarPerVector_AK1",
+         std::to_string(this->a_block_transfer.dst_scalar_per_vector_k1)},
+        {"ABlockLdsExtraM", std::to_string(this->a_block_transfer.lds_add_extra_dim)},
+        {"BBlockTransferThreadClusterLengths_BK0_N_BK1",
+         this->b_block_transfer.thread_cluster_length},
+        {"BBlockTransferThreadClusterArrangeOrder",
+         this->b_block_transfer.thread_cluster_arrange_order},
+        {"BBlockTransferSrcAccessOrder", this->b_block_transfer.src_access_order},
+        {"BBlockTransferSrcVectorDim", std::to_string(this->b_block_transfer.src_vec_dim)},
+        {"BBlockTransferSrcScalarPerVector",
+         std::to_string(this->b_block_transfer.src_scalar_per_vector)},
+        {"BBlockTransferDstScalarPerVector_BK1",
+         std::to_string(this->b_block_transfer.dst_scalar_per_vector_k1)},
+        {"BBlockLdsExtraN", std::to_string(this->b_block_transfer.lds_add_extra_dim)},
+        {"CShuffleMXdlPerWavePerShuffle",
+         std::to_string(this->cshuffle.m_Xdl_per_wave_per_shuffle)},
+        {"CShuffleNXdlPerWavePerShuffle",
+         std::to_string(this->cshuffle.n_Xdl_per_wave_per_shuffle)},
+        {"CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock",
+         this->c_block_transfer.cluster_lengths_m_block_m_wave_m_per_Xdl_n_block_n_wave_n_per_Xdl},
+        {"CDEBlockTransferScalarPerVector_NPerBlock",
+         std::to_string(this->c_block_transfer.scalar_per_vector_n_wave_n_per_Xdl)},
+    };
+
+    return Solution{InterpolateString(DeviceGroupedConvFwdMultipleABD_Xdl_CShuffleTemplate, values),
+                    std::move(values)};
+}
+
+} // namespace device_grouped_conv_fwd_multiple_abd
+} // namespace host
+} // namespace ck
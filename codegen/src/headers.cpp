@@ -1,17 +1,44 @@
 #include "ck/host/headers.hpp"
 #include "ck_headers.hpp"
+#include <algorithm>
 
 namespace ck {
 namespace host {
 
 const std::string config_header = "";
 
-std::unordered_map<std::string_view, std::string_view> GetHeaders()
+const std::unordered_map<std::string_view, std::string_view>& GetHeaders()
 {
-    auto headers = ck_headers();
-    headers.insert(std::make_pair("ck/config.h", config_header));
+    static const auto headers = [] {
+        auto result = ck_headers();
+        result.insert(std::make_pair("ck/config.h", config_header));
+        return result;
+    }();
     return headers;
 }
 
+const std::vector<Header>& GetHeaderList()
+{
+    static const auto headers = [] {
+        std::vector<Header> result;
+        result.reserve(GetHeaders().size());
+        for(const auto& [name, content] : GetHeaders())
+            result.push_back({name, content});
+        std::sort(result.begin(), result.end(), [](const auto& x, const auto& y) {
+            return x.name < y.name;
+        });
+        return result;
+    }();
+    return headers;
+}
+
+std::optional<std::string_view> FindHeader(std::string_view name)
+{
+    auto it = GetHeaders().find(name);
+    if(it == GetHeaders().end())
+        return std::nullopt;
+    return it->second;
+}
+
 } // namespace host
-} // namespace ck
\ No newline at end of file
+} // namespace ck
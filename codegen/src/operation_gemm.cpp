@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/host/operation/gemm.hpp"
+#include "ck/host/utils.hpp"
+#include <algorithm>
+
+namespace ck {
+namespace host {
+namespace operation {
+
+std::string
+GetGemmSpecialization(std::size_t m, std::size_t n, std::size_t k, const TileDesc& tile)
+{
+    std::string spec = "";
+    if(m % static_cast<std::size_t>(tile.m_per_block) != 0)
+        spec += "M";
+    if(n % static_cast<std::size_t>(tile.n_per_block) != 0)
+        spec += "N";
+    if(k % static_cast<std::size_t>(tile.k_per_block) != 0)
+        spec += "K";
+    if(spec == "")
+        return "ck::tensor_operation::device::GemmSpecialization::Default";
+
+    return "ck::tensor_operation::device::GemmSpecialization::" + spec + "Padding";
+}
+
+bool IsVectorAccessSupported(std::size_t m,
+                             std::size_t n,
+                             std::size_t k,
+                             const TensorDesc& a,
+                             const BlockTransferDesc& a_block_transfer,
+                             const TensorDesc& b,
+                             const BlockTransferDesc& b_block_transfer,
+                             const TensorDesc& e,
+                             const CBlockTransferDesc& c_block_transfer)
+{
+    // vector load of A: along K when row major, along M when column major
+    const auto a_vec = static_cast<std::size_t>(a_block_transfer.src_scalar_per_vector);
+    if(a.layout == Layout::Row and a_block_transfer.src_vec_dim == 2)
+    {
+        if(k % a_vec != 0)
+            return false;
+    }
+    else if(a.layout == Layout::Column and a_block_transfer.src_vec_dim == 1)
+    {
+        if(m % a_vec != 0)
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    // vector load of B: along K when column major, along N when row major
+    const auto b_vec = static_cast<std::size_t>(b_block_transfer.src_scalar_per_vector);
+    if(b.layout == Layout::Column and b_block_transfer.src_vec_dim == 2)
+    {
+        if(k % b_vec != 0)
+            return false;
+    }
+    else if(b.layout == Layout::Row and b_block_transfer.src_vec_dim == 1)
+    {
+        if(n % b_vec != 0)
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    // E is only supported row major, it is stored along N
+    const auto e_vec =
+        static_cast<std::size_t>(c_block_transfer.scalar_per_vector_n_wave_n_per_Xdl);
+    return e.layout == Layout::Row and n % e_vec == 0;
+}
+
+std::size_t GetLdsSize(const TileDesc& tile,
+                       const BlockTransferDesc& a_block_transfer,
+                       const BlockTransferDesc& b_block_transfer,
+                       DataType a,
+                       DataType b)
+{
+    // a row of K1 elements is added per K0 when the LDS tile is padded
+    const auto k  = static_cast<std::size_t>(tile.k_per_block);
+    const auto mt = static_cast<std::size_t>(tile.m_per_block + a_block_transfer.lds_add_extra_dim);
+    const auto nt = static_cast<std::size_t>(tile.n_per_block + b_block_transfer.lds_add_extra_dim);
+    return mt * k * SizeOf(a) + nt * k * SizeOf(b);
+}
+
+double EstimateEfficiency(std::size_t m,
+                          std::size_t n,
+                          std::size_t k,
+                          std::size_t batch,
+                          const TileDesc& tile,
+                          std::size_t lds_size,
+                          DataType a,
+                          DataType b,
+                          const std::string& arch)
+{
+    if(m == 0 or n == 0 or k == 0 or batch == 0)
+        return 0;
+
+    const auto m_per_block = static_cast<std::size_t>(tile.m_per_block);
+    const auto n_per_block = static_cast<std::size_t>(tile.n_per_block);
+    const auto k_per_block = static_cast<std::size_t>(tile.k_per_block);
+
+    const std::size_t num_m_tile = integer_divide_ceil(m, m_per_block);
+    const std::size_t num_n_tile = integer_divide_ceil(n, n_per_block);
+    const std::size_t num_k_loop = integer_divide_ceil(k, k_per_block);
+
+    // useful flop over the flop of the padded problem
+    const double padding = static_cast<double>(m) / (num_m_tile * m_per_block) *
+                           static_cast<double>(n) / (num_n_tile * n_per_block) *
+                           static_cast<double>(k) / (num_k_loop * k_per_block);
+
+    // one tile per CU at a time, the last round of tiles may leave CUs idle
+    const std::size_t num_cu    = get_cu_count(arch);
+    const std::size_t num_tile  = batch * num_m_tile * num_n_tile;
+    const std::size_t num_round = integer_divide_ceil(num_tile, num_cu);
+    const double cu             = static_cast<double>(num_tile) / (num_round * num_cu);
+
+    // a CU that fits only one block cannot overlap the global loads of one block with the math of
+    // another, count it as three quarters of a CU running two
+    const std::size_t blocks_per_cu = get_lds_size(arch) / std::max<std::size_t>(lds_size, 1);
+    const double lds                = blocks_per_cu >= 2 ? 1.0 : 0.75;
+
+    // flop per byte of A and B loaded by a block, memory bound below 64
+    const double m_tile    = static_cast<double>(m_per_block);
+    const double n_tile    = static_cast<double>(n_per_block);
+    const double intensity = std::min(
+        1.0, 2 * m_tile * n_tile / (m_tile * SizeOf(a) + n_tile * SizeOf(b)) / 64);
+
+    // flop per element a wave reads from LDS, a 64x64 output per wave hides the reads
+    const double m_wave = tile.m_per_XDL * tile.m_Xdl_per_wave;
+    const double n_wave = tile.n_per_XDL * tile.n_Xdl_per_wave;
+    const double wave   = std::min(1.0, 2 * m_wave * n_wave / (m_wave + n_wave) / 64);
+
+    // prologue and C shuffle epilogue cost about two main loop iterations
+    const double pipeline = static_cast<double>(num_k_loop) / (num_k_loop + 2);
+
+    return padding * cu * lds * intensity * wave * pipeline;
+}
+
+} // namespace operation
+} // namespace host
+} // namespace ck
@@ -25,6 +25,22 @@ std::string ToString(DataType dt)
     case DataType::Half: return "ck::half_t";
     case DataType::Int8: return "int8_t";
     case DataType::Int32: return "int32_t";
+    case DataType::BFloat16: return "ck::bhalf_t";
+    case DataType::Float8: return "ck::f8_t";
+    }
+    throw std::runtime_error("Incorrect data type");
+}
+
+std::size_t SizeOf(DataType dt)
+{
+    switch(dt)
+    {
+    case DataType::Float: return 4;
+    case DataType::Half: return 2;
+    case DataType::Int8: return 1;
+    case DataType::Int32: return 4;
+    case DataType::BFloat16: return 2;
+    case DataType::Float8: return 1;
     }
     throw std::runtime_error("Incorrect data type");
 }
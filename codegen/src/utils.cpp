@@ -1,7 +1,8 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #include "ck/host/utils.hpp"
+#include <unordered_map>
 
 namespace ck {
 namespace host {
@@ -17,5 +18,15 @@ const std::unordered_set<std::string>& get_xdlop_archs()
     return supported_archs;
 }
 
+std::size_t get_cu_count(const std::string& arch)
+{
+    static const std::unordered_map<std::string, std::size_t> cu_counts{
+        {"gfx908", 120}, {"gfx90a", 104}, {"gfx940", 228}, {"gfx942", 304}};
+    auto it = cu_counts.find(arch);
+    return it == cu_counts.end() ? 64 : it->second;
+}
+
+std::size_t get_lds_size(const std::string&) { return 65536; }
+
 } // namespace host
 } // namespace ck
@@ -17,14 +17,21 @@ using half = _Float16;
 std::vector<rtc::src_file> get_headers_for_test()
 {
     std::vector<rtc::src_file> result;
-    auto hs = ck::host::GetHeaders();
+    const auto& hs = ck::host::GetHeaderList();
     std::transform(
-        hs.begin(), hs.end(), std::back_inserter(result), [&](const auto& p) -> rtc::src_file {
-            return {p.first, p.second};
+        hs.begin(), hs.end(), std::back_inserter(result), [&](const auto& h) -> rtc::src_file {
+            return {h.name, h.content};
         });
     return result;
 }
 
+// the headers are written once for all kernels of the test
+const std::filesystem::path& get_include_dir_for_test()
+{
+    static const auto dir = rtc::shared_include_dir(get_headers_for_test());
+    return dir;
+}
+
 template <class T>
 rtc::buffer<T> generate_buffer(std::size_t n, std::size_t seed = 0)
 {
@@ -167,15 +174,15 @@ TEST_CASE(test_problem_kernel)
                                                 {"m", std::to_string(prob.M)},
                                                 {"n", std::to_string(prob.N)},
                                                 {"k", std::to_string(prob.K)}});
-        auto srcs = get_headers_for_test();
-        srcs.push_back({"main.cpp", src});
+        auto srcs = std::vector<rtc::src_file>{{"main.cpp", src}};
         rtc::compile_options options;
-        options.kernel_name = "f";
-        auto k              = rtc::compile_kernel(srcs, options);
-        auto block_size     = solution.GetTemplateParameter<std::size_t>("BlockSize");
-        auto m_per_block    = solution.GetTemplateParameter<std::size_t>("MPerBlock");
-        auto n_per_block    = solution.GetTemplateParameter<std::size_t>("NPerBlock");
-        auto grid_size      = ck::host::integer_divide_ceil(prob.M, m_per_block) *
+        options.kernel_name  = "f";
+        options.include_dirs = {get_include_dir_for_test()};
+        auto k               = rtc::compile_kernel(srcs, options);
+        auto block_size      = solution.GetTemplateParameter<std::size_t>("BlockSize");
+        auto m_per_block     = solution.GetTemplateParameter<std::size_t>("MPerBlock");
+        auto n_per_block     = solution.GetTemplateParameter<std::size_t>("NPerBlock");
+        auto grid_size       = ck::host::integer_divide_ceil(prob.M, m_per_block) *
                          ck::host::integer_divide_ceil(prob.N, n_per_block);
         k.launch(nullptr, grid_size * block_size, block_size)(a.data(), b.data(), c.data());
         CHECK(report(solution, check(rtc::from_gpu(c))));
@@ -0,0 +1,76 @@
+#include "ck/host/device_gemm_multiple_d/problem.hpp"
+#include "ck/host/device_gemm_multiple_d/operation.hpp"
+#include <algorithm>
+#include <test.hpp>
+
+using ck::host::device_gemm_multiple_d::Problem;
+
+static Problem make_problem(std::size_t m, std::size_t n, std::size_t k)
+{
+    Problem prob;
+    prob.M = m;
+    prob.N = n;
+    prob.K = k;
+    return prob;
+}
+
+static std::size_t get_parameter(const ck::host::Solution& solution, const std::string& name)
+{
+    return solution.GetTemplateParameter<std::size_t>(name);
+}
+
+TEST_CASE(max_solutions)
+{
+    auto prob = make_problem(1000, 3000, 512);
+    auto all  = prob.GetSolutions("gfx90a");
+    auto best = prob.GetSolutions("gfx90a", 3);
+
+    EXPECT(all.size() == 8);
+    EXPECT(best.size() == 3);
+    for(std::size_t i = 0; i < best.size(); ++i)
+        EXPECT(best[i].ToTemplateString() == all[i].ToTemplateString());
+
+    EXPECT(prob.GetSolutions("gfx90a", 100).size() == all.size());
+    EXPECT(prob.GetSolutions("gfx1100").empty());
+}
+
+TEST_CASE(small_problem_prefers_small_tiles)
+{
+    // a single 128x128 tile leaves all but one CU idle, smaller tiles use more of them
+    auto solutions = make_problem(128, 128, 4096).GetSolutions("gfx942");
+    EXPECT(not solutions.empty());
+    EXPECT(get_parameter(solutions.front(), "MPerBlock") *
+               get_parameter(solutions.front(), "NPerBlock") ==
+           128 * 64);
+}
+
+TEST_CASE(large_problem_prefers_large_tiles)
+{
+    auto solutions = make_problem(8192, 8192, 8192).GetSolutions("gfx942");
+    EXPECT(solutions.size() == 8);
+    EXPECT(get_parameter(solutions.front(), "MPerBlock") *
+               get_parameter(solutions.front(), "NPerBlock") ==
+           256 * 128);
+}
+
+TEST_CASE(vector_width)
+{
+    // row major A is loaded 8 elements at a time along K
+    EXPECT(make_problem(1024, 1024, 1020).GetSolutions("gfx90a").empty());
+
+    // column major A is loaded along M, only the instances loading 1 or 2 elements fit
+    auto prob      = make_problem(1022, 1024, 1024);
+    prob.TransA    = true;
+    auto solutions = prob.GetSolutions("gfx90a");
+    EXPECT(not solutions.empty());
+    EXPECT(solutions.size() < 8);
+    for(const auto& solution : solutions)
+        EXPECT(1022 % get_parameter(solution, "ABlockTransferSrcScalarPerVector") == 0);
+
+    // E is only stored row major
+    auto prob_e   = make_problem(1024, 1024, 1024);
+    prob_e.TransE = true;
+    EXPECT(prob_e.GetSolutions("gfx90a").empty());
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
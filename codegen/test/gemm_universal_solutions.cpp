@@ -0,0 +1,90 @@
+#include "ck/host/device_gemm_universal/problem.hpp"
+#include "ck/host/device_gemm_universal/operation.hpp"
+#include "ck/host/utils.hpp"
+#include <test.hpp>
+
+using ck::host::device_gemm_universal::Problem;
+
+static Problem make_problem(std::size_t m, std::size_t n, std::size_t k)
+{
+    Problem prob;
+    prob.M = m;
+    prob.N = n;
+    prob.K = k;
+    return prob;
+}
+
+static bool contains(const std::string& s, const std::string& x)
+{
+    return s.find(x) != std::string::npos;
+}
+
+TEST_CASE(template_string)
+{
+    auto prob      = make_problem(4096, 4096, 4096);
+    prob.TransB    = true;
+    auto solutions = prob.GetSolutions("gfx942", 1);
+    EXPECT(solutions.size() == std::size_t{1});
+
+    const auto& solution = solutions.front();
+    const auto str       = solution.ToTemplateString();
+    EXPECT(contains(str, "ck::tensor_operation::device::DeviceGemm_Xdl_CShuffleV3<"));
+    EXPECT(contains(str, "ck::BlockGemmPipelineScheduler::"));
+    EXPECT(contains(str, "ck::BlockGemmPipelineVersion::"));
+    EXPECT(solution.GetTemplateParameter("LayoutB") == "ck::tensor_layout::gemm::ColumnMajor");
+    EXPECT(solution.GetTemplateParameter("GemmSpecialization") ==
+           "ck::tensor_operation::device::GemmSpecialization::Default");
+}
+
+TEST_CASE(data_types)
+{
+    auto prob      = make_problem(1024, 1024, 1024);
+    prob.ADataType = ck::host::DataType::Float8;
+    prob.BDataType = ck::host::DataType::BFloat16;
+    prob.CDataType = ck::host::DataType::BFloat16;
+    auto solutions = prob.GetSolutions("gfx942");
+    EXPECT(not solutions.empty());
+    for(const auto& solution : solutions)
+    {
+        EXPECT(solution.GetTemplateParameter("ADataType") == "ck::f8_t");
+        EXPECT(solution.GetTemplateParameter("BDataType") == "ck::bhalf_t");
+        EXPECT(solution.GetTemplateParameter("AccDataType") == "float");
+    }
+}
+
+TEST_CASE(row_major_b)
+{
+    // B is loaded along N with the vector width of the instance
+    auto solutions = make_problem(1024, 1020, 1024).GetSolutions("gfx90a");
+    EXPECT(not solutions.empty());
+    for(const auto& solution : solutions)
+    {
+        const auto b_vec = solution.GetTemplateParameter<std::size_t>(
+            "BBlockTransferSrcScalarPerVector");
+        const auto c_vec = solution.GetTemplateParameter<std::size_t>(
+            "CShuffleBlockTransferScalarPerVector_NPerBlock");
+        EXPECT(1020 % b_vec == 0u);
+        EXPECT(1020 % c_vec == 0u);
+        EXPECT(solution.GetTemplateParameter("BK1") ==
+               solution.GetTemplateParameter("BBlockTransferDstScalarPerVector_BK1"));
+    }
+}
+
+TEST_CASE(unsupported)
+{
+    auto prob   = make_problem(1024, 1024, 1024);
+    prob.TransA = true;
+    EXPECT(prob.GetSolutions("gfx90a").empty());
+    EXPECT(make_problem(1024, 1024, 1020).GetSolutions("gfx90a").empty());
+    EXPECT(make_problem(1024, 1024, 1024).GetSolutions("gfx1100").empty());
+}
+
+TEST_CASE(lds_fits)
+{
+    using ck::host::device_gemm_universal::Operation_Xdl_CShuffle_V3;
+    for(const auto& ops : Operation_Xdl_CShuffle_V3::CreateOperations())
+        for(const auto& op : ops)
+            EXPECT(op.GetLdsSize() <= ck::host::get_lds_size("gfx942"));
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
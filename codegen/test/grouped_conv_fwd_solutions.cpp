@@ -0,0 +1,98 @@
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/problem.hpp"
+#include "ck/host/device_grouped_conv_fwd_multiple_abd/operation.hpp"
+#include <test.hpp>
+
+using ck::host::device_grouped_conv_fwd_multiple_abd::Problem;
+
+static Problem make_problem(std::size_t c, std::size_t k, std::size_t filter, std::size_t pad)
+{
+    Problem prob;
+    prob.G                    = 2;
+    prob.N                    = 4;
+    prob.C                    = c;
+    prob.K                    = k;
+    prob.InputSpatialLengths  = {28, 28};
+    prob.FilterSpatialLengths = {filter, filter};
+    prob.InLeftPads           = {pad, pad};
+    prob.InRightPads          = {pad, pad};
+    return prob;
+}
+
+TEST_CASE(implicit_gemm)
+{
+    auto prob = make_problem(64, 128, 3, 1);
+    EXPECT(prob.GetOutputSpatialLengths() == std::vector<std::size_t>{28, 28});
+    EXPECT(prob.GetGemmM() == std::size_t{4 * 28 * 28});
+    EXPECT(prob.GetGemmN() == std::size_t{128});
+    EXPECT(prob.GetGemmK() == std::size_t{64 * 3 * 3});
+
+    prob.ConvStrides   = {2, 2};
+    prob.ConvDilations = {2, 2};
+    EXPECT(prob.GetOutputSpatialLengths() == std::vector<std::size_t>{13, 13});
+}
+
+TEST_CASE(conv_specialization)
+{
+    const std::string spec = "ck::tensor_operation::device::ConvolutionForwardSpecialization::";
+
+    auto prob = make_problem(64, 128, 1, 0);
+    EXPECT(prob.GetConvSpecialization() == spec + "Filter1x1Stride1Pad0");
+    prob.ConvStrides = {2, 2};
+    EXPECT(prob.GetConvSpecialization() == spec + "Filter1x1Pad0");
+    EXPECT(make_problem(64, 128, 3, 1).GetConvSpecialization() == spec + "Default");
+}
+
+TEST_CASE(template_string)
+{
+    auto prob       = make_problem(64, 128, 3, 1);
+    prob.ADataType  = ck::host::DataType::BFloat16;
+    prob.BDataType  = ck::host::DataType::BFloat16;
+    prob.EDataType  = ck::host::DataType::BFloat16;
+    prob.DsDataType = {ck::host::DataType::BFloat16};
+    auto solutions  = prob.GetSolutions("gfx90a", 2);
+    EXPECT(solutions.size() == std::size_t{2});
+
+    const auto& solution = solutions.front();
+    const std::string prefix =
+        "ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle<2, "
+        "ck::tensor_layout::convolution::NHWGC, ck::tensor_layout::convolution::GKYXC, "
+        "ck::Tuple<ck::tensor_layout::convolution::NHWGK>, ck::tensor_layout::convolution::NHWGK, "
+        "ck::bhalf_t, ck::bhalf_t, float, ck::bhalf_t, ck::Tuple<ck::bhalf_t>, ck::bhalf_t, ";
+    EXPECT(solution.ToTemplateString().compare(0, prefix.size(), prefix) == 0);
+    EXPECT(solution.GetTemplateParameter("GemmSpecialization") ==
+           "ck::tensor_operation::device::GemmSpecialization::MNKPadding");
+}
+
+TEST_CASE(vector_width)
+{
+    // odd channels only run on the instance loading and storing scalars
+    auto solutions = make_problem(3, 5, 3, 1).GetSolutions("gfx90a");
+    EXPECT(solutions.size() == std::size_t{1});
+    EXPECT(solutions.front().GetTemplateParameter("ABlockTransferSrcScalarPerVector") == "1");
+
+    // C loaded 8 at a time but K stored one at a time
+    auto solutions_k = make_problem(64, 5, 3, 1).GetSolutions("gfx90a");
+    EXPECT(solutions_k.size() == std::size_t{2});
+    for(const auto& solution : solutions_k)
+        EXPECT(solution.GetTemplateParameter("CDEBlockTransferScalarPerVector_NPerBlock") == "1");
+
+    EXPECT(make_problem(64, 128, 3, 1).GetSolutions("gfx90a").size() == std::size_t{16});
+}
+
+TEST_CASE(groups_fill_the_device)
+{
+    // one group of a small convolution fills few CUs, many groups prefer the largest tiles
+    auto prob      = make_problem(256, 256, 3, 1);
+    prob.G         = 1;
+    prob.N         = 1;
+    auto few       = prob.GetSolutions("gfx942", 1);
+    prob.G         = 64;
+    auto many      = prob.GetSolutions("gfx942", 1);
+    auto tile_size = [](const ck::host::Solution& solution) {
+        return solution.GetTemplateParameter<std::size_t>("MPerBlock") *
+               solution.GetTemplateParameter<std::size_t>("NPerBlock");
+    };
+    EXPECT(tile_size(few.front()) < tile_size(many.front()));
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
@@ -0,0 +1,61 @@
+#ifndef GUARD_HOST_TEST_INCLUDE_FAKE_COMPILER
+#define GUARD_HOST_TEST_INCLUDE_FAKE_COMPILER
+
+#include <rtc/compile_kernel.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Stand-in for the device compiler, so the rtc pipeline can be tested without ROCm or a GPU. It
+// writes the target, the ck/header.hpp found in the last include directory (if any) and the source
+// to the output, and counts its invocations.
+struct fake_compiler
+{
+    rtc::tmp_dir td{"fake-compiler"};
+
+    fake_compiler() { write(); }
+
+    // rewrites the compiler, as an update installed over the same path would
+    void write(const std::string& version = "")
+    {
+        std::ofstream os(td.path / "compiler.sh");
+        os << "# " << version << "\n"
+           << "echo >> " << (td.path / "count").string() << "\n"
+           << "inc=\n"
+           << "while [ $# -gt 0 ]; do\n"
+           << "    case \"$1\" in\n"
+           << "        -c) src=$2; shift ;;\n"
+           << "        -o) out=$2; shift ;;\n"
+           << "        -I.) ;;\n"
+           << "        -I*) inc=${1#-I} ;;\n"
+           << "        --offload-arch=*) arch=$1 ;;\n"
+           << "    esac\n"
+           << "    shift\n"
+           << "done\n"
+           << "{ echo \"$arch\"; [ -z \"$inc\" ] || cat \"$inc/ck/header.hpp\"; cat \"$src\"; } "
+              "> \"$out\"\n";
+    }
+
+    rtc::compile_options options(const std::string& arch                         = "gfx000",
+                                 std::vector<std::filesystem::path> include_dirs = {}) const
+    {
+        rtc::compile_options result;
+        result.arch         = arch;
+        result.compiler     = "sh " + (td.path / "compiler.sh").string();
+        result.include_dirs = std::move(include_dirs);
+        return result;
+    }
+
+    int count() const
+    {
+        std::ifstream is(td.path / "count");
+        return std::count(
+            std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>(), '\n');
+    }
+};
+
+#endif
@@ -2,8 +2,10 @@
 #define GUARD_HOST_TEST_RTC_INCLUDE_RTC_COMPILE_KERNEL
 
 #include <rtc/kernel.hpp>
+#include <cstddef>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace rtc {
 
@@ -13,15 +15,53 @@ struct src_file
     std::string_view content;
 };
 
+struct kernel_cache;
+
 struct compile_options
 {
     std::string flags       = "";
     std::string kernel_name = "main";
+    // target architecture, the current device when empty
+    std::string arch = "";
+    // compiler command, rtc::compiler() when empty
+    std::string compiler = "";
+    // passed with -I. Only the paths go into the key of the cached code object, so the name of a
+    // directory must identify its contents, like the one of a shared_include_dir.
+    std::vector<std::filesystem::path> include_dirs = {};
 };
 
+std::string compiler();
+
+// Directory with the headers written out, named by a hash of their paths and contents. It is
+// written once and then reused by later calls and other processes, so compilations that pass it in
+// compile_options::include_dirs neither write nor hash every header again.
+std::filesystem::path shared_include_dir(const std::vector<src_file>& headers);
+
+// Code object of the sources. It is taken from the cache when the same sources were compiled
+// before with the same compiler, flags and architecture, otherwise it is compiled and stored.
+std::vector<char> compile_code_object(const std::vector<src_file>& src,
+                                      compile_options options = compile_options{});
+std::vector<char> compile_code_object(const std::vector<src_file>& src,
+                                      compile_options options,
+                                      const kernel_cache& cache);
+
+// compile_code_object of each set of sources, running up to jobs compilations at a time
+// (std::thread::hardware_concurrency() when 0)
+std::vector<std::vector<char>> compile_code_objects(const std::vector<std::vector<src_file>>& srcs,
+                                                    compile_options options = compile_options{},
+                                                    std::size_t jobs        = 0);
+std::vector<std::vector<char>> compile_code_objects(const std::vector<std::vector<src_file>>& srcs,
+                                                    compile_options options,
+                                                    std::size_t jobs,
+                                                    const kernel_cache& cache);
+
 kernel compile_kernel(const std::vector<src_file>& src,
                       compile_options options = compile_options{});
 
+std::vector<kernel> compile_kernels(const std::vector<std::vector<src_file>>& srcs,
+                                    compile_options options = compile_options{},
+                                    std::size_t jobs        = 0);
+
 } // namespace rtc
 
 #endif
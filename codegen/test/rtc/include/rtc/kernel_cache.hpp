@@ -0,0 +1,61 @@
+#ifndef GUARD_HOST_TEST_RTC_INCLUDE_RTC_KERNEL_CACHE
+#define GUARD_HOST_TEST_RTC_INCLUDE_RTC_KERNEL_CACHE
+
+#include <rtc/compile_kernel.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rtc {
+
+// On-disk cache of compiled code objects, one file per key in a directory.
+//
+// Entries are written to a temporary file and renamed into place, so processes sharing the
+// directory never read a partial code object. A hit refreshes the modification time of the entry
+// and a store evicts the least recently used entries once the directory grows beyond max_size.
+struct kernel_cache
+{
+    static constexpr std::uintmax_t default_max_size = std::uintmax_t{1} << 30;
+
+    kernel_cache() = default;
+    explicit kernel_cache(std::filesystem::path d, std::uintmax_t max = default_max_size);
+
+    // the cache in CK_RTC_CACHE_DIR, or in ck-rtc-cache under the temporary directory when the
+    // variable is unset. Setting it to an empty string disables caching. CK_RTC_CACHE_MAX_SIZE
+    // overrides the size limit in bytes.
+    static const kernel_cache& get_default();
+
+    bool enabled() const { return not dir.empty(); }
+
+    std::filesystem::path get_path(const std::string& key) const;
+
+    std::optional<std::vector<char>> load(const std::string& key) const;
+    bool store(const std::string& key, const std::vector<char>& obj) const;
+
+    // removes the least recently used entries until the cache fits max_size
+    void trim() const;
+
+    std::filesystem::path dir;
+    std::uintmax_t max_size = default_max_size;
+};
+
+// Identity of an installed compiler: the resolved path, size and modification time of each file
+// the compiler command names, e.g. the program and a wrapper script, so a ROCm update or a rebuilt
+// compiler behind the same command line does not hit code objects of the old one
+std::string compiler_identity(const std::string& compiler);
+
+// Key of a code object: a hash of the compiler identity, the full compiler command line, the
+// target architecture, the headers and the other sources, each with its path
+std::string compile_key(const std::string& compiler,
+                        const std::string& command,
+                        const std::string& arch,
+                        const std::vector<src_file>& srcs);
+
+// Hash of the paths and contents of the sources, independent of their order
+std::string sources_key(const std::vector<src_file>& srcs);
+
+} // namespace rtc
+
+#endif
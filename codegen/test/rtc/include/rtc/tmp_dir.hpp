@@ -6,6 +6,9 @@
 
 namespace rtc {
 
+// prefix followed by the process, thread, time and random characters
+std::string unique_string(const std::string& prefix);
+
 struct tmp_dir
 {
     std::filesystem::path path;
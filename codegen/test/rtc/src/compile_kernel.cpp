@@ -1,10 +1,16 @@
 #include "rtc/hip.hpp"
 #include <rtc/compile_kernel.hpp>
+#include <rtc/kernel_cache.hpp>
 #include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <stdexcept>
 #include <iostream>
 #include <fstream>
 #include <cassert>
+#include <system_error>
+#include <thread>
 
 namespace rtc {
 
@@ -57,21 +63,59 @@ void write_string(const std::string& filename, const std::string_view& buffer)
 
 std::string compiler() { return "/opt/rocm/llvm/bin/clang++ -x hip --cuda-device-only"; }
 
-kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options)
+void write_srcs(const std::filesystem::path& dir, const std::vector<src_file>& srcs)
+{
+    for(const auto& src : srcs)
+    {
+        std::filesystem::path full_path   = dir / src.path;
+        std::filesystem::path parent_path = full_path.parent_path();
+        std::filesystem::create_directories(parent_path);
+        write_string(full_path.string(), src.content);
+    }
+}
+
+std::filesystem::path shared_include_dir(const std::vector<src_file>& headers)
+{
+    auto parent = std::filesystem::temp_directory_path() / "ck-rtc-include";
+    auto path   = parent / sources_key(headers);
+    if(std::filesystem::is_directory(path))
+        return path;
+
+    // the headers are written to a temporary directory and renamed into place, so a compilation
+    // never sees part of them. When another process renamed its copy first, that one is used.
+    std::filesystem::create_directories(parent);
+    auto tmp_path = parent / unique_string("tmp");
+    write_srcs(tmp_path, headers);
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if(ec)
+    {
+        std::filesystem::remove_all(tmp_path, ec);
+        if(not std::filesystem::is_directory(path))
+            throw std::runtime_error("Failed to create include directory: " + path.string());
+    }
+    return path;
+}
+
+std::vector<char> compile_code_object(const std::vector<src_file>& srcs,
+                                      compile_options options,
+                                      const kernel_cache& cache)
 {
     assert(not srcs.empty());
-    tmp_dir td{"compile"};
+    if(options.arch.empty())
+        options.arch = get_device_name();
+    if(options.compiler.empty())
+        options.compiler = compiler();
     options.flags += " -I. -O3";
+    for(const auto& dir : options.include_dirs)
+        options.flags += " -I" + std::filesystem::absolute(dir).string();
     options.flags += " -std=c++17";
-    options.flags += " --offload-arch=" + get_device_name();
+    options.flags += " --offload-arch=" + options.arch;
     std::string out;
 
     for(const auto& src : srcs)
     {
-        std::filesystem::path full_path   = td.path / src.path;
-        std::filesystem::path parent_path = full_path.parent_path();
-        std::filesystem::create_directories(parent_path);
-        write_string(full_path.string(), src.content);
         if(src.path.extension().string() == ".cpp")
         {
             options.flags += " -c " + src.path.filename().string();
@@ -81,15 +125,99 @@ kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options
     }
 
     options.flags += " -o " + out;
-    td.execute(compiler() + options.flags);
+    auto command = options.compiler + options.flags;
+
+    auto key = compile_key(options.compiler, command, options.arch, srcs);
+    if(auto obj = cache.load(key))
+        return std::move(*obj);
+
+    tmp_dir td{"compile"};
+    write_srcs(td.path, srcs);
+
+    td.execute(command);
 
     auto out_path = td.path / out;
     if(not std::filesystem::exists(out_path))
         throw std::runtime_error("Output file missing: " + out);
 
     auto obj = read_buffer(out_path.string());
+    cache.store(key, obj);
 
+    return obj;
+}
+
+std::vector<char> compile_code_object(const std::vector<src_file>& srcs, compile_options options)
+{
+    return compile_code_object(srcs, std::move(options), kernel_cache::get_default());
+}
+
+std::vector<std::vector<char>> compile_code_objects(const std::vector<std::vector<src_file>>& srcs,
+                                                    compile_options options,
+                                                    std::size_t jobs,
+                                                    const kernel_cache& cache)
+{
+    // the device is queried once, not from every worker
+    if(options.arch.empty())
+        options.arch = get_device_name();
+    if(jobs == 0)
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+    jobs = std::min(jobs, srcs.size());
+
+    std::vector<std::vector<char>> objs(srcs.size());
+    std::vector<std::exception_ptr> errors(srcs.size());
+    std::atomic<std::size_t> next{0};
+
+    auto worker = [&] {
+        for(std::size_t i = next++; i < srcs.size(); i = next++)
+        {
+            try
+            {
+                objs[i] = compile_code_object(srcs[i], options, cache);
+            }
+            catch(...)
+            {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 1; i < jobs; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(auto& t : threads)
+        t.join();
+
+    for(const auto& e : errors)
+    {
+        if(e)
+            std::rethrow_exception(e);
+    }
+
+    return objs;
+}
+
+std::vector<std::vector<char>> compile_code_objects(const std::vector<std::vector<src_file>>& srcs,
+                                                    compile_options options,
+                                                    std::size_t jobs)
+{
+    return compile_code_objects(srcs, std::move(options), jobs, kernel_cache::get_default());
+}
+
+kernel compile_kernel(const std::vector<src_file>& srcs, compile_options options)
+{
+    auto obj = compile_code_object(srcs, options);
     return kernel{obj.data(), options.kernel_name};
 }
 
+std::vector<kernel> compile_kernels(const std::vector<std::vector<src_file>>& srcs,
+                                    compile_options options,
+                                    std::size_t jobs)
+{
+    std::vector<kernel> kernels;
+    for(const auto& obj : compile_code_objects(srcs, options, jobs))
+        kernels.emplace_back(obj.data(), options.kernel_name);
+    return kernels;
+}
+
 } // namespace rtc
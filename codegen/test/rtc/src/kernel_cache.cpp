@@ -0,0 +1,292 @@
+#include <rtc/kernel_cache.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+namespace rtc {
+
+namespace {
+
+// two 64-bit multiply-xorshift hashes over 8-byte words with different seeds, 128 bits in total
+struct content_hash
+{
+    std::uint64_t h[2] = {0x243f6a8885a308d3ull, 0x13198a2e03707344ull};
+
+    void mix(std::uint64_t word)
+    {
+        for(auto& x : h)
+        {
+            x ^= word * 0x9e3779b97f4a7c15ull;
+            x = (x << 31 | x >> 33) * 0xbf58476d1ce4e5b9ull;
+            word += 0x632be59bd9b4e019ull;
+        }
+    }
+
+    // the size goes first so consecutive fields cannot run into each other
+    void add(std::string_view s)
+    {
+        mix(s.size());
+
+        std::size_t i = 0;
+        for(; i + 8 <= s.size(); i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, s.data() + i, 8);
+            mix(word);
+        }
+
+        std::uint64_t tail = 0;
+        if(s.size() > i)
+            std::memcpy(&tail, s.data() + i, s.size() - i);
+        mix(tail);
+    }
+
+    std::string str() const
+    {
+        std::stringstream ss;
+        for(auto x : h)
+        {
+            x ^= x >> 29;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 32;
+            ss << std::hex << std::setw(16) << std::setfill('0') << x;
+        }
+        return ss.str();
+    }
+};
+
+const std::string cache_extension = ".co";
+
+// the file a word of the compiler command names, searching PATH for the program itself
+std::filesystem::path find_file(const std::string& word, bool program)
+{
+    std::error_code ec;
+    if(word.find('/') != std::string::npos or not program)
+    {
+        if(std::filesystem::is_regular_file(word, ec))
+            return word;
+        return {};
+    }
+
+    const char* env = std::getenv("PATH");
+    std::stringstream paths(env == nullptr ? "" : env);
+    std::string dir;
+    while(std::getline(paths, dir, ':'))
+    {
+        auto path = std::filesystem::path(dir.empty() ? "." : dir) / word;
+        if(std::filesystem::is_regular_file(path, ec))
+            return path;
+    }
+    return {};
+}
+
+} // namespace
+
+kernel_cache::kernel_cache(std::filesystem::path d, std::uintmax_t max)
+    : dir(std::move(d)), max_size(max)
+{
+}
+
+const kernel_cache& kernel_cache::get_default()
+{
+    static const kernel_cache cache = [] {
+        std::filesystem::path d;
+        if(const char* env = std::getenv("CK_RTC_CACHE_DIR"))
+            d = env;
+        else
+            d = std::filesystem::temp_directory_path() / "ck-rtc-cache";
+
+        std::uintmax_t max = default_max_size;
+        if(const char* env = std::getenv("CK_RTC_CACHE_MAX_SIZE"))
+            max = std::strtoull(env, nullptr, 10);
+
+        return kernel_cache{d, max};
+    }();
+    return cache;
+}
+
+std::filesystem::path kernel_cache::get_path(const std::string& key) const
+{
+    return dir / (key + cache_extension);
+}
+
+std::optional<std::vector<char>> kernel_cache::load(const std::string& key) const
+{
+    if(not enabled())
+        return std::nullopt;
+
+    auto path = get_path(key);
+    std::ifstream is(path, std::ios::binary | std::ios::ate);
+    if(not is)
+        return std::nullopt;
+
+    auto size = static_cast<std::size_t>(is.tellg());
+    if(size == 0)
+        return std::nullopt;
+
+    std::vector<char> obj(size);
+    is.seekg(0, std::ios::beg);
+    if(not is.read(obj.data(), obj.size()))
+        return std::nullopt;
+
+    // a hit makes the entry the most recently used one
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    return obj;
+}
+
+bool kernel_cache::store(const std::string& key, const std::vector<char>& obj) const
+{
+    if(not enabled() or obj.empty())
+        return false;
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+
+    auto path     = get_path(key);
+    auto tmp_path = dir / unique_string(key + ".tmp");
+    {
+        std::ofstream os(tmp_path, std::ios::binary | std::ios::trunc);
+        if(not os.write(obj.data(), obj.size()) or not os.flush())
+        {
+            os.close();
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmp_path, path, ec);
+    if(ec)
+    {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+
+    // file systems may keep coarse modification times, the order of entries must be exact
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    trim();
+    return true;
+}
+
+void kernel_cache::trim() const
+{
+    if(not enabled())
+        return;
+
+    struct entry
+    {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type time;
+    };
+
+    std::vector<entry> entries;
+    std::uintmax_t total = 0;
+
+    // other processes may add or remove entries meanwhile, errors just skip the entry
+    std::error_code ec;
+    for(std::filesystem::directory_iterator it{dir, ec}, end; not ec and it != end;
+        it.increment(ec))
+    {
+        const auto& path = it->path();
+        if(path.extension() != cache_extension)
+            continue;
+
+        std::error_code entry_ec;
+        auto size = std::filesystem::file_size(path, entry_ec);
+        auto time = std::filesystem::last_write_time(path, entry_ec);
+        if(entry_ec)
+            continue;
+
+        entries.push_back({path, size, time});
+        total += size;
+    }
+
+    if(total <= max_size)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const auto& x, const auto& y) {
+        return x.time < y.time;
+    });
+
+    for(const auto& e : entries)
+    {
+        if(total <= max_size)
+            break;
+        if(std::filesystem::remove(e.path, ec))
+            total -= e.size;
+    }
+}
+
+std::string compiler_identity(const std::string& compiler)
+{
+    std::stringstream words(compiler);
+    std::stringstream id;
+    std::string word;
+    for(bool program = true; words >> word; program = false)
+    {
+        auto path = find_file(word, program);
+        if(path.empty())
+            continue;
+
+        // a symlink like clang++ -> clang-18 identifies the compiler by its target
+        std::error_code ec;
+        auto target = std::filesystem::canonical(path, ec);
+        auto size   = std::filesystem::file_size(path, ec);
+        auto time   = std::filesystem::last_write_time(path, ec);
+        if(ec)
+            continue;
+
+        id << target.string() << ':' << size << ':' << time.time_since_epoch().count() << ';';
+    }
+    return id.str();
+}
+
+std::string compile_key(const std::string& compiler,
+                        const std::string& command,
+                        const std::string& arch,
+                        const std::vector<src_file>& srcs)
+{
+    content_hash sources;
+    content_hash headers;
+    for(const auto& src : srcs)
+    {
+        auto& h = src.path.extension().string() == ".cpp" ? sources : headers;
+        h.add(src.path.string());
+        h.add(src.content);
+    }
+
+    content_hash key;
+    key.add(compiler_identity(compiler));
+    key.add(command);
+    key.add(arch);
+    key.add(headers.str());
+    key.add(sources.str());
+    return key.str();
+}
+
+std::string sources_key(const std::vector<src_file>& srcs)
+{
+    std::vector<const src_file*> sorted;
+    for(const auto& src : srcs)
+        sorted.push_back(&src);
+    std::sort(sorted.begin(), sorted.end(), [](auto x, auto y) { return x->path < y->path; });
+
+    content_hash key;
+    for(const auto* src : sorted)
+    {
+        key.add(src->path.string());
+        key.add(src->content);
+    }
+    return key.str();
+}
+
+} // namespace rtc
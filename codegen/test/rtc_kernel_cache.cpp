@@ -0,0 +1,143 @@
+#include <rtc/compile_kernel.hpp>
+#include <rtc/kernel_cache.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <fake_compiler.hpp>
+#include <test.hpp>
+
+static std::string to_string(const std::vector<char>& obj) { return {obj.begin(), obj.end()}; }
+
+static std::vector<rtc::src_file> make_srcs(const std::string& main, const std::string& header)
+{
+    // src_file only refers to its content
+    static std::vector<std::unique_ptr<std::string>> contents;
+    contents.push_back(std::make_unique<std::string>(main));
+    contents.push_back(std::make_unique<std::string>(header));
+    return {{"ck/header.hpp", *contents[contents.size() - 1]},
+            {"main.cpp", *contents[contents.size() - 2]}};
+}
+
+TEST_CASE(cache_hit)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    rtc::kernel_cache cache{cache_dir.path};
+
+    auto srcs = make_srcs("int f();\n", "#pragma once\n");
+    auto obj1 = rtc::compile_code_object(srcs, fc.options(), cache);
+    auto obj2 = rtc::compile_code_object(srcs, fc.options(), cache);
+
+    EXPECT(to_string(obj1) == "--offload-arch=gfx000\nint f();\n");
+    EXPECT(obj1 == obj2);
+    EXPECT(fc.count() == 1);
+}
+
+TEST_CASE(cache_key)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    rtc::kernel_cache cache{cache_dir.path};
+
+    rtc::compile_code_object(make_srcs("int f();\n", "#pragma once\n"), fc.options(), cache);
+    EXPECT(fc.count() == 1);
+
+    // a different source, header, architecture or flags is a miss
+    rtc::compile_code_object(make_srcs("int g();\n", "#pragma once\n"), fc.options(), cache);
+    EXPECT(fc.count() == 2);
+    rtc::compile_code_object(make_srcs("int f();\n", "#define X\n"), fc.options(), cache);
+    EXPECT(fc.count() == 3);
+    auto obj = rtc::compile_code_object(
+        make_srcs("int f();\n", "#pragma once\n"), fc.options("gfx001"), cache);
+    EXPECT(to_string(obj) == "--offload-arch=gfx001\nint f();\n");
+    EXPECT(fc.count() == 4);
+    auto options = fc.options();
+    options.flags += " -DX";
+    rtc::compile_code_object(make_srcs("int f();\n", "#pragma once\n"), options, cache);
+    EXPECT(fc.count() == 5);
+
+    rtc::compile_code_object(make_srcs("int f();\n", "#pragma once\n"), fc.options(), cache);
+    EXPECT(fc.count() == 5);
+}
+
+TEST_CASE(cache_compiler_update)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    rtc::kernel_cache cache{cache_dir.path};
+
+    auto srcs = make_srcs("int f();\n", "#pragma once\n");
+    rtc::compile_code_object(srcs, fc.options(), cache);
+    EXPECT(fc.count() == 1);
+
+    // the same command line with another compiler behind it is a miss
+    fc.write("2.0");
+    rtc::compile_code_object(srcs, fc.options(), cache);
+    EXPECT(fc.count() == 2);
+    rtc::compile_code_object(srcs, fc.options(), cache);
+    EXPECT(fc.count() == 2);
+}
+
+TEST_CASE(cache_disabled)
+{
+    fake_compiler fc;
+    rtc::kernel_cache cache{};
+
+    auto srcs = make_srcs("int f();\n", "#pragma once\n");
+    rtc::compile_code_object(srcs, fc.options(), cache);
+    rtc::compile_code_object(srcs, fc.options(), cache);
+    EXPECT(fc.count() == 2);
+}
+
+TEST_CASE(cache_lru)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    // every code object below is 32 bytes, three of them fit
+    rtc::kernel_cache cache{cache_dir.path, 100};
+
+    auto src = [](char c) { return make_srcs(std::string(9, c) + "\n", ""); };
+    auto obj = [](char c) { return "--offload-arch=gfx000\n" + std::string(9, c) + "\n"; };
+
+    for(char c : {'a', 'b', 'c'})
+        EXPECT(to_string(rtc::compile_code_object(src(c), fc.options(), cache)) == obj(c));
+    EXPECT(fc.count() == 3);
+
+    // make 'a' the most recently used entry, so adding 'd' evicts 'b'
+    rtc::compile_code_object(src('a'), fc.options(), cache);
+    rtc::compile_code_object(src('d'), fc.options(), cache);
+    EXPECT(fc.count() == 4);
+
+    rtc::compile_code_object(src('a'), fc.options(), cache);
+    rtc::compile_code_object(src('c'), fc.options(), cache);
+    rtc::compile_code_object(src('d'), fc.options(), cache);
+    EXPECT(fc.count() == 4);
+    rtc::compile_code_object(src('b'), fc.options(), cache);
+    EXPECT(fc.count() == 5);
+}
+
+TEST_CASE(batch_compile)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    rtc::kernel_cache cache{cache_dir.path};
+
+    std::vector<std::vector<rtc::src_file>> srcs;
+    for(int i = 0; i < 16; ++i)
+        srcs.push_back(make_srcs("int f" + std::to_string(i) + "();\n", "#pragma once\n"));
+
+    auto objs = rtc::compile_code_objects(srcs, fc.options(), 4, cache);
+    EXPECT(objs.size() == srcs.size());
+    for(std::size_t i = 0; i < objs.size(); ++i)
+        EXPECT(to_string(objs[i]) ==
+               "--offload-arch=gfx000\nint f" + std::to_string(i) + "();\n");
+    EXPECT(fc.count() == 16);
+
+    EXPECT(rtc::compile_code_objects(srcs, fc.options(), 4, cache) == objs);
+    EXPECT(fc.count() == 16);
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
@@ -0,0 +1,94 @@
+#include <rtc/compile_kernel.hpp>
+#include <rtc/kernel_cache.hpp>
+#include <rtc/tmp_dir.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <fake_compiler.hpp>
+#include <test.hpp>
+
+static std::string read_file(const std::filesystem::path& path)
+{
+    std::ifstream is(path);
+    return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+}
+
+// headers unique to this run, so directories left by earlier runs are not picked up
+struct test_headers
+{
+    std::string header = "// " + rtc::unique_string("header") + "\n";
+    std::string other  = "#pragma once\n";
+
+    std::vector<rtc::src_file> get() const
+    {
+        return {{"ck/header.hpp", header}, {"ck/other/other.hpp", other}};
+    }
+};
+
+TEST_CASE(writes_headers)
+{
+    test_headers hs;
+    auto dir = rtc::shared_include_dir(hs.get());
+
+    EXPECT(read_file(dir / "ck/header.hpp") == hs.header);
+    EXPECT(read_file(dir / "ck/other/other.hpp") == hs.other);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE(reuses_dir)
+{
+    test_headers hs;
+    auto dir = rtc::shared_include_dir(hs.get());
+    std::ofstream(dir / "marker") << "x";
+
+    // the order of the headers does not matter and the existing directory is kept
+    auto reversed = hs.get();
+    std::reverse(reversed.begin(), reversed.end());
+    EXPECT(rtc::shared_include_dir(reversed) == dir);
+    EXPECT(std::filesystem::exists(dir / "marker"));
+
+    // any change of a path or a content is a new directory
+    auto renamed    = hs.get();
+    renamed[1].path = "ck/other/renamed.hpp";
+    auto other      = hs;
+    other.other     = "#define X\n";
+
+    auto renamed_dir = rtc::shared_include_dir(renamed);
+    auto other_dir   = rtc::shared_include_dir(other.get());
+    EXPECT(renamed_dir != dir);
+    EXPECT(other_dir != dir);
+    EXPECT(renamed_dir != other_dir);
+
+    for(const auto& d : {dir, renamed_dir, other_dir})
+        std::filesystem::remove_all(d);
+}
+
+TEST_CASE(compile_with_include_dir)
+{
+    fake_compiler fc;
+    rtc::tmp_dir cache_dir{"cache"};
+    rtc::kernel_cache cache{cache_dir.path};
+
+    test_headers hs;
+    auto dir  = rtc::shared_include_dir(hs.get());
+    auto main = std::string{"int f();\n"};
+    std::vector<rtc::src_file> srcs{{"main.cpp", main}};
+
+    auto obj = rtc::compile_code_object(srcs, fc.options("gfx000", {dir}), cache);
+    EXPECT(std::string(obj.begin(), obj.end()) == "--offload-arch=gfx000\n" + hs.header + main);
+    rtc::compile_code_object(srcs, fc.options("gfx000", {dir}), cache);
+    EXPECT(fc.count() == 1);
+
+    // the include directory is part of the key
+    test_headers other;
+    auto other_dir = rtc::shared_include_dir(other.get());
+    obj            = rtc::compile_code_object(srcs, fc.options("gfx000", {other_dir}), cache);
+    EXPECT(std::string(obj.begin(), obj.end()) == "--offload-arch=gfx000\n" + other.header + main);
+    EXPECT(fc.count() == 2);
+
+    std::filesystem::remove_all(dir);
+    std::filesystem::remove_all(other_dir);
+}
+
+int main(int argc, const char* argv[]) { test::run(argc, argv); }
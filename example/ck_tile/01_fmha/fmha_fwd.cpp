@@ -613,70 +613,99 @@ bool run(const ck_tile::ArgParser& arg_parser)
                  : (seqlen_kpads[0] < 0 ? seqstart_k_host[wb] : seqstart_k_with_padding_host[wb]));
 
         const auto v_host_ref_lengths =
-            std::array<ck_tile::index_t, 3>{nhead, hdim_v, real_seqlen_k};
+            std::array<ck_tile::index_t, 3>{nhead_k, hdim_v, real_seqlen_k};
         const auto v_host_ref_strides =
             is_v_rowmajor
                 ? std::array<ck_tile::index_t, 3>{hdim_v * real_seqlen_k, 1, hdim_v}
                 : std::array<ck_tile::index_t, 3>{hdim_v * real_seqlen_k, real_seqlen_k, 1};
 
+        // k/v keep nhead_k heads, reference_fmha_fwd maps query heads onto them
         ck_tile::HostTensor<QDataType> q_host_ref({nhead, real_seqlen_q, hdim_q});
-        ck_tile::HostTensor<KDataType> k_host_ref({nhead, real_seqlen_k, hdim_q});
+        ck_tile::HostTensor<KDataType> k_host_ref({nhead_k, real_seqlen_k, hdim_q});
         ck_tile::HostTensor<VDataType> v_host_ref(v_host_ref_lengths, v_host_ref_strides);
         ck_tile::HostTensor<ODataType> o_host_ref({nhead, real_seqlen_q, hdim_v});
 
-        ck_tile::HostTensor<SMPLComputeDataType> s_host_ref({nhead, real_seqlen_q, real_seqlen_k});
-        ck_tile::HostTensor<PDataType> p_host_ref({nhead, real_seqlen_q, real_seqlen_k});
         ck_tile::HostTensor<SMPLComputeDataType> lse_host_ref({nhead, real_seqlen_q});
 
-        ck_tile::index_t nr = nhead / nhead_k;
-
         // clang-format off
         // permute
         if(i_perm) q_host_ref.ForEach([&](auto& self, auto i) { self(i) = q_host(b, i[0], i[1] + query_offset, i[2]); });
         else       q_host_ref.ForEach([&](auto& self, auto i) { self(i) = q_host(b, i[1] + query_offset, i[0], i[2]); });
 
-        if(i_perm) k_host_ref.ForEach([&](auto& self, auto i) { self(i) = k_host(b, i[0] / nr, i[1] + key_offset, i[2]); });
-        else       k_host_ref.ForEach([&](auto& self, auto i) { self(i) = k_host(b, i[1] + key_offset, i[0] / nr, i[2]); });
+        if(i_perm) k_host_ref.ForEach([&](auto& self, auto i) { self(i) = k_host(b, i[0], i[1] + key_offset, i[2]); });
+        else       k_host_ref.ForEach([&](auto& self, auto i) { self(i) = k_host(b, i[1] + key_offset, i[0], i[2]); });
 
         if (is_v_rowmajor) {
-            //                                                             v_host_ref: [nhead, hdim, seq], v_host: [b, h_k, s, d]
-            if(i_perm) v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[0] / nr, i[2] + key_offset, i[1]); });
-            //                                                             v_host_ref: [nhead, hdim, seq], v_host: [b, s, h_k, d]
-            else       v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[2] + key_offset, i[0] / nr, i[1]); });
+            //                                                             v_host_ref: [nhead_k, hdim, seq], v_host: [b, h_k, s, d]
+            if(i_perm) v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[0], i[2] + key_offset, i[1]); });
+            //                                                             v_host_ref: [nhead_k, hdim, seq], v_host: [b, s, h_k, d]
+            else       v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[2] + key_offset, i[0], i[1]); });
         }
         else {
-            if(i_perm) v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[0] / nr, i[1], i[2] + key_offset); });
-            else       v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[1], i[0] / nr, i[2] + key_offset); });
+            if(i_perm) v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[0], i[1], i[2] + key_offset); });
+            else       v_host_ref.ForEach([&](auto& self, auto i) { self(i) = v_host(b, i[1], i[0], i[2] + key_offset); });
         }
         // clang-format on
 
-        // reference
-        ck_tile::reference_batched_gemm<QDataType, KDataType, SaccDataType, SMPLComputeDataType>(
-            q_host_ref,
-            k_host_ref,
-            s_host_ref,
-            ck_tile::identity{},
-            ck_tile::identity{},
-            ck_tile::scales(scale_s));
+        // reference, streams over the keys instead of materializing the
+        // [nhead, real_seqlen_q, real_seqlen_k] score and probability tensors
+        auto lse_host_ref_opt = lse ? std::make_optional(std::ref(lse_host_ref)) : std::nullopt;
+
+        auto run_reference = [&](const auto& bias_op) {
+            auto run = [&](const auto& mask_ref) {
+                ck_tile::reference_fmha_fwd<SaccDataType,
+                                            SMPLComputeDataType,
+                                            PDataType,
+                                            OaccDataType>(
+                    q_host_ref,
+                    k_host_ref,
+                    v_host_ref,
+                    o_host_ref,
+                    mask_ref,
+                    bias_op,
+                    ck_tile::scales(scale_s),
+                    p_compute_element_func,
+                    oacc_element_func,
+                    lse_host_ref_opt);
+            };
+
+            if(mask.type == mask_enum::no_mask)
+            {
+                run(FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k});
+            }
+            else if(mask.type == mask_enum::window_generic)
+            {
+                run(ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                    mask.left, mask.right, real_seqlen_q, real_seqlen_k));
+            }
+            else
+            {
+                // if left window size is negative, means causal
+                // else means generic (for current batch)
+                if(mask.left < 0)
+                    run(ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left));
+                else
+                    run(ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
+                        mask.left,
+                        mask.right,
+                        real_seqlen_q,
+                        real_seqlen_k,
+                        mask.type == mask_enum::mask_top_left));
+            }
+        };
 
         if(bias.type == bias_enum::elementwise_bias)
         {
-            // elementwise bias
-            ck_tile::HostTensor<BiasDataType> bias_host_ref({1, real_seqlen_q, real_seqlen_k});
-            // clang-format off
-            if(i_perm)
-                bias_host_ref.ForEach([&](auto& self, auto i) { self(i) = bias_host(0, 0, i[1] + query_offset, i[2] + key_offset); });
-            else
-                bias_host_ref.ForEach([&](auto& self, auto i) { self(i) = bias_host(0, i[1] + query_offset, 0, i[2] + key_offset); });
-            // clang-format on
-
-            // broadcast from [1, real_seqlen_q, real_seqlen_k] to [nhead, real_seqlen_q,
-            // real_seqlen_k]
-            ck_tile::reference_batched_elementwise<SMPLComputeDataType,
-                                                   BiasDataType,
-                                                   SMPLComputeDataType,
-                                                   SMPLComputeDataType>(
-                s_host_ref, bias_host_ref, s_host_ref);
+            // elementwise bias, broadcast from [1, 1, seqlen_q, seqlen_k]
+            run_reference([&](ck_tile::index_t, ck_tile::index_t i_m, ck_tile::index_t i_n) {
+                return i_perm ? bias_host(0, 0, i_m + query_offset, i_n + key_offset)
+                              : bias_host(0, i_m + query_offset, 0, i_n + key_offset);
+            });
         }
         else if(bias.type == bias_enum::alibi)
         {
@@ -699,86 +728,27 @@ bool run(const ck_tile::ArgParser& arg_parser)
                 }
             }();
 
-            ck_tile::HostTensor<SaccDataType> alibi_bias_host_ref(
-                {nhead, real_seqlen_q, real_seqlen_k});
+            std::vector<decltype(alibi_host)> alibi_heads(nhead, alibi_host);
             auto i_b_slope = bias.rank_info == 0 ? 0 : wb;
             for(auto i_h = 0; i_h < nhead; i_h++)
             {
                 SaccDataType current_slope = alibi_slope_host(i_b_slope, i_h);
-                alibi_host.slope = alibi_host.mode == ck_tile::AlibiMode::VERTICAL ? current_slope
-                                                                                   : -current_slope;
-                for(auto i_r = 0; i_r < real_seqlen_q; i_r++)
-                {
-                    for(auto i_c = 0; i_c < real_seqlen_k; i_c++)
-                    {
-                        SaccDataType pixel = 0;
-                        alibi_host.update(pixel, i_r, i_c);
-                        alibi_bias_host_ref(i_h, i_r, i_c) = pixel;
-                    }
-                }
+                alibi_heads[i_h].slope =
+                    alibi_host.mode == ck_tile::AlibiMode::VERTICAL ? current_slope : -current_slope;
             }
-            // [nhead, real_seqlen_q, real_seqlen_k]
-            ck_tile::reference_batched_elementwise<SMPLComputeDataType,
-                                                   SaccDataType,
-                                                   SMPLComputeDataType,
-                                                   SMPLComputeDataType>(
-                s_host_ref, alibi_bias_host_ref, s_host_ref);
-        }
 
-        if(mask.type == mask_enum::no_mask)
-        {
-            ck_tile::reference_batched_masking<SaccDataType>(
-                s_host_ref, FmhaMasks::NoMask{real_seqlen_q, real_seqlen_k});
-        }
-        else if(mask.type == mask_enum::window_generic)
-        {
-            ck_tile::reference_batched_masking<SaccDataType>(
-                s_host_ref,
-                ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                    mask.left, mask.right, real_seqlen_q, real_seqlen_k));
-        }
-        else
-        {
-            // if left window size is negative, means causal
-            // else means generic (for current batch)
-            if(mask.left < 0)
-                ck_tile::reference_batched_masking<SaccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::CausalMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-            else
-                ck_tile::reference_batched_masking<SaccDataType>(
-                    s_host_ref,
-                    ck_tile::make_generic_attention_mask_from_lr_window<FmhaMasks::GenericMask>(
-                        mask.left,
-                        mask.right,
-                        real_seqlen_q,
-                        real_seqlen_k,
-                        mask.type == mask_enum::mask_top_left));
-        }
-        if(lse)
-        {
-            ck_tile::reference_batched_softmax<SMPLComputeDataType, SMPLComputeDataType, PDataType>(
-                s_host_ref, p_host_ref, p_compute_element_func, lse_host_ref);
+            run_reference([&](ck_tile::index_t i_h, ck_tile::index_t i_m, ck_tile::index_t i_n) {
+                auto alibi         = alibi_heads[i_h];
+                SaccDataType pixel = 0;
+                alibi.update(pixel, i_m, i_n);
+                return pixel;
+            });
         }
         else
         {
-            ck_tile::reference_batched_softmax<SMPLComputeDataType, SMPLComputeDataType, PDataType>(
-                s_host_ref, p_host_ref, p_compute_element_func);
+            run_reference(ck_tile::reference_fmha_fwd_no_bias{});
         }
 
-        ck_tile::reference_batched_gemm<PDataType, VDataType, OaccDataType, ODataType>(
-            p_host_ref,
-            v_host_ref,
-            o_host_ref,
-            ck_tile::identity{},
-            ck_tile::identity{},
-            oacc_element_func);
-
         ck_tile::HostTensor<ODataType> o_host_result({nhead, real_seqlen_q, hdim_v});
         // clang-format off
         // permute
@@ -1,8 +1,10 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <cstddef>
+#include <new>
 #include <string>
 #include <sstream>
 
@@ -67,9 +69,41 @@ struct BaseOperator
         p_arg->p_workspace_ = p_workspace;
     }
 
+    // Bytes of storage CopyArgument needs, 0 if the operator does not implement it. Callers can
+    // keep arguments in pooled storage instead of one heap allocation per MakeArgumentPointer.
+    virtual std::size_t GetArgumentSize() const { return 0; }
+
+    // Copy-constructs an argument made by this operator in p_storage, which holds at least
+    // GetArgumentSize() bytes aligned to alignof(std::max_align_t). The copy is destroyed with
+    // ~BaseArgument() by the caller. Returns nullptr if not implemented.
+    virtual BaseArgument* CopyArgument(const BaseArgument*, void*) const { return nullptr; }
+
+    // Points an argument made by this operator at other buffers, keeping its tensor descriptors.
+    // The pointers come in the order MakeArgumentPointer takes them, outputs included. Returns
+    // false, leaving the argument unchanged, if not implemented or the argument or the number of
+    // pointers does not match.
+    virtual bool UpdateArgumentPointers(BaseArgument*, const void* const*, std::size_t) const
+    {
+        return false;
+    }
+
     virtual ~BaseOperator() {}
 };
 
+// CopyArgument of an operator whose arguments are of type Argument
+template <typename Argument>
+BaseArgument* CopyArgumentTo(const BaseArgument* p_arg, void* p_storage)
+{
+    static_assert(alignof(Argument) <= alignof(std::max_align_t),
+                  "argument storage is aligned to std::max_align_t");
+
+    const auto* p_src = dynamic_cast<const Argument*>(p_arg);
+    if(p_src == nullptr || p_storage == nullptr)
+        return nullptr;
+
+    return new(p_storage) Argument(*p_src);
+}
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
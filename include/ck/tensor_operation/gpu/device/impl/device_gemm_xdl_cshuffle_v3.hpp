@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -697,6 +697,30 @@ struct DeviceGemm_Xdl_CShuffleV3 : public DeviceGemmV2<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    std::size_t GetArgumentSize() const override { return sizeof(Argument); }
+
+    // polymorphic
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return CopyArgumentTo<Argument>(p_arg, p_storage);
+    }
+
+    // polymorphic, the pointers are a, b and c
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<Argument*>(p_arg);
+        if(arg == nullptr || num_pointer != 3)
+            return false;
+
+        arg->p_a_grid = static_cast<const ADataType*>(p_pointers[0]);
+        arg->p_b_grid = static_cast<const BDataType*>(p_pointers[1]);
+        arg->p_c_grid = static_cast<CDataType*>(const_cast<void*>(p_pointers[2]));
+        return true;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
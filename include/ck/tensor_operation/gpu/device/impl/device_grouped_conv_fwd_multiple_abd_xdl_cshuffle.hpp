@@ -1100,6 +1100,56 @@ struct DeviceGroupedConvFwdMultipleABD_Xdl_CShuffle
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    std::size_t GetArgumentSize() const override { return sizeof(Argument); }
+
+    // polymorphic
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return CopyArgumentTo<Argument>(p_arg, p_storage);
+    }
+
+    // polymorphic, the pointers are the As, the Bs, the Ds and e
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<Argument*>(p_arg);
+        if(arg == nullptr ||
+           num_pointer != static_cast<std::size_t>(NumATensor + NumBTensor + NumDTensor + 1))
+            return false;
+
+        // A and B are tuples of pointers if either is multiple, see Argument
+        if constexpr(isMultiA || isMultiB)
+        {
+            static_for<0, NumATensor, 1>{}([&](auto i) {
+                using DataType = remove_cvref_t<tuple_element_t<i.value, GemmADataType>>;
+
+                arg->p_as_grid_(i) = static_cast<const DataType*>(p_pointers[i.value]);
+            });
+            static_for<0, NumBTensor, 1>{}([&](auto i) {
+                using DataType = remove_cvref_t<tuple_element_t<i.value, GemmBDataType>>;
+
+                arg->p_bs_grid_(i) = static_cast<const DataType*>(p_pointers[NumATensor + i.value]);
+            });
+        }
+        else
+        {
+            arg->p_as_grid_(I0) = static_cast<const ADataType*>(p_pointers[0]);
+            arg->p_bs_grid_(I0) = static_cast<const BDataType*>(p_pointers[1]);
+        }
+        static_for<0, NumDTensor, 1>{}([&](auto i) {
+            using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+            arg->p_ds_grid_(i) =
+                static_cast<const DDataType*>(p_pointers[NumATensor + NumBTensor + i.value]);
+        });
+        arg->p_e_grid_ = static_cast<EDataType*>(
+            const_cast<void*>(p_pointers[NumATensor + NumBTensor + NumDTensor]));
+
+        return true;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -1,6 +1,6 @@
 #pragma once
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -686,6 +686,58 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    std::size_t GetArgumentSize() const override { return sizeof(Argument); }
+
+    // polymorphic, the copy allocates the per group kernel arguments
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return CopyArgumentTo<Argument>(p_arg, p_storage);
+    }
+
+    // polymorphic, the pointers are the As, the Bs, the Ds (NumDTensor per group) and the Es of
+    // all groups. They reach the device with the kernel arguments copied by the next Run.
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<Argument*>(p_arg);
+        if(arg == nullptr)
+            return false;
+
+        const auto group_count   = static_cast<std::size_t>(arg->group_count_);
+        const auto skipped_count = static_cast<std::size_t>(arg->skipped_group_count_);
+        if(num_pointer != group_count * (3 + NumDTensor) ||
+           arg->gemm_desc_kernel_arg_.size() + skipped_count != group_count)
+            return false;
+
+        const auto* p_as = p_pointers;
+        const auto* p_bs = p_as + group_count;
+        const auto* p_ds = p_bs + group_count;
+        const auto* p_es = p_ds + group_count * NumDTensor;
+
+        // groups with M == 0 have no kernel argument
+        std::size_t k = 0;
+        for(std::size_t i = 0; i < group_count; ++i)
+        {
+            if(arg->a_mtx_mraw_kraw_[i][I0] == 0)
+                continue;
+
+            auto& karg = arg->gemm_desc_kernel_arg_[k++];
+
+            karg.a_ptr_ = static_cast<const ADataType*>(p_as[i]);
+            karg.b_ptr_ = static_cast<const BDataType*>(p_bs[i]);
+            static_for<0, NumDTensor, 1>{}([&](auto j) {
+                using DDataType = remove_cvref_t<tuple_element_t<j.value, DsDataType>>;
+
+                karg.ds_ptr_(j) = static_cast<const DDataType*>(p_ds[i * NumDTensor + j.value]);
+            });
+            karg.e_ptr_ = static_cast<EDataType*>(const_cast<void*>(p_es[i]));
+        }
+
+        return true;
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck_tile/core.hpp"
+#include "ck_tile/host/host_tensor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ck_tile {
+
+// bias added to S = Q * K^T, none by default
+struct reference_fmha_fwd_no_bias
+{
+    CK_TILE_HOST float operator()(index_t, index_t, index_t) const { return 0.f; }
+};
+
+// Attention forward of one batch (or one sequence in group mode) without materializing
+// S = Q * K^T or P = softmax(S), gives the same result as reference_batched_gemm ->
+// reference_batched_elementwise (bias) -> reference_batched_masking -> reference_batched_softmax
+// -> reference_batched_gemm.
+//
+// q: [nhead, seqlen_q, hdim_q], k: [nhead_k, seqlen_k, hdim_q], v: [nhead_k, hdim_v, seqlen_k],
+// o: [nhead, seqlen_q, hdim_v], lse: [nhead, seqlen_q]. Query head i_h reads key/value head
+// i_h / (nhead / nhead_k) (MQA/GQA).
+//
+// Work is split into nhead x ceil(seqlen_q / kQTile) tasks. A task walks the keys in tiles of
+// kKTile twice: the first pass keeps the running max and exp-sum of each row (online softmax), the
+// second recomputes S, normalizes P exactly like reference_batched_softmax, converts it to
+// PDataType and accumulates P * V. Memory beyond the inputs is O(kQTile * (kKTile + hdim_v)) per
+// task.
+//
+// s_acc_element_op is applied to the accumulated Q * K^T (e.g. scale_s), bias_op(i_h, i_m, i_n)
+// returns the bias or alibi value of an element, mask.IsOutOfBound(i_m, i_n) masks it out,
+// p_element_op is applied to the normalized P and o_acc_element_op to the accumulated O (fp8
+// static quantization scales).
+template <typename SaccDataType,
+          typename SMPLComputeDataType,
+          typename PDataType,
+          typename OaccDataType,
+          typename QDataType,
+          typename KDataType,
+          typename VDataType,
+          typename ODataType,
+          typename MaskingType,
+          typename BiasOp        = reference_fmha_fwd_no_bias,
+          typename SAccElementOp = ck_tile::identity,
+          typename PElementOp    = ck_tile::identity,
+          typename OAccElementOp = ck_tile::identity,
+          index_t kQTile         = 32,
+          index_t kKTile         = 128>
+CK_TILE_HOST void reference_fmha_fwd(
+    const HostTensor<QDataType>& q_h_m_k,
+    const HostTensor<KDataType>& k_h_n_k,
+    const HostTensor<VDataType>& v_h_o_n,
+    HostTensor<ODataType>& o_h_m_o,
+    const MaskingType& mask,
+    const BiasOp& bias_op                                                          = {},
+    const SAccElementOp& s_acc_element_op                                          = {},
+    const PElementOp& p_element_op                                                 = {},
+    const OAccElementOp& o_acc_element_op                                          = {},
+    std::optional<std::reference_wrapper<HostTensor<SMPLComputeDataType>>> lse_h_m = std::nullopt)
+{
+    constexpr bool kHasBias = !std::is_same_v<BiasOp, reference_fmha_fwd_no_bias>;
+
+    const index_t nhead    = q_h_m_k.mDesc.get_lengths()[0];
+    const index_t seqlen_q = q_h_m_k.mDesc.get_lengths()[1];
+    const index_t hdim_q   = q_h_m_k.mDesc.get_lengths()[2];
+    const index_t nhead_k  = k_h_n_k.mDesc.get_lengths()[0];
+    const index_t seqlen_k = k_h_n_k.mDesc.get_lengths()[1];
+    const index_t hdim_v   = v_h_o_n.mDesc.get_lengths()[1];
+
+    const index_t nhead_ratio = nhead / nhead_k;
+    const index_t num_q_tile  = integer_divide_ceil(seqlen_q, kQTile);
+
+    const SMPLComputeDataType neg_inf = -ck_tile::numeric<SMPLComputeDataType>::infinity();
+
+    auto f = [&](auto i_h_, auto i_tile_) {
+        const index_t i_h     = i_h_;
+        const index_t i_h_k   = i_h / nhead_ratio;
+        const index_t m_begin = static_cast<index_t>(i_tile_) * kQTile;
+        const index_t num_row = std::min(kQTile, seqlen_q - m_begin);
+
+        std::vector<SMPLComputeDataType> s(kQTile * kKTile);
+        std::vector<SMPLComputeDataType> row_max(num_row, neg_inf);
+        std::vector<SMPLComputeDataType> row_sum(num_row, 0);
+        std::vector<OaccDataType> o_acc(num_row * hdim_v, 0);
+
+        // masked out elements of S are -inf, like after reference_batched_masking
+        auto compute_s = [&](index_t n_begin, index_t num_col) {
+            for(index_t i_row = 0; i_row < num_row; ++i_row)
+            {
+                const index_t i_m = m_begin + i_row;
+
+                for(index_t i_col = 0; i_col < num_col; ++i_col)
+                {
+                    const index_t i_n = n_begin + i_col;
+
+                    if(mask.IsOutOfBound(i_m, i_n))
+                    {
+                        s[i_row * kKTile + i_col] = neg_inf;
+                        continue;
+                    }
+
+                    SaccDataType v_acc = 0;
+                    for(index_t i_k = 0; i_k < hdim_q; ++i_k)
+                    {
+                        v_acc += ck_tile::type_convert<SaccDataType>(q_h_m_k(i_h, i_m, i_k)) *
+                                 ck_tile::type_convert<SaccDataType>(k_h_n_k(i_h_k, i_n, i_k));
+                    }
+
+                    auto v_s = ck_tile::type_convert<SMPLComputeDataType>(s_acc_element_op(v_acc));
+                    if constexpr(kHasBias)
+                    {
+                        v_s += ck_tile::type_convert<SMPLComputeDataType>(bias_op(i_h, i_m, i_n));
+                    }
+
+                    s[i_row * kKTile + i_col] = v_s;
+                }
+            }
+        };
+
+        // first pass: row max and exp-sum
+        for(index_t n_begin = 0; n_begin < seqlen_k; n_begin += kKTile)
+        {
+            const index_t num_col = std::min(kKTile, seqlen_k - n_begin);
+            compute_s(n_begin, num_col);
+
+            for(index_t i_row = 0; i_row < num_row; ++i_row)
+            {
+                const auto* s_row = &s[i_row * kKTile];
+
+                SMPLComputeDataType v_max = row_max[i_row];
+                for(index_t i_col = 0; i_col < num_col; ++i_col)
+                    v_max = v_max < s_row[i_col] ? s_row[i_col] : v_max;
+
+                // every element so far is masked out
+                if(std::isinf(v_max) && v_max < 0)
+                    continue;
+
+                SMPLComputeDataType v_sum = row_sum[i_row] * ck_tile::exp(row_max[i_row] - v_max);
+                for(index_t i_col = 0; i_col < num_col; ++i_col)
+                    v_sum += ck_tile::exp(s_row[i_col] - v_max);
+
+                row_max[i_row] = v_max;
+                row_sum[i_row] = v_sum;
+            }
+        }
+
+        std::vector<SMPLComputeDataType> inv_sum(num_row);
+        for(index_t i_row = 0; i_row < num_row; ++i_row)
+        {
+            // rows that are masked out completely, see reference_batched_softmax
+            if(std::isinf(row_max[i_row]) && row_max[i_row] < 0)
+                row_max[i_row] = ck_tile::type_convert<SMPLComputeDataType>(0.f);
+
+            inv_sum[i_row] = (row_sum[i_row] == 0.f ? 1.f : 1.f / row_sum[i_row]);
+
+            if(lse_h_m)
+                lse_h_m->get()(i_h, m_begin + i_row) =
+                    row_max[i_row] + ck_tile::log(row_sum[i_row]);
+        }
+
+        // second pass: O = P * V
+        for(index_t n_begin = 0; n_begin < seqlen_k; n_begin += kKTile)
+        {
+            const index_t num_col = std::min(kKTile, seqlen_k - n_begin);
+            compute_s(n_begin, num_col);
+
+            for(index_t i_row = 0; i_row < num_row; ++i_row)
+            {
+                const auto* s_row = &s[i_row * kKTile];
+                auto* o_row       = &o_acc[i_row * hdim_v];
+
+                for(index_t i_col = 0; i_col < num_col; ++i_col)
+                {
+                    // exp(-inf) is 0, masked out keys add nothing
+                    if(std::isinf(s_row[i_col]) && s_row[i_col] < 0)
+                        continue;
+
+                    const SMPLComputeDataType v_p =
+                        ck_tile::exp(s_row[i_col] - row_max[i_row]) * inv_sum[i_row];
+                    const auto v_p_acc = ck_tile::type_convert<OaccDataType>(
+                        ck_tile::type_convert<PDataType>(p_element_op(v_p)));
+
+                    for(index_t i_o = 0; i_o < hdim_v; ++i_o)
+                    {
+                        o_row[i_o] += v_p_acc * ck_tile::type_convert<OaccDataType>(
+                                                    v_h_o_n(i_h_k, i_o, n_begin + i_col));
+                    }
+                }
+            }
+        }
+
+        for(index_t i_row = 0; i_row < num_row; ++i_row)
+        {
+            for(index_t i_o = 0; i_o < hdim_v; ++i_o)
+            {
+                o_h_m_o(i_h, m_begin + i_row, i_o) = ck_tile::type_convert<ODataType>(
+                    o_acc_element_op(o_acc[i_row * hdim_v + i_o]));
+            }
+        }
+    };
+
+    make_ParallelTensorFunctor(f, nhead, num_q_tile)(std::thread::hardware_concurrency());
+}
+} // namespace ck_tile
@@ -1,17 +1,98 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_blocked_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
+namespace detail {
+
+// The [rows, cols] matrices of one operand of a batched GEMM: element (row, col) of batch g is at
+// batch_offsets[g] + row * row_stride + col * col_stride.
+struct BatchedGemmOperand
+{
+    std::size_t GetOffset(std::size_t g, std::size_t row, std::size_t col) const
+    {
+        return batch_offsets[g] + row * row_stride + col * col_stride;
+    }
+
+    std::vector<std::size_t> batch_offsets;
+    std::size_t row_stride;
+    std::size_t col_stride;
+};
+
+// C[g] = c_op(a_op(A[g]) * b_op(B[g])) through the cache-blocked host GEMM, with the conversion
+// chain of the reference loops: X -> op -> AccDataType, AccDataType -> op -> CDataType. The
+// macro tiles of all batches share the thread pool, so many small batches are as fast as one big
+// GEMM.
+template <typename AccDataType,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+void RunBatchedGemmBlocked(std::size_t M,
+                           std::size_t N,
+                           std::size_t K,
+                           const ADataType* p_a,
+                           const BatchedGemmOperand& a_g_m_k,
+                           const BDataType* p_b,
+                           const BatchedGemmOperand& b_g_k_n,
+                           CDataType* p_c,
+                           const BatchedGemmOperand& c_g_m_n,
+                           const AElementwiseOperation& a_element_op,
+                           const BElementwiseOperation& b_element_op,
+                           const CElementwiseOperation& c_element_op)
+{
+    auto load_a = [&](std::size_t g, std::size_t m, std::size_t k) {
+        ADataType v_a;
+        a_element_op(v_a, p_a[a_g_m_k.GetOffset(g, m, k)]);
+        return ck::type_convert<AccDataType>(v_a);
+    };
+
+    auto load_b = [&](std::size_t g, std::size_t k, std::size_t n) {
+        BDataType v_b;
+        b_element_op(v_b, p_b[b_g_k_n.GetOffset(g, k, n)]);
+        return ck::type_convert<AccDataType>(v_b);
+    };
+
+    auto store_c = [&](std::size_t g, std::size_t m, std::size_t n, AccDataType v_acc) {
+        AccDataType v_c;
+        c_element_op(v_c, v_acc);
+        p_c[c_g_m_n.GetOffset(g, m, n)] = ck::type_convert<CDataType>(v_c);
+    };
+
+    ck::utils::host_blocked_batched_gemm<AccDataType>(
+        c_g_m_n.batch_offsets.size(), M, N, K, load_a, load_b, store_c);
+}
+
+// [G0, G1, rows, cols] operand whose batch (g0, g1) is the matrix (g0, get_g1(g1))
+template <typename Strides, typename GetG1>
+BatchedGemmOperand
+MakeBatchedGemmOperand(std::size_t G0, std::size_t G1, const Strides& strides, GetG1 get_g1)
+{
+    BatchedGemmOperand operand{{}, strides[2], strides[3]};
+    operand.batch_offsets.reserve(G0 * G1);
+
+    for(std::size_t g0 = 0; g0 < G0; ++g0)
+        for(std::size_t g1 = 0; g1 < G1; ++g1)
+            operand.batch_offsets.push_back(g0 * strides[0] + get_g1(g1) * strides[1]);
+
+    return operand;
+}
+
+} // namespace detail
 
 template <typename ADataType,
           typename BDataType,
@@ -22,6 +103,8 @@ template <typename ADataType,
           typename CElementwiseOperation>
 struct ReferenceBatchedGemm : public device::BaseOperator
 {
+    static constexpr bool UseBlockedGemm = ck::utils::is_host_blocked_gemm_acc_v<AccDataType>;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -54,7 +137,35 @@ struct ReferenceBatchedGemm : public device::BaseOperator
     {
         using Argument = ReferenceBatchedGemm::Argument;
 
-        float Run(const Argument& arg)
+        static void RunBlocked(const Argument& arg)
+        {
+            const auto& c_lengths = arg.c_g_m_n_.mDesc.GetLengths();
+
+            // a [G, rows, cols] operand is a [1, G, rows, cols] one
+            auto make_operand = [&](const HostTensorDescriptor& desc) {
+                const auto& strides = desc.GetStrides();
+                return detail::MakeBatchedGemmOperand(
+                    1,
+                    c_lengths[0],
+                    std::array<std::size_t, 4>{0, strides[0], strides[1], strides[2]},
+                    [](std::size_t g) { return g; });
+            };
+
+            detail::RunBatchedGemmBlocked<AccDataType>(c_lengths[1],
+                                                       c_lengths[2],
+                                                       arg.a_g_m_k_.mDesc.GetLengths()[2],
+                                                       arg.a_g_m_k_.mData.data(),
+                                                       make_operand(arg.a_g_m_k_.mDesc),
+                                                       arg.b_g_k_n_.mData.data(),
+                                                       make_operand(arg.b_g_k_n_.mDesc),
+                                                       arg.c_g_m_n_.mData.data(),
+                                                       make_operand(arg.c_g_m_n_.mDesc),
+                                                       arg.a_element_op_,
+                                                       arg.b_element_op_,
+                                                       arg.c_element_op_);
+        }
+
+        static void RunNaive(const Argument& arg)
         {
             auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
                 const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
@@ -85,6 +196,19 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                                        arg.c_g_m_n_.mDesc.GetLengths()[1],
                                        arg.c_g_m_n_.mDesc.GetLengths()[2])(
                 std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(arg);
+            }
+            else
+            {
+                RunNaive(arg);
+            }
+
             return 0;
         }
 
@@ -142,6 +266,8 @@ template <typename ADataType,
           typename CElementwiseOperation>
 struct ReferenceBatchedGemm_MQA : public device::BaseOperator
 {
+    static constexpr bool UseBlockedGemm = ck::utils::is_host_blocked_gemm_acc_v<AccDataType>;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -174,7 +300,36 @@ struct ReferenceBatchedGemm_MQA : public device::BaseOperator
     {
         using Argument = ReferenceBatchedGemm_MQA::Argument;
 
-        float Run(const Argument& arg)
+        static void RunBlocked(const Argument& arg)
+        {
+            const auto& c_lengths = arg.c_g0_g1_m_n_.mDesc.GetLengths();
+
+            const std::size_t G0 = c_lengths[0];
+            const std::size_t G1 = c_lengths[1];
+
+            // all G1 queries share the single key of their G0
+            auto same_g1   = [](std::size_t g1) { return g1; };
+            auto shared_g1 = [](std::size_t) { return std::size_t{0}; };
+
+            detail::RunBatchedGemmBlocked<AccDataType>(
+                c_lengths[2],
+                c_lengths[3],
+                arg.a_g0_g1_m_k_.mDesc.GetLengths()[3],
+                arg.a_g0_g1_m_k_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.a_g0_g1_m_k_.mDesc.GetStrides(), same_g1),
+                arg.b_g0_1_k_n_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.b_g0_1_k_n_.mDesc.GetStrides(), shared_g1),
+                arg.c_g0_g1_m_n_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.c_g0_g1_m_n_.mDesc.GetStrides(), same_g1),
+                arg.a_element_op_,
+                arg.b_element_op_,
+                arg.c_element_op_);
+        }
+
+        static void RunNaive(const Argument& arg)
         {
             auto f_g0g1mk_g01kn_g0g1mn = [&](auto g0, auto g1, auto m, auto n) {
                 const int K = arg.a_g0_g1_m_k_.mDesc.GetLengths()[3];
@@ -206,6 +361,19 @@ struct ReferenceBatchedGemm_MQA : public device::BaseOperator
                                        arg.c_g0_g1_m_n_.mDesc.GetLengths()[2],
                                        arg.c_g0_g1_m_n_.mDesc.GetLengths()[3])(
                 std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(arg);
+            }
+            else
+            {
+                RunNaive(arg);
+            }
+
             return 0;
         }
 
@@ -265,6 +433,8 @@ template <typename ADataType,
           ck::index_t QueryGroupNumber>
 struct ReferenceBatchedGemm_GQA : public device::BaseOperator
 {
+    static constexpr bool UseBlockedGemm = ck::utils::is_host_blocked_gemm_acc_v<AccDataType>;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -297,7 +467,36 @@ struct ReferenceBatchedGemm_GQA : public device::BaseOperator
     {
         using Argument = ReferenceBatchedGemm_GQA::Argument;
 
-        float Run(const Argument& arg)
+        static void RunBlocked(const Argument& arg)
+        {
+            const auto& c_lengths = arg.c_g0_g1_m_n_.mDesc.GetLengths();
+
+            const std::size_t G0 = c_lengths[0];
+            const std::size_t G1 = c_lengths[1];
+
+            // G1 / QueryGroupNumber consecutive queries share one key
+            auto same_g1  = [](std::size_t g1) { return g1; };
+            auto group_g1 = [=](std::size_t g1) { return g1 * QueryGroupNumber / G1; };
+
+            detail::RunBatchedGemmBlocked<AccDataType>(
+                c_lengths[2],
+                c_lengths[3],
+                arg.a_g0_g1_m_k_.mDesc.GetLengths()[3],
+                arg.a_g0_g1_m_k_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.a_g0_g1_m_k_.mDesc.GetStrides(), same_g1),
+                arg.b_g0_gq_k_n_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.b_g0_gq_k_n_.mDesc.GetStrides(), group_g1),
+                arg.c_g0_g1_m_n_.mData.data(),
+                detail::MakeBatchedGemmOperand(
+                    G0, G1, arg.c_g0_g1_m_n_.mDesc.GetStrides(), same_g1),
+                arg.a_element_op_,
+                arg.b_element_op_,
+                arg.c_element_op_);
+        }
+
+        static void RunNaive(const Argument& arg)
         {
             auto f_g0g1mk_g0gqkn_g0g1mn = [&](auto g0, auto g1, auto m, auto n) {
                 const int G1 = arg.a_g0_g1_m_k_.mDesc.GetLengths()[1];
@@ -330,6 +529,19 @@ struct ReferenceBatchedGemm_GQA : public device::BaseOperator
                                        arg.c_g0_g1_m_n_.mDesc.GetLengths()[2],
                                        arg.c_g0_g1_m_n_.mDesc.GetLengths()[3])(
                 std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(arg);
+            }
+            else
+            {
+                RunNaive(arg);
+            }
+
             return 0;
         }
 
@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_blocked_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
@@ -30,6 +31,8 @@ template <ck::index_t NumDimM,
                           bool> = false>
 struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::BaseOperator
 {
+    static constexpr bool UseBlockedGemm = ck::utils::is_host_blocked_gemm_acc_v<AccDataType>;
+
     // Argument
     struct Argument : public ck::tensor_operation::device::BaseArgument
     {
@@ -59,7 +62,70 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
     {
         using Argument = ReferenceContraction_M2_N2_K2::Argument;
 
-        float Run(const Argument& arg)
+        // Folds the M, N and K dimension groups of A, B and C into single GEMM dimensions and runs
+        // the cache-blocked host GEMM on them. Accumulating the folded K in ascending order is the
+        // k0, ..., k5 order of the loop nest, so the results are bit-identical. Returns false if a
+        // group has strides that cannot be merged.
+        static bool RunFolded(const Argument& arg)
+        {
+            auto fold = [](const HostTensorDescriptor& desc,
+                           std::size_t begin,
+                           std::size_t end,
+                           ck::utils::HostGemmFoldedDimension& folded) {
+                return ck::utils::fold_host_gemm_dimensions(
+                    desc.GetLengths(), desc.GetStrides(), begin, end, folded);
+            };
+
+            const auto& a_desc = arg.a_ms_ks_.mDesc;
+            const auto& b_desc = arg.b_ns_ks_.mDesc;
+            const auto& c_desc = arg.c_ms_ns_.mDesc;
+
+            ck::utils::HostGemmFoldedDimension a_m, a_k, b_n, b_k, c_m, c_n;
+
+            if(!fold(a_desc, 0, NumDimM, a_m) || !fold(a_desc, NumDimM, NumDimM + NumDimK, a_k) ||
+               !fold(b_desc, 0, NumDimN, b_n) || !fold(b_desc, NumDimN, NumDimN + NumDimK, b_k) ||
+               !fold(c_desc, 0, NumDimM, c_m) || !fold(c_desc, NumDimM, NumDimM + NumDimN, c_n))
+            {
+                return false;
+            }
+
+            if(a_m.length != c_m.length || b_n.length != c_n.length || a_k.length != b_k.length)
+                return false;
+
+            const ADataType* p_a = arg.a_ms_ks_.mData.data();
+            const BDataType* p_b = arg.b_ns_ks_.mData.data();
+            CDataType* p_c       = arg.c_ms_ns_.mData.data();
+
+            // same conversion chain as the loop nest: X -> ComputeDataType -> AccDataType -> op
+            auto load_a = [&](std::size_t m, std::size_t k) {
+                const auto v_a_compute_input =
+                    ck::type_convert<ComputeDataType>(p_a[m * a_m.stride + k * a_k.stride]);
+
+                AccDataType v_a;
+                arg.a_element_op_(v_a, ck::type_convert<AccDataType>(v_a_compute_input));
+                return v_a;
+            };
+
+            auto load_b = [&](std::size_t k, std::size_t n) {
+                const auto v_b_compute_input =
+                    ck::type_convert<ComputeDataType>(p_b[n * b_n.stride + k * b_k.stride]);
+
+                AccDataType v_b;
+                arg.b_element_op_(v_b, ck::type_convert<AccDataType>(v_b_compute_input));
+                return v_b;
+            };
+
+            auto store_c = [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+                p_c[m * c_m.stride + n * c_n.stride] = ck::type_convert<CDataType>(v_acc);
+            };
+
+            ck::utils::host_blocked_gemm<AccDataType>(
+                c_m.length, c_n.length, a_k.length, load_a, load_b, store_c);
+
+            return true;
+        }
+
+        static void RunNaive(const Argument& arg)
         {
             auto f_ms_ns = [&](auto m0,
                                auto m1,
@@ -180,6 +246,18 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
                                            arg.c_ms_ns_.mDesc.GetLengths()[11])(
                     std::thread::hardware_concurrency());
             }
+        }
+
+        float Run(const Argument& arg)
+        {
+            // the loop nest is only needed for strides that do not fold into a GEMM
+            if constexpr(UseBlockedGemm)
+            {
+                if(RunFolded(arg))
+                    return 0;
+            }
+
+            RunNaive(arg);
 
             return 0;
         }
@@ -5,10 +5,12 @@
 
 #include <iostream>
 #include <sstream>
+#include <tuple>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -47,7 +49,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ConvReferenceAlgorithm algorithm = ConvReferenceAlgorithm::Default)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -60,7 +63,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              algorithm_{algorithm}
         {
         }
 
@@ -80,6 +84,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        ConvReferenceAlgorithm algorithm_;
     };
 
     // Invoker
@@ -96,6 +102,46 @@ struct ReferenceConvBwdData : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0)
+            {
+                if(UseConvIm2colGemm(arg.algorithm_))
+                {
+                    ConvBwdDataIm2colGemm<NDimSpatial>(
+                        arg.input_,
+                        arg.weight_,
+                        arg.output_,
+                        arg.conv_strides_,
+                        arg.conv_dilations_,
+                        arg.in_left_pads_,
+                        arg.in_right_pads_,
+                        [&](const OutDataType& x) {
+                            OutDataType v_out;
+                            arg.out_element_op_(v_out, x);
+                            return ck::type_convert<float>(v_out);
+                        },
+                        [&](const WeiDataType& x) {
+                            WeiDataType v_wei;
+                            arg.wei_element_op_(v_wei, x);
+                            return ck::type_convert<float>(v_wei);
+                        },
+                        [&](const auto& idx, float v_acc) {
+                            InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
+                            std::apply(
+                                [&](auto... is) {
+                                    ExecuteElementwiseOp(arg.in_element_op_,
+                                                         arg.elementwise_d_tensors_,
+                                                         Number<NumDElementwiseTensor>{},
+                                                         arg.input_(is...),
+                                                         v_acc_converted,
+                                                         is...);
+                                },
+                                idx);
+                        });
+
+                    return 0;
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_ncw = [&](auto g, auto n, auto c, auto wi) {
@@ -456,7 +502,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors  = {},
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors = {},
-        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ConvReferenceAlgorithm algorithm                                                    = {})
     {
         return Argument{input,
                         weight,
@@ -470,7 +517,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -5,10 +5,12 @@
 
 #include <iostream>
 #include <sstream>
+#include <tuple>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -49,7 +51,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<OutDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<InDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ConvReferenceAlgorithm algorithm = ConvReferenceAlgorithm::Default)
             : input_{in_n_c_hi_wi},
               weight_{wei_k_c_y_x},
               output_{out_n_k_ho_wo},
@@ -62,7 +65,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              algorithm_{algorithm}
         {
         }
 
@@ -82,6 +86,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        ConvReferenceAlgorithm algorithm_;
     };
 
     // Invoker
@@ -98,6 +104,46 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0)
+            {
+                if(UseConvIm2colGemm(arg.algorithm_))
+                {
+                    ConvBwdWeightIm2colGemm<NDimSpatial>(
+                        arg.input_,
+                        arg.weight_,
+                        arg.output_,
+                        arg.conv_strides_,
+                        arg.conv_dilations_,
+                        arg.in_left_pads_,
+                        arg.in_right_pads_,
+                        [&](const OutDataType& x) {
+                            ComputeTypeA v_out;
+                            arg.out_element_op_(v_out, ck::type_convert<float>(x));
+                            return ck::type_convert<float>(v_out);
+                        },
+                        [&](const InDataType& x) {
+                            ComputeTypeB v_in;
+                            arg.in_element_op_(v_in, ck::type_convert<float>(x));
+                            return ck::type_convert<float>(v_in);
+                        },
+                        [&](const auto& idx, float v_acc) {
+                            WeiDataType v_acc_converted = ck::type_convert<WeiDataType>(v_acc);
+                            std::apply(
+                                [&](auto... is) {
+                                    ExecuteElementwiseOp(arg.wei_element_op_,
+                                                         arg.elementwise_d_tensors_,
+                                                         Number<NumDElementwiseTensor>{},
+                                                         arg.weight_(is...),
+                                                         v_acc_converted,
+                                                         is...);
+                                },
+                                idx);
+                        });
+
+                    return 0;
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_kcx = [&](auto g, auto k, auto c, auto x) {
@@ -411,7 +457,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<OutDataType>, NumAElementwiseTensor>& elementwise_a_tensors = {},
         const std::array<Tensor<InDataType>, NumBElementwiseTensor>& elementwise_b_tensors  = {},
-        const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ConvReferenceAlgorithm algorithm                                                    = {})
     {
         return Argument{in_n_c_hi_wi,
                         wei_k_c_y_x,
@@ -425,7 +472,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -1,11 +1,12 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <cmath>
 #include <cstdlib>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -20,6 +21,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -78,7 +80,8 @@ struct ReferenceConvFwd : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ConvReferenceAlgorithm algorithm = ConvReferenceAlgorithm::Default)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -91,7 +94,8 @@ struct ReferenceConvFwd : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              algorithm_{algorithm}
         {
         }
 
@@ -111,6 +115,8 @@ struct ReferenceConvFwd : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        ConvReferenceAlgorithm algorithm_;
     };
 
     struct Invoker : public device::BaseInvoker
@@ -126,6 +132,46 @@ struct ReferenceConvFwd : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0)
+            {
+                if(UseConvIm2colGemm(arg.algorithm_))
+                {
+                    ConvFwdIm2colGemm<NDimSpatial>(
+                        arg.input_,
+                        arg.weight_,
+                        arg.output_,
+                        arg.conv_strides_,
+                        arg.conv_dilations_,
+                        arg.in_left_pads_,
+                        arg.in_right_pads_,
+                        [&](const InDataType& x) {
+                            InDataType v_in;
+                            arg.in_element_op_(v_in, x);
+                            return ck::type_convert<float>(v_in);
+                        },
+                        [&](const WeiDataType& x) {
+                            WeiDataType v_wei;
+                            arg.wei_element_op_(v_wei, x);
+                            return ck::type_convert<float>(v_wei);
+                        },
+                        [&](const auto& idx, float v_acc) {
+                            OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
+                            std::apply(
+                                [&](auto... is) {
+                                    ExecuteElementwiseOp(arg.out_element_op_,
+                                                         arg.elementwise_d_tensors_,
+                                                         Number<NumDElementwiseTensor>{},
+                                                         arg.output_(is...),
+                                                         v_acc_converted,
+                                                         is...);
+                                },
+                                idx);
+                        });
+
+                    return 0;
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
@@ -425,7 +471,8 @@ struct ReferenceConvFwd : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors  = {},
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors = {},
-        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ConvReferenceAlgorithm algorithm                                                    = {})
     {
         return Argument{input,
                         weight,
@@ -439,7 +486,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -0,0 +1,664 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/host_blocked_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_column_to_image.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_image_to_column.hpp"
+
+// environment variable to lower the convolution references to im2col + GEMM by default:
+// export CK_REFERENCE_CONV_IM2COL=1
+CK_DECLARE_ENV_VAR_BOOL(CK_REFERENCE_CONV_IM2COL)
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// How the reference convolutions compute their result.
+//   Direct:     nested loops over every output element and filter tap.
+//   Im2colGemm: the problem is lowered per group to ReferenceImageToColumn /
+//               ReferenceColumnToImage and a blocked host GEMM. Only used when the A and B
+//               elementwise operations take no extra tensors, otherwise Direct is used.
+//   Default:    Direct, unless CK_REFERENCE_CONV_IM2COL is enabled.
+enum struct ConvReferenceAlgorithm
+{
+    Default,
+    Direct,
+    Im2colGemm,
+};
+
+inline bool UseConvIm2colGemm(ConvReferenceAlgorithm algorithm)
+{
+    if(algorithm == ConvReferenceAlgorithm::Default)
+        return ck::EnvIsEnabled(CK_ENV(CK_REFERENCE_CONV_IM2COL));
+
+    return algorithm == ConvReferenceAlgorithm::Im2colGemm;
+}
+
+namespace detail {
+
+// type of the converted operands, the column buffer and the GEMM accumulators
+using ConvIm2colAccDataType = float;
+
+// default upper bound of the im2col buffer
+constexpr std::size_t ConvIm2colMaxColumnBytes = std::size_t{256} << 20;
+
+template <ck::index_t NDimSpatial>
+using ConvIm2colImageLayout =
+    std::conditional_t<NDimSpatial == 1,
+                       tensor_layout::convolution::GNWC,
+                       std::conditional_t<NDimSpatial == 2,
+                                          tensor_layout::convolution::GNHWC,
+                                          tensor_layout::convolution::GNDHWC>>;
+
+// Window [o_begin, o_end) of the outermost output spatial dimension together with the part
+// [i_begin, i_end) of the outermost input spatial dimension it reads and the conv pads that make
+// the im2col/col2im references produce exactly the window when given only that part of the input.
+struct ConvIm2colWindow
+{
+    std::size_t o_begin, o_end;
+    std::size_t i_begin, i_end;
+    std::vector<ck::index_t> in_left_pads, in_right_pads;
+};
+
+// Sizes of a grouped convolution in the reference [G, N, C, spatial...] / [G, K, C, filter...] /
+// [G, N, K, output spatial...] descriptors.
+template <ck::index_t NDimSpatial>
+struct ConvIm2colGemmShape
+{
+    template <typename InTensor, typename WeiTensor, typename OutTensor>
+    ConvIm2colGemmShape(const InTensor& in, const WeiTensor& wei, const OutTensor& out)
+        : G{in.GetLengths()[0]},
+          N{in.GetLengths()[1]},
+          C{in.GetLengths()[2]},
+          K{wei.GetLengths()[1]},
+          in_size{1},
+          filter_size{1},
+          out_size{1}
+    {
+        for(ck::index_t i = 0; i < NDimSpatial; ++i)
+        {
+            in_lengths[i]     = in.GetLengths()[i + 3];
+            filter_lengths[i] = wei.GetLengths()[i + 3];
+            out_lengths[i]    = out.GetLengths()[i + 3];
+
+            in_size *= in_lengths[i];
+            filter_size *= filter_lengths[i];
+            out_size *= out_lengths[i];
+        }
+    }
+
+    // Splits the batch into chunks of images, and images into windows of the outermost output
+    // spatial dimension when a single one does not fit, so that the [rows, filter_size * C]
+    // column buffer stays below max_column_bytes (or holds one output row of the outermost
+    // dimension if even that does not fit).
+    void GetChunking(std::size_t max_column_bytes,
+                     std::size_t& images_per_chunk,
+                     std::size_t& window_length) const
+    {
+        const std::size_t bytes_per_row = filter_size * C * sizeof(ConvIm2colAccDataType);
+        const std::size_t max_rows = max_column_bytes / std::max<std::size_t>(bytes_per_row, 1);
+
+        if(max_rows >= out_size)
+        {
+            images_per_chunk = std::clamp<std::size_t>(
+                max_rows / std::max<std::size_t>(out_size, 1), 1, std::max<std::size_t>(N, 1));
+            window_length = out_lengths[0];
+            return;
+        }
+
+        const std::size_t rows_per_window = out_size / out_lengths[0];
+
+        images_per_chunk = 1;
+        window_length    = std::clamp<std::size_t>(max_rows / rows_per_window, 1, out_lengths[0]);
+    }
+
+    ConvIm2colWindow GetWindow(std::size_t o_begin,
+                               std::size_t o_end,
+                               const std::vector<ck::index_t>& conv_strides,
+                               const std::vector<ck::index_t>& conv_dilations,
+                               const std::vector<ck::index_t>& in_left_pads,
+                               const std::vector<ck::index_t>& in_right_pads) const
+    {
+        const auto in_length = static_cast<ck::long_index_t>(in_lengths[0]);
+
+        // [i_first, i_last) is the input range read by the window, including padding
+        const ck::long_index_t i_first =
+            static_cast<ck::long_index_t>(o_begin) * conv_strides[0] - in_left_pads[0];
+        const ck::long_index_t i_last =
+            static_cast<ck::long_index_t>(o_end - 1) * conv_strides[0] +
+            static_cast<ck::long_index_t>(filter_lengths[0] - 1) * conv_dilations[0] -
+            in_left_pads[0] + 1;
+
+        const ck::long_index_t i_begin = std::clamp<ck::long_index_t>(i_first, 0, in_length);
+        const ck::long_index_t i_end   = std::clamp<ck::long_index_t>(i_last, i_begin, in_length);
+
+        ConvIm2colWindow window{o_begin,
+                                o_end,
+                                static_cast<std::size_t>(i_begin),
+                                static_cast<std::size_t>(i_end),
+                                in_left_pads,
+                                in_right_pads};
+
+        window.in_left_pads[0]  = static_cast<ck::index_t>(i_begin - i_first);
+        window.in_right_pads[0] = static_cast<ck::index_t>(i_last - i_end);
+
+        return window;
+    }
+
+    // lengths of the spatial descriptor dims as index_t for the im2col/col2im references
+    std::vector<ck::index_t> GetFilterLengths() const
+    {
+        return std::vector<ck::index_t>(filter_lengths.begin(), filter_lengths.end());
+    }
+
+    std::size_t G, N, C, K;
+    std::array<std::size_t, NDimSpatial> in_lengths, filter_lengths, out_lengths;
+    std::size_t in_size, filter_size, out_size;
+};
+
+// Packs x(g, d1_begin + i1, i2, d3_begin + i3, ...) of a [G, D1, D2, spatial...] tensor into the
+// packed [1, d1, D2, d3, ...] tensor y, passing every element through convert.
+template <typename T, typename Convert>
+void ConvIm2colCopySlice(const Tensor<T>& x,
+                         Tensor<ConvIm2colAccDataType>& y,
+                         std::size_t g,
+                         std::size_t d1_begin,
+                         std::size_t d3_begin,
+                         Convert convert)
+{
+    const auto& y_lengths  = y.GetLengths();
+    const auto& x_strides  = x.GetStrides();
+    const std::size_t base = g * x_strides[0] + d1_begin * x_strides[1] + d3_begin * x_strides[3];
+
+    utils::HostThreadPool::GetInstance().ParallelFor(
+        y.GetElementSize(),
+        std::thread::hardware_concurrency(),
+        [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                std::size_t rest   = i;
+                std::size_t offset = base;
+
+                for(std::size_t d = y_lengths.size() - 1; d > 0; --d)
+                {
+                    offset += rest % y_lengths[d] * x_strides[d];
+                    rest /= y_lengths[d];
+                }
+
+                y.mData[i] = convert(x.mData[offset]);
+            }
+        });
+}
+
+// Adds the packed [1, D1, D2, d3, ...] tensor x onto y(0, i1, i2, d3_begin + i3, ...) of the packed
+// [1, D1, D2, D3, ...] tensor y.
+inline void ConvIm2colAddSlice(const Tensor<ConvIm2colAccDataType>& x,
+                               Tensor<ConvIm2colAccDataType>& y,
+                               std::size_t d3_begin)
+{
+    const auto& x_lengths  = x.GetLengths();
+    const auto& y_strides  = y.GetStrides();
+    const std::size_t base = d3_begin * y_strides[3];
+
+    utils::HostThreadPool::GetInstance().ParallelFor(
+        x.GetElementSize(),
+        std::thread::hardware_concurrency(),
+        [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                std::size_t rest   = i;
+                std::size_t offset = base;
+
+                for(std::size_t d = x_lengths.size() - 1; d > 0; --d)
+                {
+                    offset += rest % x_lengths[d] * y_strides[d];
+                    rest /= x_lengths[d];
+                }
+
+                y.mData[offset] += x.mData[i];
+            }
+        });
+}
+
+// Calls f(idx) for every index of a [1, D1, D2, spatial...] packed tensor, with the first two
+// entries of idx replaced by g and d1_begin + i.
+template <ck::index_t NDimSpatial, typename F>
+void ConvIm2colForEachSliceIndex(const Tensor<ConvIm2colAccDataType>& y,
+                                 std::size_t g,
+                                 std::size_t d1_begin,
+                                 F f)
+{
+    const auto& y_lengths = y.GetLengths();
+
+    utils::HostThreadPool::GetInstance().ParallelFor(
+        y.GetElementSize(),
+        std::thread::hardware_concurrency(),
+        [&](std::size_t begin, std::size_t end) {
+            std::array<std::size_t, NDimSpatial + 3> idx;
+
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                std::size_t rest = i;
+
+                for(std::size_t d = NDimSpatial + 2; d > 0; --d)
+                {
+                    idx[d] = rest % y_lengths[d];
+                    rest /= y_lengths[d];
+                }
+
+                idx[0] = g;
+                idx[1] += d1_begin;
+
+                f(idx, i);
+            }
+        });
+}
+
+} // namespace detail
+
+// Forward convolution as im2col + GEMM.
+//   out(g, n, k, o) = sum_c sum_f in(g, n, c, o * s + f * d - p) * wei(g, k, c, f)
+// For every group and chunk of images (or window of output rows of one image, see GetChunking)
+// the converted input is unfolded by ReferenceImageToColumn into a [rows = n * o, f * C + c]
+// buffer and multiplied with the [K, C * f] weights. The GEMM reduction runs over (c, f) in the
+// same order as the direct loops, so the accumulators match the direct reference for finite
+// inputs.
+//   in_to_acc(x) / wei_to_acc(x) return the element-op'ed operand as ConvIm2colAccDataType.
+//   store_out(idx, acc) receives the accumulator of output [g, n, k, o...] exactly once.
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InToAcc,
+          typename WeiToAcc,
+          typename StoreOut>
+void ConvFwdIm2colGemm(const Tensor<InDataType>& input,
+                       const Tensor<WeiDataType>& weight,
+                       const Tensor<OutDataType>& output,
+                       const std::vector<ck::index_t>& conv_strides,
+                       const std::vector<ck::index_t>& conv_dilations,
+                       const std::vector<ck::index_t>& in_left_pads,
+                       const std::vector<ck::index_t>& in_right_pads,
+                       InToAcc in_to_acc,
+                       WeiToAcc wei_to_acc,
+                       StoreOut store_out,
+                       std::size_t max_column_bytes = detail::ConvIm2colMaxColumnBytes)
+{
+    using AccDataType   = detail::ConvIm2colAccDataType;
+    using ImageToColumn = ReferenceImageToColumn<NDimSpatial,
+                                                 detail::ConvIm2colImageLayout<NDimSpatial>,
+                                                 AccDataType,
+                                                 AccDataType>;
+
+    const detail::ConvIm2colGemmShape<NDimSpatial> shape(input, weight, output);
+
+    const std::size_t C    = shape.C;
+    const std::size_t K    = shape.K;
+    const std::size_t F    = shape.filter_size;
+    const std::size_t CF   = C * F;
+    auto in_slice_lengths  = input.GetLengths();
+    auto wei_slice_lengths = weight.GetLengths();
+
+    std::size_t nb = 0, window_length = 0;
+    shape.GetChunking(max_column_bytes, nb, window_length);
+
+    in_slice_lengths[0]  = 1;
+    wei_slice_lengths[0] = 1;
+
+    Tensor<AccDataType> wei_slice(wei_slice_lengths);
+
+    for(std::size_t g = 0; g < shape.G; ++g)
+    {
+        // [K, C, f] so that the GEMM reduction index is c * F + f
+        detail::ConvIm2colCopySlice(weight, wei_slice, g, 0, 0, wei_to_acc);
+
+        for(std::size_t n0 = 0; n0 < shape.N; n0 += nb)
+        {
+            const std::size_t n_chunk = std::min(nb, shape.N - n0);
+
+            for(std::size_t o0 = 0; o0 < shape.out_lengths[0]; o0 += window_length)
+            {
+                const auto window =
+                    shape.GetWindow(o0,
+                                    std::min(o0 + window_length, shape.out_lengths[0]),
+                                    conv_strides,
+                                    conv_dilations,
+                                    in_left_pads,
+                                    in_right_pads);
+
+                // output positions of one image in the window
+                const std::size_t O =
+                    shape.out_size / shape.out_lengths[0] * (window.o_end - window.o_begin);
+
+                in_slice_lengths[1] = n_chunk;
+                in_slice_lengths[3] = window.i_end - window.i_begin;
+                Tensor<AccDataType> in_slice(in_slice_lengths);
+                Tensor<AccDataType> column({std::size_t{1}, n_chunk * O, CF});
+
+                detail::ConvIm2colCopySlice(input, in_slice, g, n0, window.i_begin, in_to_acc);
+
+                auto im2col_arg = ImageToColumn::MakeArgument(in_slice,
+                                                              column,
+                                                              shape.GetFilterLengths(),
+                                                              conv_strides,
+                                                              conv_dilations,
+                                                              window.in_left_pads,
+                                                              window.in_right_pads);
+                ImageToColumn::MakeInvoker().Run(im2col_arg);
+
+                const AccDataType* p_column = column.mData.data();
+                const AccDataType* p_wei    = wei_slice.mData.data();
+
+                utils::host_blocked_gemm<AccDataType>(
+                    n_chunk * O,
+                    K,
+                    CF,
+                    [&](std::size_t row, std::size_t cf) {
+                        return p_column[row * CF + cf % F * C + cf / F];
+                    },
+                    [&](std::size_t cf, std::size_t k) { return p_wei[k * CF + cf]; },
+                    [&](std::size_t row, std::size_t k, AccDataType acc) {
+                        std::array<std::size_t, NDimSpatial + 3> idx;
+                        std::size_t o = row % O;
+
+                        for(ck::index_t i = NDimSpatial - 1; i > 0; --i)
+                        {
+                            idx[i + 3] = o % shape.out_lengths[i];
+                            o /= shape.out_lengths[i];
+                        }
+
+                        idx[0] = g;
+                        idx[1] = n0 + row / O;
+                        idx[2] = k;
+                        idx[3] = window.o_begin + o;
+
+                        store_out(idx, acc);
+                    });
+            }
+        }
+    }
+}
+
+// Backward data convolution as GEMM + col2im.
+//   in(g, n, c, i) = sum_{f, o : i = o * s + f * d - p} sum_k out(g, n, k, o) * wei(g, k, c, f)
+// For every group and chunk of images (or window of output rows of one image, see GetChunking)
+// the [rows = n * o, K] output gradient is multiplied with the [K, f * C + c] weights into a
+// column buffer, which ReferenceColumnToImage folds back onto the part of the image the window
+// reads. Those parts are summed into the images of the chunk. The filter taps of a column are
+// summed after their K products, so the result can differ from the direct reference in the last
+// bits of the accumulator.
+//   out_to_acc(x) / wei_to_acc(x) return the element-op'ed operand as ConvIm2colAccDataType.
+//   store_in(idx, acc) receives the accumulator of input [g, n, c, i...] exactly once.
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename OutToAcc,
+          typename WeiToAcc,
+          typename StoreIn>
+void ConvBwdDataIm2colGemm(const Tensor<InDataType>& input,
+                           const Tensor<WeiDataType>& weight,
+                           const Tensor<OutDataType>& output,
+                           const std::vector<ck::index_t>& conv_strides,
+                           const std::vector<ck::index_t>& conv_dilations,
+                           const std::vector<ck::index_t>& in_left_pads,
+                           const std::vector<ck::index_t>& in_right_pads,
+                           OutToAcc out_to_acc,
+                           WeiToAcc wei_to_acc,
+                           StoreIn store_in,
+                           std::size_t max_column_bytes = detail::ConvIm2colMaxColumnBytes)
+{
+    using AccDataType   = detail::ConvIm2colAccDataType;
+    using ColumnToImage = ReferenceColumnToImage<NDimSpatial,
+                                                 detail::ConvIm2colImageLayout<NDimSpatial>,
+                                                 AccDataType,
+                                                 AccDataType>;
+
+    const detail::ConvIm2colGemmShape<NDimSpatial> shape(input, weight, output);
+
+    const std::size_t C    = shape.C;
+    const std::size_t K    = shape.K;
+    const std::size_t F    = shape.filter_size;
+    const std::size_t CF   = C * F;
+    auto in_slice_lengths  = input.GetLengths();
+    auto out_slice_lengths = output.GetLengths();
+    auto wei_slice_lengths = weight.GetLengths();
+
+    std::size_t nb = 0, window_length = 0;
+    shape.GetChunking(max_column_bytes, nb, window_length);
+
+    in_slice_lengths[0]  = 1;
+    out_slice_lengths[0] = 1;
+    wei_slice_lengths[0] = 1;
+
+    Tensor<AccDataType> wei_slice(wei_slice_lengths);
+
+    for(std::size_t g = 0; g < shape.G; ++g)
+    {
+        detail::ConvIm2colCopySlice(weight, wei_slice, g, 0, 0, wei_to_acc);
+
+        for(std::size_t n0 = 0; n0 < shape.N; n0 += nb)
+        {
+            const std::size_t n_chunk = std::min(nb, shape.N - n0);
+
+            // whole images of the chunk, the windows are summed into them
+            in_slice_lengths[1] = n_chunk;
+            in_slice_lengths[3] = shape.in_lengths[0];
+            Tensor<AccDataType> in_images(in_slice_lengths);
+
+            for(std::size_t o0 = 0; o0 < shape.out_lengths[0]; o0 += window_length)
+            {
+                const auto window =
+                    shape.GetWindow(o0,
+                                    std::min(o0 + window_length, shape.out_lengths[0]),
+                                    conv_strides,
+                                    conv_dilations,
+                                    in_left_pads,
+                                    in_right_pads);
+
+                // output positions of one image in the window
+                const std::size_t O =
+                    shape.out_size / shape.out_lengths[0] * (window.o_end - window.o_begin);
+
+                in_slice_lengths[3]  = window.i_end - window.i_begin;
+                out_slice_lengths[1] = n_chunk;
+                out_slice_lengths[3] = window.o_end - window.o_begin;
+                Tensor<AccDataType> in_slice(in_slice_lengths);
+                Tensor<AccDataType> out_slice(out_slice_lengths);
+                Tensor<AccDataType> column({std::size_t{1}, n_chunk * O, CF});
+
+                detail::ConvIm2colCopySlice(output, out_slice, g, n0, window.o_begin, out_to_acc);
+
+                const AccDataType* p_out = out_slice.mData.data();
+                const AccDataType* p_wei = wei_slice.mData.data();
+                AccDataType* p_column    = column.mData.data();
+
+                // out_slice is [n, K, o], column is [n * o, f * C + c]
+                utils::host_blocked_gemm<AccDataType>(
+                    n_chunk * O,
+                    CF,
+                    K,
+                    [&](std::size_t row, std::size_t k) {
+                        return p_out[row / O * K * O + k * O + row % O];
+                    },
+                    [&](std::size_t k, std::size_t fc) {
+                        return p_wei[k * CF + fc % C * F + fc / C];
+                    },
+                    [&](std::size_t row, std::size_t fc, AccDataType acc) {
+                        p_column[row * CF + fc] = acc;
+                    });
+
+                auto col2im_arg = ColumnToImage::MakeArgument(column,
+                                                              in_slice,
+                                                              shape.GetFilterLengths(),
+                                                              conv_strides,
+                                                              conv_dilations,
+                                                              window.in_left_pads,
+                                                              window.in_right_pads);
+                ColumnToImage::MakeInvoker().Run(col2im_arg);
+
+                detail::ConvIm2colAddSlice(in_slice, in_images, window.i_begin);
+            }
+
+            detail::ConvIm2colForEachSliceIndex<NDimSpatial>(
+                in_images, g, n0, [&](const auto& idx, std::size_t i) {
+                    store_in(idx, in_images.mData[i]);
+                });
+        }
+    }
+}
+
+// Backward weight convolution as im2col + GEMM.
+//   wei(g, k, c, f) = sum_n sum_o out(g, n, k, o) * in(g, n, c, o * s + f * d - p)
+// For every group and chunk of images (or window of output rows of one image, see GetChunking)
+// the input is unfolded by ReferenceImageToColumn and the [K, rows = n * o] output gradient is
+// multiplied with the [rows, f * C + c] column buffer. Each chunk continues from the accumulators
+// of the previous one, so the reduction runs over (n, o) in the same order as the direct loops and
+// matches the direct reference for finite inputs.
+//   out_to_acc(x) / in_to_acc(x) return the element-op'ed operand as ConvIm2colAccDataType.
+//   store_wei(idx, acc) receives the accumulator of weight [g, k, c, f...] exactly once.
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename OutToAcc,
+          typename InToAcc,
+          typename StoreWei>
+void ConvBwdWeightIm2colGemm(const Tensor<InDataType>& input,
+                             const Tensor<WeiDataType>& weight,
+                             const Tensor<OutDataType>& output,
+                             const std::vector<ck::index_t>& conv_strides,
+                             const std::vector<ck::index_t>& conv_dilations,
+                             const std::vector<ck::index_t>& in_left_pads,
+                             const std::vector<ck::index_t>& in_right_pads,
+                             OutToAcc out_to_acc,
+                             InToAcc in_to_acc,
+                             StoreWei store_wei,
+                             std::size_t max_column_bytes = detail::ConvIm2colMaxColumnBytes)
+{
+    using AccDataType   = detail::ConvIm2colAccDataType;
+    using ImageToColumn = ReferenceImageToColumn<NDimSpatial,
+                                                 detail::ConvIm2colImageLayout<NDimSpatial>,
+                                                 AccDataType,
+                                                 AccDataType>;
+
+    const detail::ConvIm2colGemmShape<NDimSpatial> shape(input, weight, output);
+
+    const std::size_t C    = shape.C;
+    const std::size_t K    = shape.K;
+    const std::size_t CF   = C * shape.filter_size;
+    auto in_slice_lengths  = input.GetLengths();
+    auto out_slice_lengths = output.GetLengths();
+
+    std::size_t nb = 0, window_length = 0;
+    shape.GetChunking(max_column_bytes, nb, window_length);
+
+    in_slice_lengths[0]  = 1;
+    out_slice_lengths[0] = 1;
+
+    // partial sums carried from one chunk to the next, [K, f * C + c]
+    std::vector<AccDataType> acc_buf(K * CF);
+
+    for(std::size_t g = 0; g < shape.G; ++g)
+    {
+        for(std::size_t n0 = 0; n0 < shape.N; n0 += nb)
+        {
+            const std::size_t n_chunk = std::min(nb, shape.N - n0);
+
+            for(std::size_t o0 = 0; o0 < shape.out_lengths[0]; o0 += window_length)
+            {
+                const auto window =
+                    shape.GetWindow(o0,
+                                    std::min(o0 + window_length, shape.out_lengths[0]),
+                                    conv_strides,
+                                    conv_dilations,
+                                    in_left_pads,
+                                    in_right_pads);
+
+                const bool first_chunk = n0 == 0 && window.o_begin == 0;
+                const bool last_chunk =
+                    n0 + n_chunk == shape.N && window.o_end == shape.out_lengths[0];
+
+                // output positions of one image in the window
+                const std::size_t O =
+                    shape.out_size / shape.out_lengths[0] * (window.o_end - window.o_begin);
+
+                in_slice_lengths[1]  = n_chunk;
+                in_slice_lengths[3]  = window.i_end - window.i_begin;
+                out_slice_lengths[1] = n_chunk;
+                out_slice_lengths[3] = window.o_end - window.o_begin;
+                Tensor<AccDataType> in_slice(in_slice_lengths);
+                Tensor<AccDataType> out_slice(out_slice_lengths);
+                Tensor<AccDataType> column({std::size_t{1}, n_chunk * O, CF});
+
+                detail::ConvIm2colCopySlice(input, in_slice, g, n0, window.i_begin, in_to_acc);
+                detail::ConvIm2colCopySlice(output, out_slice, g, n0, window.o_begin, out_to_acc);
+
+                auto im2col_arg = ImageToColumn::MakeArgument(in_slice,
+                                                              column,
+                                                              shape.GetFilterLengths(),
+                                                              conv_strides,
+                                                              conv_dilations,
+                                                              window.in_left_pads,
+                                                              window.in_right_pads);
+                ImageToColumn::MakeInvoker().Run(im2col_arg);
+
+                const AccDataType* p_out    = out_slice.mData.data();
+                const AccDataType* p_column = column.mData.data();
+                AccDataType* p_acc          = acc_buf.data();
+
+                utils::host_blocked_gemm_accumulate<AccDataType>(
+                    K,
+                    CF,
+                    n_chunk * O,
+                    [&](std::size_t k, std::size_t fc) {
+                        return first_chunk ? AccDataType{0} : p_acc[k * CF + fc];
+                    },
+                    [&](std::size_t k, std::size_t row) {
+                        return p_out[row / O * K * O + k * O + row % O];
+                    },
+                    [&](std::size_t row, std::size_t fc) { return p_column[row * CF + fc]; },
+                    [&](std::size_t k, std::size_t fc, AccDataType acc) {
+                        if(!last_chunk)
+                        {
+                            p_acc[k * CF + fc] = acc;
+                            return;
+                        }
+
+                        std::array<std::size_t, NDimSpatial + 3> idx;
+                        std::size_t f = fc / C;
+
+                        for(ck::index_t i = NDimSpatial - 1; i >= 0; --i)
+                        {
+                            idx[i + 3] = f % shape.filter_lengths[i];
+                            f /= shape.filter_lengths[i];
+                        }
+
+                        idx[0] = g;
+                        idx[1] = k;
+                        idx[2] = fc % C;
+
+                        store_wei(idx, acc);
+                    });
+            }
+        }
+    }
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -8,6 +8,7 @@
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_blocked_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 
 namespace ck {
@@ -22,34 +23,59 @@ template <typename ADataType,
           typename BElementwiseOperation,
           typename CElementwiseOperation,
           typename ComputeTypeA = CDataType,
-          typename ComputeTypeB = ComputeTypeA>
+          typename ComputeTypeB = ComputeTypeA,
+          typename Descriptor   = HostTensorDescriptor>
 struct ReferenceGemm : public device::BaseOperator
 {
+    // the descriptor of the [M, K], [K, N] and [M, N] tensors, with HostTensorDescriptorN<2> the
+    // per-element loop indexes them without touching the heap
+    using ATensor = Tensor<ADataType, Descriptor>;
+    using BTensor = Tensor<BDataType, Descriptor>;
+    using CTensor = Tensor<CDataType, Descriptor>;
+
+
+    // A/B element-ops that are (treated as) PassThrough can be applied once while packing the
+    // operands, which lets us use the cache-blocked host GEMM instead of the per-element loop
+    template <typename ElementwiseOperation>
+    static constexpr bool is_pass_through_v =
+        is_same_v<ElementwiseOperation, ck::tensor_operation::element_wise::PassThrough> ||
+        is_same_v<ElementwiseOperation, ck::tensor_operation::element_wise::ConvertBF16RTN>;
+
+    static constexpr bool UseBlockedGemm = is_pass_through_v<AElementwiseOperation> &&
+                                           is_pass_through_v<BElementwiseOperation> &&
+                                           ck::utils::is_host_blocked_gemm_acc_v<AccDataType>;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k,
-                 const Tensor<BDataType>& b_k_n,
-                 Tensor<CDataType>& c_m_n,
+        Argument(const ATensor& a_m_k,
+                 const BTensor& b_k_n,
+                 CTensor& c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 ck::utils::HostGemmAccumulation accumulation =
+                     ck::utils::HostGemmAccumulation::Strict)
             : a_m_k_{a_m_k},
               b_k_n_{b_k_n},
               c_m_n_{c_m_n},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              accumulation_{accumulation}
         {
         }
 
-        const Tensor<ADataType>& a_m_k_;
-        const Tensor<BDataType>& b_k_n_;
-        Tensor<CDataType>& c_m_n_;
+        const ATensor& a_m_k_;
+        const BTensor& b_k_n_;
+        CTensor& c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        // Strict keeps the results bit-identical to the scalar loop, Relaxed allows FMA
+        ck::utils::HostGemmAccumulation accumulation_;
     };
 
     // Invoker
@@ -57,7 +83,55 @@ struct ReferenceGemm : public device::BaseOperator
     {
         using Argument = ReferenceGemm::Argument;
 
-        float Run(const Argument& arg)
+        static void RunBlocked(const Argument& arg)
+        {
+            const std::size_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            const auto& a_strides = arg.a_m_k_.mDesc.GetStrides();
+            const auto& b_strides = arg.b_k_n_.mDesc.GetStrides();
+            const auto& c_strides = arg.c_m_n_.mDesc.GetStrides();
+
+            const std::size_t a_stride_m = a_strides[0];
+            const std::size_t a_stride_k = a_strides[1];
+            const std::size_t b_stride_k = b_strides[0];
+            const std::size_t b_stride_n = b_strides[1];
+            const std::size_t c_stride_m = c_strides[0];
+            const std::size_t c_stride_n = c_strides[1];
+
+            const ADataType* p_a = arg.a_m_k_.mData.data();
+            const BDataType* p_b = arg.b_k_n_.mData.data();
+            CDataType* p_c       = arg.c_m_n_.mData.data();
+
+            // same conversion chain as the scalar loop: X -> ComputeType -> AccDataType
+            auto load_a = [=](std::size_t m, std::size_t k) {
+                ComputeTypeA v_a = 0;
+                ck::tensor_operation::element_wise::PassThrough{}(
+                    v_a, p_a[m * a_stride_m + k * a_stride_k]);
+                return ck::type_convert<AccDataType>(v_a);
+            };
+
+            auto load_b = [=](std::size_t k, std::size_t n) {
+                ComputeTypeB v_b = 0;
+                ck::tensor_operation::element_wise::PassThrough{}(
+                    v_b, p_b[k * b_stride_k + n * b_stride_n]);
+                return ck::type_convert<AccDataType>(v_b);
+            };
+
+            auto store_c = [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+                CDataType v_c = 0;
+
+                arg.c_element_op_(v_c, v_acc);
+
+                p_c[m * c_stride_m + n * c_stride_n] = v_c;
+            };
+
+            ck::utils::host_blocked_gemm<AccDataType>(
+                M, N, K, load_a, load_b, store_c, arg.accumulation_);
+        }
+
+        static void RunNaive(const Argument& arg)
         {
             auto f_mk_kn_mn = [&](auto m, auto n) {
                 const int K = arg.a_m_k_.mDesc.GetLengths()[1];
@@ -103,6 +177,18 @@ struct ReferenceGemm : public device::BaseOperator
             make_ParallelTensorFunctor(
                 f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
                 std::thread::hardware_concurrency());
+        }
+
+        float Run(const Argument& arg)
+        {
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(arg);
+            }
+            else
+            {
+                RunNaive(arg);
+            }
 
             return 0;
         }
@@ -122,14 +208,17 @@ struct ReferenceGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
-                             const Tensor<BDataType>& b_k_n,
-                             Tensor<CDataType>& c_m_n,
+    static auto MakeArgument(const ATensor& a_m_k,
+                             const BTensor& b_k_n,
+                             CTensor& c_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             ck::utils::HostGemmAccumulation accumulation =
+                                 ck::utils::HostGemmAccumulation::Strict)
     {
-        return Argument{a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op};
+        return Argument{
+            a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op, accumulation};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
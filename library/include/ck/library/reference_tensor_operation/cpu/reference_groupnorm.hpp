@@ -1,14 +1,16 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -53,9 +55,9 @@ struct ReferenceGroupnorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_;
-        const Tensor<XDataType> gamma_;
-        const Tensor<XDataType> beta_;
+        const Tensor<XDataType>& x_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
         Tensor<YDataType>& y_;
         Tensor<SaveMeanInvStdDataType>& save_mean_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_;
@@ -78,75 +80,52 @@ struct ReferenceGroupnorm : public device::BaseOperator
             Tensor<ComputeDataType> mean({N, G});
             Tensor<ComputeDataType> var({N, G});
 
-            // Compute mean & var in [H, W, C] by Welford Algorithm
-            // TODO - parallel for each HWC
-            // TODO - address calculation
-            for(int n = 0; n < N; ++n)
-            {
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType mean_val = type_convert<ComputeDataType>(0.0f);
-                    ComputeDataType var_val  = type_convert<ComputeDataType>(0.0f);
-                    int32_t curr_count       = 0;
+            // Compute mean & var in [H, W, C] by Welford Algorithm, one task per [N, G]
+            auto f_welford = [&](auto n, auto g) {
+                ReferenceWelford<ComputeDataType> welford;
+                for(int h = 0; h < H; ++h)
+                    for(int w = 0; w < W; ++w)
+                        welford.Update(C, [&](auto c) {
+                            return type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
+                        });
 
-                    for(int h = 0; h < H; ++h)
-                    {
-                        for(int w = 0; w < W; ++w)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                curr_count++;
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType delta = x - mean_val;
-                                mean_val += delta / curr_count;
-                                ComputeDataType delta2 = x - mean_val;
-                                var_val += delta * delta2;
-                            }
-                        }
-                    }
+                mean(n, g) = welford.GetMean();
+                var(n, g)  = welford.GetVariance();
 
-                    mean(n, g) = mean_val;
-                    var(n, g)  = var_val / curr_count;
+                arg.save_mean_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(mean(n, g));
 
-                    arg.save_mean_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(mean(n, g));
+                ComputeDataType divisor =
+                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n, g) + arg.epsilon_);
+                arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
+            };
 
-                    ComputeDataType divisor =
-                        static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n, g) + arg.epsilon_);
-                    arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-                }
-            }
+            make_ParallelTensorFunctor(f_welford, N, G)(std::thread::hardware_concurrency());
 
             // Normalization
-            for(int n = 0; n < N; ++n)
-            {
-                for(int h = 0; h < H; ++h)
+            auto f_norm = [&](auto n, auto h) {
+                for(int w = 0; w < W; ++w)
                 {
-                    for(int w = 0; w < W; ++w)
+                    for(int g = 0; g < G; ++g)
                     {
-                        for(int g = 0; g < G; ++g)
+                        for(int c = 0; c < C; ++c)
                         {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    type_convert<ComputeDataType>(arg.gamma_(g, c));
-                                ComputeDataType beta =
-                                    type_convert<ComputeDataType>(arg.beta_(g, c));
-                                ComputeDataType mean_val =
-                                    type_convert<ComputeDataType>(mean(n, g));
-                                ComputeDataType var_val = type_convert<ComputeDataType>(var(n, g));
-                                ComputeDataType y       = gamma * (x - mean_val) /
-                                                        ck::math::sqrt(arg.epsilon_ + var_val) +
-                                                    beta;
-                                arg.y_elementwise_op_(y, y);
-                                arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
-                            }
+                            ComputeDataType x =
+                                type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
+                            ComputeDataType gamma = type_convert<ComputeDataType>(arg.gamma_(g, c));
+                            ComputeDataType beta  = type_convert<ComputeDataType>(arg.beta_(g, c));
+                            ComputeDataType mean_val = type_convert<ComputeDataType>(mean(n, g));
+                            ComputeDataType var_val  = type_convert<ComputeDataType>(var(n, g));
+                            ComputeDataType y        = gamma * (x - mean_val) /
+                                                    ck::math::sqrt(arg.epsilon_ + var_val) +
+                                                beta;
+                            arg.y_elementwise_op_(y, y);
+                            arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
                         }
                     }
                 }
-            }
+            };
+
+            make_ParallelTensorFunctor(f_norm, N, H)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <algorithm>
 
@@ -97,76 +98,77 @@ struct ReferenceGroupnormBwd : public device::BaseOperator
             int G = arg.lengths_[3];
             int C = arg.lengths_[4];
 
-            // Calculate dgamma and dbeta
-            for(int g = 0; g < G; ++g)
-                for(int c = 0; c < C; ++c)
-                {
-                    ComputeDataType dgamma = 0;
-                    ComputeDataType dbeta  = 0;
-
-                    for(int n = 0; n < N; ++n)
-                        for(int h = 0; h < H; ++h)
-                            for(int w = 0; w < W; ++w)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType mean =
-                                    ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                                ComputeDataType rstd =
-                                    ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-                                dgamma += dy * rstd * (x - mean);
-                                dbeta += dy;
-                            }
-                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
-                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
-                }
+            // Calculate dgamma and dbeta, one task per [G, C]
+            auto f_dgamma_dbeta = [&](auto g, auto c) {
+                ComputeDataType dgamma = 0;
+                ComputeDataType dbeta  = 0;
 
-            // Calculate dx
-            int reduce_size = H * W * C;
-            for(int n = 0; n < N; ++n)
-                for(int g = 0; g < G; ++g)
+                for(int n = 0; n < N; ++n)
                 {
-                    ComputeDataType ds = 0;
-                    ComputeDataType db = 0;
-
                     ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
                     ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
 
                     for(int h = 0; h < H; ++h)
                         for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ds += dy * gamma * x;
-                                db += dy * gamma;
-                            }
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ComputeDataType b =
-                                    (db * mean - ds) * rstd * rstd * rstd / reduce_size;
-                                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
-                                arg.dx_nhwgc_(n, h, w, g, c) =
-                                    ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
-                            }
+                        {
+                            ComputeDataType dy =
+                                ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
+                            ComputeDataType x =
+                                ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
+                            dgamma += dy * rstd * (x - mean);
+                            dbeta += dy;
+                        }
                 }
+                arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
+                arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
+            };
+
+            // Calculate dx, one task per [N, G]
+            int reduce_size = H * W * C;
+
+            auto f_dx = [&](auto n, auto g) {
+                ComputeDataType ds = 0;
+                ComputeDataType db = 0;
+
+                ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
+                ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
+
+                for(int h = 0; h < H; ++h)
+                    for(int w = 0; w < W; ++w)
+                        for(int c = 0; c < C; ++c)
+                        {
+                            ComputeDataType dy =
+                                ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
+                            ComputeDataType x =
+                                ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
+                            ComputeDataType gamma =
+                                ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
+
+                            ds += dy * gamma * x;
+                            db += dy * gamma;
+                        }
+
+                ComputeDataType b  = (db * mean - ds) * rstd * rstd * rstd / reduce_size;
+                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
+
+                for(int h = 0; h < H; ++h)
+                    for(int w = 0; w < W; ++w)
+                        for(int c = 0; c < C; ++c)
+                        {
+                            ComputeDataType dy =
+                                ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
+                            ComputeDataType x =
+                                ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
+                            ComputeDataType gamma =
+                                ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
+
+                            arg.dx_nhwgc_(n, h, w, g, c) =
+                                ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
+                        }
+            };
+
+            make_ParallelTensorFunctor(f_dgamma_dbeta, G, C)(std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_dx, N, G)(std::thread::hardware_concurrency());
 
             return 0;
         }
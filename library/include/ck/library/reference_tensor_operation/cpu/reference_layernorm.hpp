@@ -1,14 +1,16 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -57,9 +59,9 @@ struct ReferenceLayernorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_m_n_;
-        const Tensor<XDataType> gamma_n_;
-        const Tensor<XDataType> beta_n_;
+        const Tensor<XDataType>& x_m_n_;
+        const Tensor<GammaDataType>& gamma_n_;
+        const Tensor<BetaDataType>& beta_n_;
         Tensor<YDataType>& y_m_n_;
         Tensor<SaveMeanInvStdDataType>& save_mean_m_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_m_;
@@ -72,48 +74,38 @@ struct ReferenceLayernorm : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // rows are independent, each one is reduced by a single pass of Welford's algorithm
         float Run2D(const Argument& arg)
         {
             int M = arg.lengths_[0];
             int N = arg.lengths_[1];
 
-            Tensor<ComputeDataType> mean({M});
-            Tensor<ComputeDataType> var({M});
+            auto f = [&](auto m) {
+                ReferenceWelford<ComputeDataType> welford;
+                welford.Update(N, [&](auto n) {
+                    return ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
+                });
 
-            for(int m = 0; m < M; ++m)
-            {
-                mean(m) = 0;
-                var(m)  = 0;
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    mean(m) += x_val;
-                    var(m) += x_val * x_val;
-                }
-
-                mean(m) = mean(m) / N;
-                var(m)  = (var(m) / N) - (mean(m) * mean(m));
-            }
-
-            for(int m = 0; m < M; ++m)
-            {
+                ComputeDataType mean = welford.GetMean();
                 ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(m) + arg.epsilon_);
+                    static_cast<ComputeDataType>(1) /
+                    ck::math::sqrt(welford.GetVariance() + arg.epsilon_);
 
                 for(int n = 0; n < N; ++n)
                 {
                     auto x_val     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
                     auto gamma_val = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
                     auto beta_val  = ck::type_convert<ComputeDataType>(arg.beta_n_(n));
-                    auto y_val     = (x_val - mean(m)) * divisor;
+                    auto y_val     = (x_val - mean) * divisor;
                     y_val          = (y_val * gamma_val) + beta_val;
                     arg.y_elementwise_op_(y_val, y_val);
                     arg.y_m_n_(m, n) = ck::type_convert<YDataType>(y_val);
                 }
-                arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean(m));
+                arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean);
                 arg.save_inv_std_m_(m) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
+            };
+
+            make_ParallelTensorFunctor(f, M)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -125,33 +117,18 @@ struct ReferenceLayernorm : public device::BaseOperator
             int W = arg.lengths_[2];
             int C = arg.lengths_[3];
 
-            Tensor<ComputeDataType> mean({N});
-            Tensor<ComputeDataType> var({N});
-
-            int reduce_length = H * W * C;
-
-            for(int n = 0; n < N; ++n)
-            {
-                mean(n) = 0;
-                var(n)  = 0;
-
+            auto f = [&](auto n) {
+                ReferenceWelford<ComputeDataType> welford;
                 for(int h = 0; h < H; ++h)
                     for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            mean(n) += x_val;
-                            var(n) += x_val * x_val;
-                        }
+                        welford.Update(C, [&](auto c) {
+                            return ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
+                        });
 
-                mean(n) = mean(n) / reduce_length;
-                var(n)  = (var(n) / reduce_length) - (mean(n) * mean(n));
-            }
-
-            for(int n = 0; n < N; ++n)
-            {
+                ComputeDataType mean = welford.GetMean();
                 ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n) + arg.epsilon_);
+                    static_cast<ComputeDataType>(1) /
+                    ck::math::sqrt(welford.GetVariance() + arg.epsilon_);
 
                 for(int h = 0; h < H; ++h)
                     for(int w = 0; w < W; ++w)
@@ -161,14 +138,16 @@ struct ReferenceLayernorm : public device::BaseOperator
                             auto gamma_val =
                                 ck::type_convert<ComputeDataType>(arg.gamma_n_(h, w, c));
                             auto beta_val = ck::type_convert<ComputeDataType>(arg.beta_n_(h, w, c));
-                            auto y_val    = (x_val - mean(n)) * divisor;
+                            auto y_val    = (x_val - mean) * divisor;
                             y_val         = (y_val * gamma_val) + beta_val;
                             arg.y_elementwise_op_(y_val, y_val);
                             arg.y_m_n_(n, h, w, c) = ck::type_convert<YDataType>(y_val);
                         }
-                arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean(n));
+                arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean);
                 arg.save_inv_std_m_(n) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
+            };
+
+            make_ParallelTensorFunctor(f, N)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <algorithm>
 
@@ -93,9 +94,8 @@ struct ReferenceLayernormBwd : public device::BaseOperator
             int M = arg.lengths_[0];
             int N = arg.lengths_[1];
 
-            // Calculate dgamma and dbeta
-            for(int n = 0; n < N; ++n)
-            {
+            // Calculate dgamma and dbeta, columns are independent
+            auto f_dgamma_dbeta = [&](auto n) {
                 ComputeDataType dgamma = 0;
                 ComputeDataType dbeta  = 0;
 
@@ -110,11 +110,10 @@ struct ReferenceLayernormBwd : public device::BaseOperator
                 }
                 arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma);
                 arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta);
-            }
+            };
 
-            // Calculate dx
-            for(int m = 0; m < M; ++m)
-            {
+            // Calculate dx, rows are independent
+            auto f_dx = [&](auto m) {
                 ComputeDataType ds = 0;
                 ComputeDataType db = 0;
 
@@ -131,18 +130,21 @@ struct ReferenceLayernormBwd : public device::BaseOperator
                     db += dy * gamma;
                 }
 
+                ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
+                ComputeDataType c = -b * mean - db * rstd / N;
+
                 for(int n = 0; n < N; ++n)
                 {
                     ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
                     ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
                     ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
 
-                    ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
-                    ComputeDataType c = -b * mean - db * rstd / N;
-
                     arg.dx_m_n_(m, n) = ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
                 }
-            }
+            };
+
+            make_ParallelTensorFunctor(f_dgamma_dbeta, N)(std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_dx, M)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -1,10 +1,13 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <algorithm>
 
@@ -56,8 +59,159 @@ struct ReferenceSoftmax : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        static constexpr index_t NumLane   = 8;
+        static constexpr index_t BlockSize = 8 * NumLane;
+
+        // Length of the contiguous axis the reduce dims fold into, 0 if they do not fold. The
+        // reduce dims fold when, ordered by stride, each stride is the product of the lengths
+        // before it starting from 1, so the reduced elements of a row are mData[offset, offset +
+        // length). The output must have the same strides and no two elements may share memory,
+        // otherwise rows written in parallel could overlap.
+        static std::size_t GetFoldedReduceLength(const Argument& arg)
+        {
+            const auto& lengths = arg.in_.mDesc.GetLengths();
+            const auto& strides = arg.in_.mDesc.GetStrides();
+
+            if(arg.sm_reduce_dims_.empty() || lengths != arg.out_.mDesc.GetLengths() ||
+               strides != arg.out_.mDesc.GetStrides() ||
+               arg.out_.mDesc.GetElementSpaceSize() != arg.out_.mDesc.GetElementSize())
+                return 0;
+
+            std::vector<index_t> dims = arg.sm_reduce_dims_;
+            std::sort(dims.begin(), dims.end(), [&](index_t a, index_t b) {
+                return strides[a] < strides[b];
+            });
+
+            std::size_t length = 1;
+            for(std::size_t i = 0; i < dims.size(); ++i)
+            {
+                if(i > 0 && dims[i] == dims[i - 1])
+                    return 0;
+
+                // the stride of a dim of length 1 does not matter
+                if(lengths[dims[i]] == 1)
+                    continue;
+                if(strides[dims[i]] != length)
+                    return 0;
+
+                length *= lengths[dims[i]];
+            }
+
+            return length;
+        }
+
+        // softmax of n contiguous values. The max and the sum of exponentials are found in one pass
+        // a block at a time (online softmax): the running sum is rescaled whenever the block raises
+        // the max. Block max and sum use NumLane partial results so the loops, including the one
+        // calling exp, vectorize.
+        static void RunRow(const InDataType* in,
+                           OutDataType* out,
+                           std::size_t n,
+                           AccDataType alpha,
+                           AccDataType beta)
+        {
+            const AccDataType lowest = std::numeric_limits<AccDataType>::lowest();
+
+            AccDataType values[BlockSize];
+
+            AccDataType row_max = lowest;
+            AccDataType row_sum = 0;
+
+            for(std::size_t begin = 0; begin < n; begin += BlockSize)
+            {
+                const index_t size =
+                    static_cast<index_t>(std::min<std::size_t>(BlockSize, n - begin));
+
+                for(index_t i = 0; i < size; ++i)
+                    values[i] = ck::type_convert<AccDataType>(in[begin + i]);
+
+                // padding does not change the max
+                std::fill(values + size, values + BlockSize, lowest);
+
+                AccDataType lane_max[NumLane];
+                std::fill(lane_max, lane_max + NumLane, lowest);
+                for(index_t i = 0; i < BlockSize; i += NumLane)
+                    for(index_t l = 0; l < NumLane; ++l)
+                        lane_max[l] = std::max(lane_max[l], values[i + l]);
+
+                AccDataType new_max = row_max;
+                for(index_t l = 0; l < NumLane; ++l)
+                    new_max = std::max(new_max, lane_max[l]);
+
+                for(index_t i = 0; i < BlockSize; ++i)
+                    values[i] = std::exp(values[i] - new_max);
+
+                // padding adds nothing to the sum
+                std::fill(values + size, values + BlockSize, AccDataType{0});
+
+                AccDataType lane_sum[NumLane] = {};
+                for(index_t i = 0; i < BlockSize; i += NumLane)
+                    for(index_t l = 0; l < NumLane; ++l)
+                        lane_sum[l] += values[i + l];
+
+                row_sum *= std::exp(row_max - new_max);
+                for(index_t l = 0; l < NumLane; ++l)
+                    row_sum += lane_sum[l];
+
+                row_max = new_max;
+            }
+
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                const AccDataType numerator =
+                    std::exp(ck::type_convert<AccDataType>(in[i]) - row_max);
+                const AccDataType temp_result =
+                    alpha * numerator / row_sum + beta * ck::type_convert<AccDataType>(out[i]);
+                out[i] = ck::type_convert<OutDataType>(temp_result);
+            }
+        }
+
+        // Fast path when the reduce dims fold into one contiguous axis: rows of the scalar dims are
+        // independent and run in parallel. Results match the generic path up to the rounding of
+        // the sum of exponentials.
+        static bool RunFolded(const Argument& arg)
+        {
+            const std::size_t reduce_length = GetFoldedReduceLength(arg);
+            if(reduce_length == 0)
+                return false;
+
+            const auto& lengths = arg.in_.mDesc.GetLengths();
+            const auto& strides = arg.in_.mDesc.GetStrides();
+
+            std::size_t num_row = 1;
+            for(index_t dim : arg.sm_scalar_dims_)
+                num_row *= lengths[dim];
+
+            if(num_row == 0)
+                return true;
+
+            auto f = [&](auto row) {
+                // offset of the row from its index in the scalar dims, last dim fastest
+                std::size_t offset = 0;
+                for(std::size_t i = arg.sm_scalar_dims_.size(); i-- > 0;)
+                {
+                    const index_t dim = arg.sm_scalar_dims_[i];
+                    offset += (row % lengths[dim]) * strides[dim];
+                    row /= lengths[dim];
+                }
+
+                RunRow(arg.in_.mData.data() + offset,
+                       arg.out_.mData.data() + offset,
+                       reduce_length,
+                       arg.alpha_,
+                       arg.beta_);
+            };
+
+            make_ParallelTensorFunctor(f, num_row)(std::thread::hardware_concurrency());
+
+            return true;
+        }
+
         float Run(const Argument& arg)
         {
+            if(RunFolded(arg))
+                return 0;
+
             std::vector<size_t> scalar_lengths;
             for(index_t dim : arg.sm_scalar_dims_)
             {
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Single pass mean and variance for the normalization references: Welford's algorithm extended to
+// merge partial results (Chan et al.). Values are added a block at a time. The mean and the sum of
+// squared deviations of a block come from short loops over NumLane independent partial sums, which
+// vectorize, and are then merged into the running result.
+//
+// Unlike E[x^2] - E[x]^2 this does not cancel catastrophically. Against the previous serial
+// references the mean and variance agree to a few ulp times log2 of the reduce length.
+template <typename ComputeDataType>
+struct ReferenceWelford
+{
+    static constexpr index_t NumLane   = 8;
+    static constexpr index_t BlockSize = 8 * NumLane;
+
+    // merges count values with the given mean and sum of squared deviations from it
+    void Merge(long_index_t count, ComputeDataType mean, ComputeDataType m2)
+    {
+        if(count == 0)
+            return;
+
+        const long_index_t new_count = count_ + count;
+        const ComputeDataType delta  = mean - mean_;
+        const ComputeDataType weight =
+            static_cast<ComputeDataType>(count) / static_cast<ComputeDataType>(new_count);
+
+        mean_ += delta * weight;
+        m2_ += m2 + delta * delta * static_cast<ComputeDataType>(count_) * weight;
+        count_ = new_count;
+    }
+
+    // adds get(0), ..., get(n - 1)
+    template <typename F>
+    void Update(long_index_t n, F&& get)
+    {
+        ComputeDataType values[BlockSize];
+
+        for(long_index_t begin = 0; begin < n; begin += BlockSize)
+        {
+            const index_t size = static_cast<index_t>(std::min<long_index_t>(BlockSize, n - begin));
+
+            for(index_t i = 0; i < size; ++i)
+                values[i] = get(begin + i);
+
+            // padding adds nothing to the sum
+            std::fill(values + size, values + BlockSize, ComputeDataType{0});
+
+            ComputeDataType sum[NumLane] = {};
+            for(index_t i = 0; i < BlockSize; i += NumLane)
+                for(index_t l = 0; l < NumLane; ++l)
+                    sum[l] += values[i + l];
+
+            ComputeDataType mean = 0;
+            for(index_t l = 0; l < NumLane; ++l)
+                mean += sum[l];
+            mean /= static_cast<ComputeDataType>(size);
+
+            // padding equal to the mean adds nothing to the squared deviations
+            std::fill(values + size, values + BlockSize, mean);
+
+            ComputeDataType m2[NumLane] = {};
+            for(index_t i = 0; i < BlockSize; i += NumLane)
+                for(index_t l = 0; l < NumLane; ++l)
+                    m2[l] += (values[i + l] - mean) * (values[i + l] - mean);
+
+            ComputeDataType block_m2 = 0;
+            for(index_t l = 0; l < NumLane; ++l)
+                block_m2 += m2[l];
+
+            Merge(size, mean, block_m2);
+        }
+    }
+
+    ComputeDataType GetMean() const { return mean_; }
+
+    // population variance, as used by the normalizations
+    ComputeDataType GetVariance() const
+    {
+        return count_ == 0 ? ComputeDataType{0} : m2_ / static_cast<ComputeDataType>(count_);
+    }
+
+    private:
+    ComputeDataType mean_ = 0;
+    ComputeDataType m2_   = 0;
+    long_index_t count_   = 0;
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -1,34 +1,49 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <memory>
+#include <tuple>
 #include <vector>
 #include <type_traits>
 
 #include "ck/utility/functional2.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
 
+// Records the descriptors of the instances of the tuple in catalog without constructing them
 template <typename BaseOp, typename NewOpInstances>
-void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances,
-                                    const NewOpInstances& new_op_instances)
+void add_device_operation_instances(DeviceOperationInstanceCatalog<BaseOp>& catalog,
+                                    const NewOpInstances&)
 {
     ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
-        const auto new_op_instance = std::get<i>(new_op_instances);
-
-        using NewOpInstance = remove_cvref_t<decltype(new_op_instance)>;
+        using NewOpInstance = remove_cvref_t<std::tuple_element_t<i, NewOpInstances>>;
 
         static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
                       "wrong! NewOpInstance should be derived from BaseOp");
 
-        op_instances.push_back(std::make_unique<NewOpInstance>(new_op_instance));
+        catalog.Add(device_operation_instance_descriptor<BaseOp, NewOpInstance>);
     });
 }
 
+// Constructs the instances of the tuple into op_instances, for the families whose
+// add_device_*_instances functions do not record into a catalog yet
+template <typename BaseOp, typename NewOpInstances>
+void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances,
+                                    const NewOpInstances& new_op_instances)
+{
+    DeviceOperationInstanceCatalog<BaseOp> catalog;
+    add_device_operation_instances(catalog, new_op_instances);
+
+    for(auto& op_instance : catalog.MakeInstances())
+        op_instances.push_back(std::move(op_instance));
+}
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
@@ -0,0 +1,765 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/utility/host_blocked_gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// GEMM on the host through the blocked, packed and multithreaded host_blocked_gemm:
+//   E = cde_op(a_op(A) * b_op(B), D0, D1, ...)
+// All pointers must be host memory, arguments with device memory are not supported. The CPU
+// implementations let nodes without a GPU use the DeviceGemm/DeviceGemmMultipleD interfaces. With
+// HostGemmAccumulation::Strict every output is accumulated like the host reference loop does, so
+// they also serve as a fast oracle.
+template <typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          ck::utils::HostGemmAccumulation Accumulation>
+struct CpuGemmMultipleD
+{
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const void* p_a,
+                 const void* p_b,
+                 std::array<const void*, NumDTensor> p_ds,
+                 void* p_e,
+                 index_t M,
+                 index_t N,
+                 index_t K,
+                 index_t StrideA,
+                 index_t StrideB,
+                 std::array<index_t, NumDTensor> StrideDs,
+                 index_t StrideE,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CDEElementwiseOperation cde_element_op)
+            : p_a_{static_cast<const ADataType*>(p_a)},
+              p_b_{static_cast<const BDataType*>(p_b)},
+              p_ds_{p_ds},
+              p_e_{static_cast<EDataType*>(p_e)},
+              M_{M},
+              N_{N},
+              K_{K},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideDs_{StrideDs},
+              StrideE_{StrideE},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        const ADataType* p_a_;
+        const BDataType* p_b_;
+        std::array<const void*, NumDTensor> p_ds_;
+        EDataType* p_e_;
+
+        index_t M_;
+        index_t N_;
+        index_t K_;
+        index_t StrideA_;
+        index_t StrideB_;
+        std::array<index_t, NumDTensor> StrideDs_;
+        index_t StrideE_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // offset of element (row, col) of a matrix with the given layout and leading dimension
+    template <typename Layout>
+    static std::size_t GetOffset(std::size_t row, std::size_t col, index_t stride)
+    {
+        if constexpr(is_same_v<Layout, tensor_layout::gemm::RowMajor>)
+            return row * stride + col;
+        else
+            return row + col * stride;
+    }
+
+    template <typename Layout>
+    static bool IsValidStride(index_t rows, index_t cols, index_t stride)
+    {
+        constexpr bool row_major = is_same_v<Layout, tensor_layout::gemm::RowMajor>;
+        static_assert(row_major || is_same_v<Layout, tensor_layout::gemm::ColumnMajor>,
+                      "wrong! only row and column major matrices are supported");
+
+        return rows == 0 || cols == 0 || stride >= (row_major ? cols : rows);
+    }
+
+    // whether the HIP runtime has a device, e.g. none on a CPU-only node or with
+    // HIP_VISIBLE_DEVICES= set. Queried once, a failed query counts as no device.
+    static bool HasDevice()
+    {
+        static const bool has_device = [] {
+            int num_devices = 0;
+            if(hipGetDeviceCount(&num_devices) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                return false;
+            }
+            return num_devices > 0;
+        }();
+        return has_device;
+    }
+
+    // false for memory of a device, e.g. a DeviceMem buffer. Pointers HIP does not know are host
+    // memory. Without a device every pointer is, and HIP is not asked about them.
+    static bool IsHostPointer(const void* p)
+    {
+        if(p == nullptr || !HasDevice())
+            return true;
+
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            // resets the last error the failed query leaves behind
+            (void)hipGetLastError();
+            return true;
+        }
+        return attr.type != hipMemoryTypeDevice;
+    }
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        if(arg.M_ < 0 || arg.N_ < 0 || arg.K_ < 0)
+            return false;
+
+        // the factories also return GPU instances, whose arguments point to device memory
+        if(!IsHostPointer(arg.p_a_) || !IsHostPointer(arg.p_b_) || !IsHostPointer(arg.p_e_) ||
+           !std::all_of(arg.p_ds_.begin(), arg.p_ds_.end(), IsHostPointer))
+            return false;
+
+        if(!IsValidStride<ALayout>(arg.M_, arg.K_, arg.StrideA_) ||
+           !IsValidStride<BLayout>(arg.K_, arg.N_, arg.StrideB_) ||
+           !IsValidStride<ELayout>(arg.M_, arg.N_, arg.StrideE_))
+            return false;
+
+        bool valid = true;
+        static_for<0, NumDTensor, 1>{}([&](auto i) {
+            using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
+            valid         = valid && IsValidStride<DLayout>(arg.M_, arg.N_, arg.StrideDs_[i]);
+        });
+        return valid;
+    }
+
+    template <index_t I>
+    static auto LoadD(const Argument& arg, std::size_t m, std::size_t n)
+    {
+        using DLayout   = remove_cvref_t<tuple_element_t<I, DsLayout>>;
+        using DDataType = remove_cvref_t<tuple_element_t<I, DsDataType>>;
+
+        return static_cast<const DDataType*>(
+            arg.p_ds_[I])[GetOffset<DLayout>(m, n, arg.StrideDs_[I])];
+    }
+
+    template <index_t... Is>
+    static void RunCDE(const Argument& arg,
+                       EDataType& e,
+                       const AccDataType& c,
+                       [[maybe_unused]] std::size_t m,
+                       [[maybe_unused]] std::size_t n,
+                       std::integer_sequence<index_t, Is...>)
+    {
+        arg.cde_element_op_(e, c, LoadD<Is>(arg, m, n)...);
+    }
+
+    static void Run(const Argument& arg)
+    {
+        // the element ops are applied while packing, once per element per macro tile
+        auto load_a = [&](std::size_t m, std::size_t k) {
+            AccDataType v_a;
+            arg.a_element_op_(v_a, arg.p_a_[GetOffset<ALayout>(m, k, arg.StrideA_)]);
+            return v_a;
+        };
+
+        auto load_b = [&](std::size_t k, std::size_t n) {
+            AccDataType v_b;
+            arg.b_element_op_(v_b, arg.p_b_[GetOffset<BLayout>(k, n, arg.StrideB_)]);
+            return v_b;
+        };
+
+        auto store_e = [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+            EDataType v_e;
+            RunCDE(arg, v_e, v_acc, m, n, std::make_integer_sequence<index_t, NumDTensor>{});
+            arg.p_e_[GetOffset<ELayout>(m, n, arg.StrideE_)] = v_e;
+        };
+
+        ck::utils::host_blocked_gemm<AccDataType>(
+            arg.M_, arg.N_, arg.K_, load_a, load_b, store_e, Accumulation);
+    }
+
+    // like launch_and_time_kernel: the average time of nrepeat_ runs in ms if time_kernel_ is set
+    static float Run(const Argument& arg, const StreamConfig& stream_config)
+    {
+        if(!stream_config.time_kernel_)
+        {
+            Run(arg);
+            return 0;
+        }
+
+        for(int i = 0; i < stream_config.cold_niters_; ++i)
+            Run(arg);
+
+        const int nrepeat = std::max(stream_config.nrepeat_, 1);
+
+        const auto start = std::chrono::steady_clock::now();
+        for(int i = 0; i < nrepeat; ++i)
+            Run(arg);
+        const auto stop = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<float, std::milli>(stop - start).count() / nrepeat;
+    }
+
+    static const char* GetAccumulationString()
+    {
+        return Accumulation == ck::utils::HostGemmAccumulation::Strict ? "Strict" : "Relaxed";
+    }
+};
+
+template <typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          ck::utils::HostGemmAccumulation Accumulation>
+struct DeviceGemmMultipleDCpu : public DeviceGemmMultipleD<ALayout,
+                                                           BLayout,
+                                                           DsLayout,
+                                                           ELayout,
+                                                           ADataType,
+                                                           BDataType,
+                                                           DsDataType,
+                                                           EDataType,
+                                                           AElementwiseOperation,
+                                                           BElementwiseOperation,
+                                                           CDEElementwiseOperation>
+{
+    using Gemm = CpuGemmMultipleD<ALayout,
+                                  BLayout,
+                                  DsLayout,
+                                  ELayout,
+                                  ADataType,
+                                  BDataType,
+                                  DsDataType,
+                                  EDataType,
+                                  AccDataType,
+                                  AElementwiseOperation,
+                                  BElementwiseOperation,
+                                  CDEElementwiseOperation,
+                                  Accumulation>;
+
+    using Argument = typename Gemm::Argument;
+
+    static constexpr index_t NumDTensor = Gemm::NumDTensor;
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            return Gemm::Run(arg, stream_config);
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg) { return Gemm::IsSupportedArgument(arg); }
+
+    // polymorphic
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const auto* arg = dynamic_cast<const Argument*>(p_arg);
+        return arg != nullptr && IsSupportedArgument(*arg);
+    }
+
+    static auto MakeArgument(const void* p_a,
+                             const void* p_b,
+                             std::array<const void*, NumDTensor> p_ds,
+                             void* p_e,
+                             index_t M,
+                             index_t N,
+                             index_t K,
+                             index_t StrideA,
+                             index_t StrideB,
+                             std::array<index_t, NumDTensor> StrideDs,
+                             index_t StrideE,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_ds,
+                        p_e,
+                        M,
+                        N,
+                        K,
+                        StrideA,
+                        StrideB,
+                        StrideDs,
+                        StrideE,
+                        a_element_op,
+                        b_element_op,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // polymorphic
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_a,
+                        const void* p_b,
+                        std::array<const void*, NumDTensor> p_ds,
+                        void* p_e,
+                        index_t M,
+                        index_t N,
+                        index_t K,
+                        index_t StrideA,
+                        index_t StrideB,
+                        std::array<index_t, NumDTensor> StrideDs,
+                        index_t StrideE,
+                        AElementwiseOperation a_element_op,
+                        BElementwiseOperation b_element_op,
+                        CDEElementwiseOperation cde_element_op) override
+    {
+        return std::make_unique<Argument>(p_a,
+                                          p_b,
+                                          p_ds,
+                                          p_e,
+                                          M,
+                                          N,
+                                          K,
+                                          StrideA,
+                                          StrideB,
+                                          StrideDs,
+                                          StrideE,
+                                          a_element_op,
+                                          b_element_op,
+                                          cde_element_op);
+    }
+
+    // polymorphic
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::size_t GetArgumentSize() const override { return sizeof(Argument); }
+
+    // polymorphic
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return CopyArgumentTo<Argument>(p_arg, p_storage);
+    }
+
+    // polymorphic, the pointers are a, b, ds and e
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<Argument*>(p_arg);
+        if(arg == nullptr || num_pointer != 3 + NumDTensor)
+            return false;
+
+        arg->p_a_ = static_cast<const ADataType*>(p_pointers[0]);
+        arg->p_b_ = static_cast<const BDataType*>(p_pointers[1]);
+        for(index_t i = 0; i < NumDTensor; ++i)
+            arg->p_ds_[i] = p_pointers[2 + i];
+        arg->p_e_ = static_cast<EDataType*>(const_cast<void*>(p_pointers[2 + NumDTensor]));
+        return true;
+    }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGemmMultipleDCpu"
+            << "<"
+            << Gemm::GetAccumulationString()
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          ck::utils::HostGemmAccumulation Accumulation>
+struct DeviceGemmCpu : public DeviceGemm<ALayout,
+                                         BLayout,
+                                         CLayout,
+                                         ADataType,
+                                         BDataType,
+                                         CDataType,
+                                         AElementwiseOperation,
+                                         BElementwiseOperation,
+                                         CElementwiseOperation>
+{
+    using Gemm = CpuGemmMultipleD<ALayout,
+                                  BLayout,
+                                  ck::Tuple<>,
+                                  CLayout,
+                                  ADataType,
+                                  BDataType,
+                                  ck::Tuple<>,
+                                  CDataType,
+                                  AccDataType,
+                                  AElementwiseOperation,
+                                  BElementwiseOperation,
+                                  CElementwiseOperation,
+                                  Accumulation>;
+
+    using Argument = typename Gemm::Argument;
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            return Gemm::Run(arg, stream_config);
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg) { return Gemm::IsSupportedArgument(arg); }
+
+    // polymorphic
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        const auto* arg = dynamic_cast<const Argument*>(p_arg);
+        return arg != nullptr && IsSupportedArgument(*arg);
+    }
+
+    static auto MakeArgument(const void* p_a,
+                             const void* p_b,
+                             void* p_c,
+                             index_t M,
+                             index_t N,
+                             index_t K,
+                             index_t StrideA,
+                             index_t StrideB,
+                             index_t StrideC,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        {},
+                        p_c,
+                        M,
+                        N,
+                        K,
+                        StrideA,
+                        StrideB,
+                        {},
+                        StrideC,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // polymorphic
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
+                                                      const void* p_b,
+                                                      void* p_c,
+                                                      index_t M,
+                                                      index_t N,
+                                                      index_t K,
+                                                      index_t StrideA,
+                                                      index_t StrideB,
+                                                      index_t StrideC,
+                                                      AElementwiseOperation a_element_op,
+                                                      BElementwiseOperation b_element_op,
+                                                      CElementwiseOperation c_element_op) override
+    {
+        return std::make_unique<Argument>(MakeArgument(p_a,
+                                                       p_b,
+                                                       p_c,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       StrideA,
+                                                       StrideB,
+                                                       StrideC,
+                                                       a_element_op,
+                                                       b_element_op,
+                                                       c_element_op));
+    }
+
+    // polymorphic
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::size_t GetArgumentSize() const override { return sizeof(Argument); }
+
+    // polymorphic
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return CopyArgumentTo<Argument>(p_arg, p_storage);
+    }
+
+    // polymorphic, the pointers are a, b and c
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<Argument*>(p_arg);
+        if(arg == nullptr || num_pointer != 3)
+            return false;
+
+        arg->p_a_ = static_cast<const ADataType*>(p_pointers[0]);
+        arg->p_b_ = static_cast<const BDataType*>(p_pointers[1]);
+        arg->p_e_ = static_cast<CDataType*>(const_cast<void*>(p_pointers[2]));
+        return true;
+    }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGemmCpu"
+            << "<"
+            << Gemm::GetAccumulationString()
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+namespace instance {
+
+// The problems the CPU instances are made for. The element ops declare a generic operator() and
+// define only some specializations of it, so whether one can be called is not detectable and the
+// supported types are listed per op.
+
+// Op converts an X operand to the float accumulator, as Op(float&, const X&)
+template <typename Op, typename X>
+inline constexpr bool is_cpu_gemm_input_v = false;
+
+template <typename X>
+inline constexpr bool is_cpu_gemm_input_v<element_wise::PassThrough, X> =
+    is_same_v<X, float> || is_same_v<X, half_t> || is_same_v<X, bhalf_t> || is_same_v<X, int8_t>;
+
+// Op combines the float accumulator with the Ds into E, as Op(E&, const float&, const Ds&...)
+template <typename Op, typename E, typename... Ds>
+inline constexpr bool is_cpu_gemm_output_v = false;
+
+template <typename E>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::PassThrough, E> =
+    is_same_v<E, float> || is_same_v<E, half_t> || is_same_v<E, bhalf_t>;
+
+template <typename E>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::FastGelu, E> =
+    is_same_v<E, float> || is_same_v<E, half_t> || is_same_v<E, bhalf_t>;
+
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::Bilinear, float, float> = true;
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::Bilinear, half_t, half_t> = true;
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::Bilinear, bhalf_t, bhalf_t> = true;
+
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::AddRelu, float, float> = true;
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::AddRelu, float, half_t> = true;
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::AddRelu, half_t, half_t> = true;
+template <>
+inline constexpr bool is_cpu_gemm_output_v<element_wise::AddRelu, bhalf_t, bhalf_t> = true;
+
+// Strict first: it matches the host reference bit for bit, Relaxed lets the compiler use FMA
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+void add_device_gemm_cpu_instances(
+    DeviceOperationInstanceCatalog<DeviceGemm<ALayout,
+                                              BLayout,
+                                              CLayout,
+                                              ADataType,
+                                              BDataType,
+                                              CDataType,
+                                              AElementwiseOperation,
+                                              BElementwiseOperation,
+                                              CElementwiseOperation>>& instances)
+{
+    if constexpr(is_cpu_gemm_input_v<AElementwiseOperation, ADataType> &&
+                 is_cpu_gemm_input_v<BElementwiseOperation, BDataType> &&
+                 is_cpu_gemm_output_v<CElementwiseOperation, CDataType>)
+    {
+        using Strict  = DeviceGemmCpu<ALayout,
+                                     BLayout,
+                                     CLayout,
+                                     ADataType,
+                                     BDataType,
+                                     CDataType,
+                                     float,
+                                     AElementwiseOperation,
+                                     BElementwiseOperation,
+                                     CElementwiseOperation,
+                                     ck::utils::HostGemmAccumulation::Strict>;
+        using Relaxed = DeviceGemmCpu<ALayout,
+                                      BLayout,
+                                      CLayout,
+                                      ADataType,
+                                      BDataType,
+                                      CDataType,
+                                      float,
+                                      AElementwiseOperation,
+                                      BElementwiseOperation,
+                                      CElementwiseOperation,
+                                      ck::utils::HostGemmAccumulation::Relaxed>;
+
+        add_device_operation_instances(instances, std::tuple<Strict, Relaxed>{});
+    }
+}
+
+template <typename Op, typename E, typename DsDataType, index_t... Is>
+constexpr bool is_cpu_gemm_multiple_d_output(std::integer_sequence<index_t, Is...>)
+{
+    return is_cpu_gemm_output_v<Op, E, remove_cvref_t<tuple_element_t<Is, DsDataType>>...>;
+}
+
+template <typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation>
+void add_device_gemm_multiple_d_cpu_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<ALayout,
+                                                    BLayout,
+                                                    DsLayout,
+                                                    ELayout,
+                                                    ADataType,
+                                                    BDataType,
+                                                    DsDataType,
+                                                    EDataType,
+                                                    AElementwiseOperation,
+                                                    BElementwiseOperation,
+                                                    CDEElementwiseOperation>>>& instances)
+{
+    if constexpr(is_cpu_gemm_input_v<AElementwiseOperation, ADataType> &&
+                 is_cpu_gemm_input_v<BElementwiseOperation, BDataType> &&
+                 is_cpu_gemm_multiple_d_output<CDEElementwiseOperation, EDataType, DsDataType>(
+                     std::make_integer_sequence<index_t, DsDataType::Size()>{}))
+    {
+        using Strict  = DeviceGemmMultipleDCpu<ALayout,
+                                              BLayout,
+                                              DsLayout,
+                                              ELayout,
+                                              ADataType,
+                                              BDataType,
+                                              DsDataType,
+                                              EDataType,
+                                              float,
+                                              AElementwiseOperation,
+                                              BElementwiseOperation,
+                                              CDEElementwiseOperation,
+                                              ck::utils::HostGemmAccumulation::Strict>;
+        using Relaxed = DeviceGemmMultipleDCpu<ALayout,
+                                               BLayout,
+                                               DsLayout,
+                                               ELayout,
+                                               ADataType,
+                                               BDataType,
+                                               DsDataType,
+                                               EDataType,
+                                               float,
+                                               AElementwiseOperation,
+                                               BElementwiseOperation,
+                                               CDEElementwiseOperation,
+                                               ck::utils::HostGemmAccumulation::Relaxed>;
+
+        add_device_operation_instances(instances, std::tuple<Strict, Relaxed>{});
+    }
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Picks the instance of DeviceOp for a problem and keeps its argument, so that a serving loop does
+// not search the instances and allocate a new argument on every call.
+//
+// A problem is a shape of NumDim sizes (e.g. M, N, K) and NumPointer buffers. The first time a
+// shape is seen, arguments are made and checked with IsSupportedArgument until an instance fits;
+// the instance, its argument and the buffers are then kept in a hash map keyed by the shape. A
+// later call with the same shape and buffers reuses the argument as it is. With other buffers the
+// argument is rebound by rebind when one is given, otherwise by UpdateArgumentPointers of the
+// instance, and a new argument is made only if that fails. Finding a kept shape, reusing or
+// rebinding its argument and running it do not allocate.
+//
+// Shapes are grouped into buckets by the bit width and the alignment (up to 8) of every size.
+// Instances that were picked for a shape of a bucket are tried first for the other shapes of that
+// bucket, before the remaining instances in their given order, so similar shapes end up on the
+// same instance and usually need a single IsSupportedArgument. Prepare() fills both tables ahead
+// of time.
+//
+// At most max_num_shape shapes are kept; adding another one drops the least recently selected
+// shape and its argument. A Selection stays valid until its shape is dropped, which takes at least
+// max_num_shape selections of other shapes that are not kept, or until its shape is selected again
+// with other buffers that cannot be rebound, which makes a new argument.
+//
+// The dispatcher is not thread safe, use one per thread or stream.
+template <typename DeviceOp, index_t NumDim, index_t NumPointer>
+class DeviceOperationDispatcher
+{
+    static_assert(NumDim > 0 && NumDim <= 8, "a bucket packs 8 bits per size into 64 bits");
+
+    public:
+    using Shape    = std::array<long_index_t, NumDim>;
+    using Pointers = std::array<const void*, NumPointer>;
+
+    // makes the argument of the problem for an instance, e.g. by calling MakeArgumentPointer
+    using ArgumentMaker =
+        std::function<std::unique_ptr<BaseArgument>(DeviceOp&, const Shape&, const Pointers&)>;
+
+    // points an argument made by the instance at other buffers, returns false if it cannot. Only
+    // needed for operators without UpdateArgumentPointers.
+    using ArgumentRebinder = std::function<bool(DeviceOp&, BaseArgument&, const Pointers&)>;
+
+    static constexpr std::size_t default_max_num_shape = 4096;
+
+    struct Selection
+    {
+        // nullptr when no instance supports the problem
+        DeviceOp* op_           = nullptr;
+        BaseArgument* argument_ = nullptr;
+        BaseInvoker* invoker_   = nullptr;
+    };
+
+    // instances in the order of preference, e.g. from the factory, RankInstances or a tuning db
+    DeviceOperationDispatcher(std::vector<std::unique_ptr<DeviceOp>> instances,
+                              ArgumentMaker make_argument,
+                              ArgumentRebinder rebind   = {},
+                              std::size_t max_num_shape = default_max_num_shape)
+        : instances_(std::move(instances)),
+          invokers_(instances_.size()),
+          make_argument_(std::move(make_argument)),
+          rebind_(std::move(rebind)),
+          max_num_shape_(std::max<std::size_t>(max_num_shape, 1))
+    {
+    }
+
+    std::size_t GetNumInstance() const { return instances_.size(); }
+
+    // number of shapes kept, at most max_num_shape
+    std::size_t GetNumShape() const { return shapes_.size(); }
+
+    // number of buckets shapes were selected for
+    std::size_t GetNumBucket() const { return buckets_.size(); }
+
+    // selects an instance for every shape, with null buffers, so the first real calls only rebind.
+    // Of more than max_num_shape shapes only the last max_num_shape are kept.
+    void Prepare(const std::vector<Shape>& shapes)
+    {
+        for(const auto& shape : shapes)
+            Select(shape, Pointers{});
+    }
+
+    Selection Select(const Shape& shape, const Pointers& pointers)
+    {
+        auto it = shapes_.find(shape);
+        if(it == shapes_.end())
+            it = Add(shape, pointers);
+        else
+            lru_.splice(lru_.begin(), lru_, it->second);
+
+        auto& entry = *it->second;
+        if(entry.instance_ < 0)
+            return {};
+
+        auto& op = *instances_[entry.instance_];
+        if(entry.pointers_ != pointers)
+        {
+            if(!Rebind(op, *entry.argument_, pointers))
+                entry.argument_ = make_argument_(op, shape, pointers);
+            entry.pointers_ = pointers;
+        }
+
+        return {&op, entry.argument_.get(), GetInvoker(entry.instance_)};
+    }
+
+    // runs the selected instance, throws if none supports the problem
+    float Run(const Shape& shape, const Pointers& pointers, const StreamConfig& config = {})
+    {
+        const auto selection = Select(shape, pointers);
+        if(selection.op_ == nullptr)
+            throw std::runtime_error("DeviceOperationDispatcher: no instance supports the problem");
+
+        return selection.invoker_->Run(selection.argument_, config);
+    }
+
+    // bit width (clamped to 63) and alignment (1, 2, 4 or 8) of every size, 8 bits each
+    static std::uint64_t GetBucket(const Shape& shape)
+    {
+        std::uint64_t bucket = 0;
+        for(const auto size : shape)
+        {
+            auto x = static_cast<std::uint64_t>(size);
+
+            std::uint64_t width = 0;
+            for(; width < 63 && x >> width != 0; ++width) {}
+
+            std::uint64_t alignment = 0;
+            for(; alignment < 3 && x != 0 && (x >> alignment & 1) == 0; ++alignment) {}
+
+            bucket = bucket << 8 | width << 2 | alignment;
+        }
+        return bucket;
+    }
+
+    private:
+    struct ShapeHash
+    {
+        std::size_t operator()(const Shape& shape) const
+        {
+            std::uint64_t h = 0x243f6a8885a308d3ull;
+            for(const auto size : shape)
+            {
+                h ^= static_cast<std::uint64_t>(size) * 0x9e3779b97f4a7c15ull;
+                h = (h << 31 | h >> 33) * 0xbf58476d1ce4e5b9ull;
+            }
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+    };
+
+    struct Entry
+    {
+        Shape shape_{};
+        // index of the selected instance, -1 if none supports the shape
+        index_t instance_ = -1;
+        std::unique_ptr<BaseArgument> argument_;
+        Pointers pointers_{};
+    };
+
+    // entries from the most to the least recently selected one, splicing them keeps them in place
+    using EntryList = std::list<Entry>;
+    using ShapeMap  = std::unordered_map<Shape, typename EntryList::iterator, ShapeHash>;
+
+    typename ShapeMap::iterator Add(const Shape& shape, const Pointers& pointers)
+    {
+        Entry entry;
+        entry.shape_    = shape;
+        entry.pointers_ = pointers;
+
+        auto is_supported = [&](index_t i) {
+            auto argument = make_argument_(*instances_[i], shape, pointers);
+            if(!argument || !instances_[i]->IsSupportedArgument(argument.get()))
+                return false;
+
+            entry.instance_ = i;
+            entry.argument_ = std::move(argument);
+            return true;
+        };
+
+        // instances that ran other shapes of the bucket go first
+        auto& picked = buckets_[GetBucket(shape)];
+        for(const auto i : picked)
+        {
+            if(is_supported(i))
+                break;
+        }
+
+        for(index_t i = 0; entry.instance_ < 0 && i < static_cast<index_t>(instances_.size()); ++i)
+        {
+            if(std::find(picked.begin(), picked.end(), i) == picked.end() && is_supported(i))
+                picked.push_back(i);
+        }
+
+        // the cache is bounded, workloads with many shapes drop the least recently selected one
+        if(lru_.size() >= max_num_shape_)
+        {
+            shapes_.erase(lru_.back().shape_);
+            lru_.pop_back();
+        }
+
+        lru_.push_front(std::move(entry));
+        return shapes_.emplace(shape, lru_.begin()).first;
+    }
+
+    bool Rebind(DeviceOp& op, BaseArgument& argument, const Pointers& pointers) const
+    {
+        if(rebind_)
+            return rebind_(op, argument, pointers);
+
+        return op.UpdateArgumentPointers(&argument, pointers.data(), pointers.size());
+    }
+
+    BaseInvoker* GetInvoker(index_t i)
+    {
+        if(!invokers_[i])
+            invokers_[i] = instances_[i]->MakeInvokerPointer();
+        return invokers_[i].get();
+    }
+
+    std::vector<std::unique_ptr<DeviceOp>> instances_;
+    std::vector<std::unique_ptr<BaseInvoker>> invokers_;
+    ArgumentMaker make_argument_;
+    ArgumentRebinder rebind_;
+    std::size_t max_num_shape_;
+
+    EntryList lru_;
+    ShapeMap shapes_;
+    // bucket to the instances picked for its shapes, in the order they were picked
+    std::unordered_map<std::uint64_t, std::vector<index_t>> buckets_;
+};
+
+// dispatcher over all instances of DeviceOp built into the library
+template <typename DeviceOp, index_t NumDim, index_t NumPointer>
+DeviceOperationDispatcher<DeviceOp, NumDim, NumPointer> MakeDeviceOperationDispatcher(
+    typename DeviceOperationDispatcher<DeviceOp, NumDim, NumPointer>::ArgumentMaker make_argument,
+    typename DeviceOperationDispatcher<DeviceOp, NumDim, NumPointer>::ArgumentRebinder rebind = {})
+{
+    return {DeviceOperationInstanceFactory<DeviceOp>::GetInstances(),
+            std::move(make_argument),
+            std::move(rebind)};
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Static description of one instance of BaseOp. Descriptors are constexpr objects, one per
+// instance type, so listing the instances of a factory neither constructs nor allocates them.
+template <typename BaseOp>
+struct DeviceOperationInstanceDescriptor
+{
+    // computed on first use and kept for the lifetime of the process
+    const std::string& (*get_type_string_)();
+    std::unique_ptr<BaseOp> (*make_instance_)();
+
+    // type string of the instance, e.g. to recover its tile parameters and specialization with
+    // ParseGemmTileDescription
+    const std::string& GetTypeString() const { return get_type_string_(); }
+
+    std::unique_ptr<BaseOp> MakeInstance() const { return make_instance_(); }
+};
+
+namespace detail {
+
+template <typename BaseOp, typename Op>
+struct device_operation_instance_descriptor_impl
+{
+    static const std::string& GetTypeString()
+    {
+        // instances are stateless, a temporary on the stack prints the same string
+        static const std::string type_string = Op{}.GetTypeString();
+        return type_string;
+    }
+
+    static std::unique_ptr<BaseOp> MakeInstance() { return std::make_unique<Op>(); }
+};
+
+} // namespace detail
+
+template <typename BaseOp, typename Op>
+inline constexpr DeviceOperationInstanceDescriptor<BaseOp> device_operation_instance_descriptor{
+    &detail::device_operation_instance_descriptor_impl<BaseOp, Op>::GetTypeString,
+    &detail::device_operation_instance_descriptor_impl<BaseOp, Op>::MakeInstance};
+
+// Descriptors of the instances of BaseOp, in the order they are added. The add_device_*_instances
+// functions of a family that takes a catalog record their instances into it through
+// add_device_operation_instances, and instances are only constructed by MakeInstance(s), so a
+// caller that needs a few of them does not pay for the rest.
+template <typename BaseOp>
+class DeviceOperationInstanceCatalog
+{
+    public:
+    using Descriptor = DeviceOperationInstanceDescriptor<BaseOp>;
+
+    // runs add_instances(DeviceOperationInstanceCatalog&), e.g. one of the add_device_*_instances
+    // functions, on a new catalog
+    template <typename F>
+    static DeviceOperationInstanceCatalog Collect(F&& add_instances)
+    {
+        DeviceOperationInstanceCatalog catalog;
+        add_instances(catalog);
+        return catalog;
+    }
+
+    void Add(const Descriptor& descriptor) { descriptors_.push_back(&descriptor); }
+
+    std::size_t GetNumInstance() const { return descriptors_.size(); }
+
+    const Descriptor& GetDescriptor(std::size_t i) const { return *descriptors_.at(i); }
+
+    std::unique_ptr<BaseOp> MakeInstance(std::size_t i) const
+    {
+        return descriptors_.at(i)->MakeInstance();
+    }
+
+    // constructs the instances for which pred(descriptor) is true, in catalog order
+    template <typename Pred>
+    std::vector<std::unique_ptr<BaseOp>> MakeInstances(Pred&& pred) const
+    {
+        std::vector<std::unique_ptr<BaseOp>> op_instances;
+        for(const auto* descriptor : descriptors_)
+        {
+            if(pred(*descriptor))
+                op_instances.push_back(descriptor->MakeInstance());
+        }
+        return op_instances;
+    }
+
+    std::vector<std::unique_ptr<BaseOp>> MakeInstances() const
+    {
+        return MakeInstances([](const Descriptor&) { return true; });
+    }
+
+    private:
+    std::vector<const Descriptor*> descriptors_;
+};
+
+// catalog of all instances of DeviceOp built into the library, collected once from the
+// AddInstances of its factory
+template <typename DeviceOp>
+const DeviceOperationInstanceCatalog<DeviceOp>& GetDeviceOperationInstanceCatalog()
+{
+    static const auto catalog = DeviceOperationInstanceCatalog<DeviceOp>::Collect(
+        DeviceOperationInstanceFactory<DeviceOp>::AddInstances);
+    return catalog;
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <dlfcn.h>
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ck/utility/env.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+
+// directories searched for instance plugins before the install directory, separated by ':'
+CK_DECLARE_ENV_VAR_STR(CK_DEVICE_OPERATION_PLUGIN_PATH)
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Instances of the op families built as shared plugins (CK_DEVICE_OPERATION_PLUGINS=ON), one
+// libdevice_<family>_plugin.so per family. A plugin is loaded the first time one of its factories
+// is queried. Its entry point ck_device_operation_plugin_register adds, for every DeviceOp of the
+// family, a function that adds its instances like GetInstances does.
+//
+// Plugins must be built with the same compiler and standard library as the process, they exchange
+// C++ objects. They are never unloaded, the instances and descriptors they make live in them. A
+// plugin that cannot be loaded leaves its family without instances, like a library built without
+// them, and is reported once on stderr.
+class DeviceOperationPluginRegistry
+{
+    public:
+    static DeviceOperationPluginRegistry& Get()
+    {
+        static DeviceOperationPluginRegistry registry;
+        return registry;
+    }
+
+    static std::string GetPluginFileName(const std::string& family)
+    {
+        return "libdevice_" + family + "_plugin.so";
+    }
+
+    // CK_DEVICE_OPERATION_PLUGIN_PATH, then the install directory, then the default search path of
+    // dlopen (e.g. LD_LIBRARY_PATH)
+    static std::vector<std::string> GetSearchPath()
+    {
+        std::vector<std::string> dirs;
+
+        std::istringstream iss(ck::EnvGetString(CK_ENV(CK_DEVICE_OPERATION_PLUGIN_PATH)));
+        for(std::string dir; std::getline(iss, dir, ':');)
+        {
+            if(!dir.empty())
+                dirs.push_back(dir);
+        }
+
+#ifdef CK_DEVICE_OPERATION_PLUGIN_DIR
+        dirs.push_back(CK_DEVICE_OPERATION_PLUGIN_DIR);
+#endif
+        dirs.push_back("");
+        return dirs;
+    }
+
+    // loads the plugin of family unless it is loaded, returns false if it cannot be loaded
+    bool Load(const std::string& family)
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        if(IsLoaded(family))
+            return true;
+
+        // a failure is not retried, so it is reported once and costs no dlopen on every query
+        if(failed_.count(family) != 0)
+            return false;
+
+        auto fail = [&](const std::string& message) {
+            std::cerr << "DeviceOperationPluginRegistry: " << message << std::endl;
+            failed_.insert(family);
+            return false;
+        };
+
+        const auto file_name = GetPluginFileName(family);
+
+        void* handle = nullptr;
+        std::string errors;
+        for(const auto& dir : GetSearchPath())
+        {
+            const auto path = dir.empty() ? file_name : dir + "/" + file_name;
+
+            handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if(handle != nullptr)
+                break;
+
+            const char* error = dlerror();
+            errors += "\n  " + (error != nullptr ? std::string(error) : path);
+        }
+
+        if(handle == nullptr)
+            return fail("cannot load " + file_name + errors);
+
+        using EntryPoint = void (*)(DeviceOperationPluginRegistry&);
+        const auto entry_point =
+            reinterpret_cast<EntryPoint>(dlsym(handle, "ck_device_operation_plugin_register"));
+        if(entry_point == nullptr)
+            return fail(file_name + " has no ck_device_operation_plugin_register");
+
+        entry_point(*this);
+
+        std::lock_guard<std::mutex> entries_lock(mutex_);
+        loaded_.insert(family);
+        return true;
+    }
+
+    bool IsLoaded(const std::string& family) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return loaded_.count(family) != 0;
+    }
+
+    // called by a plugin. add_instances(DeviceOperationInstanceCatalog<DeviceOp>&) records the
+    // descriptors of instances of DeviceOp, like the add_device_*_instances functions of a family
+    // that takes a catalog. Families that do not record into a catalog yet pass
+    // add_instances(std::vector<std::unique_ptr<DeviceOp>>&), their instances cannot be catalogued.
+    template <typename DeviceOp, typename F>
+    void Add(const std::string& family, F add_instances)
+    {
+        using Catalog     = DeviceOperationInstanceCatalog<DeviceOp>;
+        using OpInstances = std::vector<std::unique_ptr<DeviceOp>>;
+
+        // instantiated in the plugin, so the descriptors and instances are made by its code
+        Entry entry;
+        if constexpr(std::is_invocable_v<F&, Catalog&>)
+        {
+            entry.add_descriptors_ = [add_instances](void* p_catalog) {
+                add_instances(*static_cast<Catalog*>(p_catalog));
+            };
+        }
+        else
+        {
+            static_assert(std::is_invocable_v<F&, OpInstances&>,
+                          "add_instances takes a catalog or a vector of instances of DeviceOp");
+
+            entry.add_instances_ = [add_instances](void* p_op_instances) {
+                add_instances(*static_cast<OpInstances*>(p_op_instances));
+            };
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[GetKey<DeviceOp>(family)].push_back(std::move(entry));
+    }
+
+    // adds the instances of DeviceOp of a loaded family
+    template <typename DeviceOp>
+    void AddInstances(const std::string& family,
+                      std::vector<std::unique_ptr<DeviceOp>>& op_instances) const
+    {
+        for(const auto& entry : GetEntries<DeviceOp>(family))
+        {
+            if(entry.add_descriptors_)
+            {
+                DeviceOperationInstanceCatalog<DeviceOp> catalog;
+                entry.add_descriptors_(&catalog);
+                for(auto& op_instance : catalog.MakeInstances())
+                    op_instances.push_back(std::move(op_instance));
+            }
+            else
+            {
+                entry.add_instances_(&op_instances);
+            }
+        }
+    }
+
+    // records the descriptors of the instances of DeviceOp of a loaded family in catalog, throws if
+    // the family adds them to a vector
+    template <typename DeviceOp>
+    void AddDescriptors(const std::string& family,
+                        DeviceOperationInstanceCatalog<DeviceOp>& catalog) const
+    {
+        for(const auto& entry : GetEntries<DeviceOp>(family))
+        {
+            if(!entry.add_descriptors_)
+                throw std::runtime_error("DeviceOperationPluginRegistry: " + family +
+                                         " does not record its instances in a catalog");
+
+            entry.add_descriptors_(&catalog);
+        }
+    }
+
+    private:
+    // one of the two is set
+    struct Entry
+    {
+        std::function<void(void*)> add_instances_;
+        std::function<void(void*)> add_descriptors_;
+    };
+
+    template <typename DeviceOp>
+    std::vector<Entry> GetEntries(const std::string& family) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(GetKey<DeviceOp>(family));
+        return it != entries_.end() ? it->second : std::vector<Entry>{};
+    }
+
+    // type_info objects are not shared with a plugin loaded with RTLD_LOCAL, their names are
+    template <typename DeviceOp>
+    static std::string GetKey(const std::string& family)
+    {
+        return family + ":" + typeid(DeviceOp).name();
+    }
+
+    // serializes loading, the entry point of a plugin calls Add
+    std::mutex load_mutex_;
+    // families whose plugin could not be loaded, guarded by load_mutex_
+    std::unordered_set<std::string> failed_;
+    mutable std::mutex mutex_;
+    std::unordered_set<std::string> loaded_;
+    std::unordered_map<std::string, std::vector<Entry>> entries_;
+};
+
+// instances of DeviceOp in the plugin of family, loaded on first use, none if it cannot be loaded
+template <typename DeviceOp>
+std::vector<std::unique_ptr<DeviceOp>> GetDeviceOperationPluginInstances(const std::string& family)
+{
+    auto& registry = DeviceOperationPluginRegistry::Get();
+
+    std::vector<std::unique_ptr<DeviceOp>> op_instances;
+    if(registry.Load(family))
+        registry.AddInstances(family, op_instances);
+    return op_instances;
+}
+
+// catalog of the instances of DeviceOp in the plugin of family, loaded on first use, empty if it
+// cannot be loaded
+template <typename DeviceOp>
+DeviceOperationInstanceCatalog<DeviceOp> GetDeviceOperationPluginCatalog(const std::string& family)
+{
+    auto& registry = DeviceOperationPluginRegistry::Get();
+
+    DeviceOperationInstanceCatalog<DeviceOp> catalog;
+    if(registry.Load(family))
+        registry.AddDescriptors(family, catalog);
+    return catalog;
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// defined by every plugin
+extern "C" __attribute__((visibility("default"))) void ck_device_operation_plugin_register(
+    ck::tensor_operation::device::instance::DeviceOperationPluginRegistry& registry);
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <typename T>
+inline std::string GetTuningDataTypeString()
+{
+    if constexpr(is_same_v<T, double>)
+        return "f64";
+    else if constexpr(is_same_v<T, float>)
+        return "f32";
+    else if constexpr(is_same_v<T, half_t>)
+        return "f16";
+    else if constexpr(is_same_v<T, bhalf_t>)
+        return "bf16";
+    else if constexpr(is_same_v<T, int8_t>)
+        return "i8";
+    else if constexpr(is_same_v<T, int32_t>)
+        return "i32";
+    else if constexpr(is_same_v<T, f8_t>)
+        return "f8";
+    else if constexpr(is_same_v<T, bf8_t>)
+        return "bf8";
+    else
+        return "unknown";
+}
+
+// Identifies one tuned problem: the operation, its data types and layouts, the problem sizes and
+// the architecture the timing was taken on. Fields must not contain tabs or newlines.
+struct DeviceOperationTuningKey
+{
+    std::string op_name_;
+    std::string data_types_;
+    std::string layouts_;
+    std::vector<long_index_t> problem_;
+    std::string arch_;
+
+    std::string Serialize() const
+    {
+        std::ostringstream oss;
+
+        oss << op_name_ << '\t' << data_types_ << '\t' << layouts_ << '\t';
+        for(std::size_t i = 0; i < problem_.size(); ++i)
+            oss << (i == 0 ? "" : ",") << problem_[i];
+        oss << '\t' << arch_;
+
+        return oss.str();
+    }
+};
+
+struct DeviceOperationTuningRecord
+{
+    // GetTypeString() of the fastest instance
+    std::string instance_;
+    float ave_time_ = 0;
+    float tflops_   = 0;
+};
+
+// On-disk map from DeviceOperationTuningKey to the fastest instance found by the profiler.
+//
+// The file is plain text with one record per line:
+//   op, data types, layouts, problem sizes, arch, instance, ms, TFlops
+// separated by tabs. Lines starting with '#' and malformed lines are ignored. Save() merges with
+// the records currently on disk, keeping the faster one per key, so tuning runs can share a file.
+// Saves are serialized by an exclusive flock on the sibling file <path>.lock.
+class DeviceOperationTuningDb
+{
+    public:
+    DeviceOperationTuningDb() = default;
+
+    explicit DeviceOperationTuningDb(std::string path) : path_(std::move(path)) { Load(); }
+
+    const std::string& GetPath() const { return path_; }
+
+    std::size_t GetNumRecord() const { return records_.size(); }
+
+    // (re)reads the records of the file, a missing file leaves the db empty and returns false
+    bool Load()
+    {
+        records_.clear();
+        return Read(path_, records_);
+    }
+
+    bool Save() const
+    {
+        // held from reading the file to the rename, so no writer drops the records of another
+        const FileLock lock(path_ + ".lock");
+        if(!lock.IsLocked())
+            return false;
+
+        std::map<std::string, DeviceOperationTuningRecord> merged;
+        Read(path_, merged);
+
+        for(const auto& [key, record] : records_)
+            Merge(merged, key, record);
+
+        // write a sibling file and rename it over the db, so readers never see a partial file;
+        // unique per process and thread like the files of HostReferenceCache::Store
+        const auto thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        std::string tmp_path   = path_ + ".tmp." + std::to_string(thread_hash);
+#ifndef _WIN32
+        tmp_path += '.' + std::to_string(::getpid());
+#endif
+        {
+            std::ofstream file(tmp_path, std::ios::trunc);
+            if(!file)
+                return false;
+
+            file << "# op\tdata types\tlayouts\tproblem\tarch\tinstance\tms\tTFlops\n";
+            for(const auto& [key, record] : merged)
+                file << key << '\t' << record.instance_ << '\t' << record.ave_time_ << '\t'
+                     << record.tflops_ << '\n';
+
+            if(!file.flush())
+            {
+                std::remove(tmp_path.c_str());
+                return false;
+            }
+        }
+
+        if(std::rename(tmp_path.c_str(), path_.c_str()) != 0)
+        {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<DeviceOperationTuningRecord> Find(const DeviceOperationTuningKey& key) const
+    {
+        const auto found = records_.find(key.Serialize());
+        if(found == records_.end())
+            return std::nullopt;
+
+        return found->second;
+    }
+
+    // records the instance if the key is new or it is strictly faster than the recorded one;
+    // returns whether the db was changed
+    bool Update(const DeviceOperationTuningKey& key, const DeviceOperationTuningRecord& record)
+    {
+        return Merge(records_, key.Serialize(), record);
+    }
+
+    private:
+    // Exclusive flock of a file for the lifetime of the object. flock locks belong to the open
+    // file, so two DeviceOperationTuningDb objects of one process exclude each other as well.
+    class FileLock
+    {
+        public:
+        explicit FileLock(const std::string& path)
+        {
+#ifndef _WIN32
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if(fd_ >= 0 && ::flock(fd_, LOCK_EX) != 0)
+            {
+                ::close(fd_);
+                fd_ = -1;
+            }
+#else
+            (void)path;
+#endif
+        }
+
+        FileLock(const FileLock&) = delete;
+        FileLock& operator=(const FileLock&) = delete;
+
+        ~FileLock()
+        {
+#ifndef _WIN32
+            if(fd_ >= 0)
+                ::close(fd_);
+#endif
+        }
+
+#ifndef _WIN32
+        bool IsLocked() const { return fd_ >= 0; }
+#else
+        bool IsLocked() const { return true; }
+#endif
+
+        private:
+        int fd_ = -1;
+    };
+
+    static bool Merge(std::map<std::string, DeviceOperationTuningRecord>& records,
+                      const std::string& key,
+                      const DeviceOperationTuningRecord& record)
+    {
+        auto [it, inserted] = records.emplace(key, record);
+        if(inserted)
+            return true;
+
+        if(record.ave_time_ < it->second.ave_time_)
+        {
+            it->second = record;
+            return true;
+        }
+
+        return false;
+    }
+
+    static bool Read(const std::string& path,
+                     std::map<std::string, DeviceOperationTuningRecord>& records)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return false;
+
+        std::string line;
+        while(std::getline(file, line))
+        {
+            if(line.empty() || line[0] == '#')
+                continue;
+
+            std::vector<std::string> fields;
+            std::istringstream iss(line);
+            for(std::string field; std::getline(iss, field, '\t');)
+                fields.push_back(field);
+
+            if(fields.size() != 8)
+                continue;
+
+            DeviceOperationTuningRecord record;
+            record.instance_ = fields[5];
+            try
+            {
+                record.ave_time_ = std::stof(fields[6]);
+                record.tflops_   = std::stof(fields[7]);
+            }
+            catch(const std::exception&)
+            {
+                continue;
+            }
+
+            std::string key = fields[0];
+            for(std::size_t i = 1; i < 5; ++i)
+                key += '\t' + fields[i];
+
+            Merge(records, key, record);
+        }
+
+        return true;
+    }
+
+    std::string path_;
+    std::map<std::string, DeviceOperationTuningRecord> records_;
+};
+
+// index of the instance whose GetTypeString() is type_string
+template <typename OpPtrs>
+std::optional<std::size_t> FindInstanceByTypeString(const OpPtrs& op_ptrs,
+                                                    const std::string& type_string)
+{
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+    {
+        if(op_ptrs[i]->GetTypeString() == type_string)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+// Returns the instance that the db recorded as fastest for the key, or nullptr if the key was never
+// tuned or the recorded instance is not built into this library.
+template <typename DeviceOp>
+std::unique_ptr<DeviceOp> GetTunedInstance(const DeviceOperationTuningDb& db,
+                                           const DeviceOperationTuningKey& key)
+{
+    const auto record = db.Find(key);
+    if(!record)
+        return nullptr;
+
+    auto op_ptrs = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    const auto id = FindInstanceByTypeString(op_ptrs, record->instance_);
+    if(!id)
+        return nullptr;
+
+    return std::move(op_ptrs[*id]);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
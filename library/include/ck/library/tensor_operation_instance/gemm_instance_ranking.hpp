@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Tile parameters of an XDL GEMM instance, as printed by its GetTypeString()
+struct GemmTileDescription
+{
+    long_index_t block_size_     = 0;
+    long_index_t m_per_block_    = 0;
+    long_index_t n_per_block_    = 0;
+    long_index_t k_per_block_    = 0;
+    long_index_t m_per_xdl_      = 0;
+    long_index_t n_per_xdl_      = 0;
+    long_index_t m_xdl_per_wave_ = 0;
+    long_index_t n_xdl_per_wave_ = 0;
+
+    // from the GemmSpecialization
+    bool pad_m_ = false;
+    bool pad_n_ = false;
+    bool pad_k_ = false;
+};
+
+struct GemmRankingProblem
+{
+    long_index_t M_ = 0;
+    long_index_t N_ = 0;
+    long_index_t K_ = 0;
+
+    // element sizes in bytes
+    long_index_t a_bytes_ = 2;
+    long_index_t b_bytes_ = 2;
+
+    long_index_t num_cu_ = 304;
+
+    // flop per byte of A/B tile traffic at which a CU stops being bandwidth bound
+    double cu_flop_per_byte_ = 64;
+};
+
+// Factors of the analytic cost model, each in [0, 1]. score_ is their product, an estimate of the
+// fraction of peak throughput the instance reaches on the problem.
+struct GemmInstanceScore
+{
+    bool applicable_             = false;
+    double padding_efficiency_   = 0; // useful flop over flop of the padded problem
+    double cu_efficiency_        = 0; // busy CUs over all CUs, averaged over the tile waves
+    double intensity_efficiency_ = 0; // block tile arithmetic intensity against cu_flop_per_byte_
+    double wave_efficiency_      = 0; // reuse of LDS reads by the per-wave XDL tile
+    double pipeline_efficiency_  = 0; // main loop iterations over iterations plus prologue/epilogue
+    double score_                = 0;
+};
+
+namespace detail {
+
+inline std::string gemm_ranking_trim(const std::string& s)
+{
+    const auto begin = s.find_first_not_of(' ');
+    const auto end   = s.find_last_not_of(' ');
+    return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+inline std::vector<std::string> gemm_ranking_split(const std::string& s, char delim)
+{
+    std::vector<std::string> tokens;
+    std::istringstream iss(s);
+    for(std::string token; std::getline(iss, token, delim);)
+        tokens.push_back(gemm_ranking_trim(token));
+    return tokens;
+}
+
+inline std::optional<long_index_t> gemm_ranking_to_int(const std::string& s)
+{
+    const auto is_digit = [](unsigned char c) { return std::isdigit(c) != 0; };
+    if(s.empty() || !std::all_of(s.begin(), s.end(), is_digit))
+        return std::nullopt;
+    return std::stoll(s);
+}
+
+// "Default", "MPadding", "MNKPadding", ...
+inline bool gemm_ranking_parse_spec(const std::string& s, GemmTileDescription& desc)
+{
+    if(s == "Default")
+        return true;
+
+    const std::string suffix = "Padding";
+    if(s.size() <= suffix.size() || s.compare(s.size() - suffix.size(), suffix.size(), suffix) != 0)
+        return false;
+
+    const std::string dims = s.substr(0, s.size() - suffix.size());
+    desc.pad_m_            = dims.find('M') != std::string::npos;
+    desc.pad_n_            = dims.find('N') != std::string::npos;
+    desc.pad_k_            = dims.find('K') != std::string::npos;
+    return true;
+}
+
+// value of "<key>: <value>," in the part of the type string after the template arguments
+inline std::vector<std::string> gemm_ranking_find_field(const std::string& s,
+                                                        const std::string& key)
+{
+    const auto pos = s.find(key + ": ");
+    if(pos == std::string::npos)
+        return {};
+
+    const auto begin = pos + key.size() + 2;
+    const auto end   = s.find(',', begin);
+    return gemm_ranking_split(s.substr(begin, end == std::string::npos ? end : end - begin), 'x');
+}
+
+inline std::size_t gemm_ranking_integer_divide_ceil(long_index_t x, long_index_t y)
+{
+    return static_cast<std::size_t>((x + y - 1) / y);
+}
+
+} // namespace detail
+
+// Recovers the tile parameters from the type string of DeviceGemm_Xdl_CShuffle(V2),
+// DeviceGemmMultipleD_Xdl_CShuffle and DeviceGemmXdlUniversal instances. Returns nothing for other
+// instances.
+inline std::optional<GemmTileDescription> ParseGemmTileDescription(const std::string& type_string)
+{
+    const auto open  = type_string.find('<');
+    const auto close = type_string.find('>', open);
+    if(open == std::string::npos || close == std::string::npos)
+        return std::nullopt;
+
+    const std::string name = type_string.substr(0, open);
+    const auto args =
+        detail::gemm_ranking_split(type_string.substr(open + 1, close - open - 1), ',');
+
+    GemmTileDescription desc;
+    std::vector<long_index_t> values;
+
+    if(name == "DeviceGemm_Xdl_CShuffle" || name == "DeviceGemm_Xdl_CShuffleV2" ||
+       name == "DeviceGemmMultipleD_Xdl_CShuffle")
+    {
+        // <[Spec,] BlockSize, MPerBlock, NPerBlock, KPerBlock, AK1, BK1, MPerXDL, NPerXDL,
+        //  MXdlPerWave, NXdlPerWave, ...[, Spec]>
+        const std::size_t spec_id = name == "DeviceGemmMultipleD_Xdl_CShuffle" ? 14 : 0;
+        const std::size_t first   = spec_id == 0 ? 1 : 0;
+
+        if(args.size() < 15 || !detail::gemm_ranking_parse_spec(args[spec_id], desc))
+            return std::nullopt;
+
+        for(std::size_t i : {0, 1, 2, 3, 6, 7, 8, 9})
+            if(const auto v = detail::gemm_ranking_to_int(args[first + i]))
+                values.push_back(*v);
+    }
+    else if(name == "DeviceGemmXdlUniversal")
+    {
+        // <Spec, Layouts> BlkSize: 256, BlkTile: 256x128x64, WaveTile: 32x32, WaveMap: 4x2, ...
+        if(args.empty() || !detail::gemm_ranking_parse_spec(args[0], desc))
+            return std::nullopt;
+
+        const std::string fields = type_string.substr(close + 1);
+        for(const auto& key : {"BlkSize", "BlkTile", "WaveTile", "WaveMap"})
+            for(const auto& token : detail::gemm_ranking_find_field(fields, key))
+                if(const auto v = detail::gemm_ranking_to_int(token))
+                    values.push_back(*v);
+    }
+
+    if(values.size() != 8 ||
+       std::any_of(values.begin(), values.end(), [](long_index_t v) { return v <= 0; }))
+        return std::nullopt;
+
+    desc.block_size_     = values[0];
+    desc.m_per_block_    = values[1];
+    desc.n_per_block_    = values[2];
+    desc.k_per_block_    = values[3];
+    desc.m_per_xdl_      = values[4];
+    desc.n_per_xdl_      = values[5];
+    desc.m_xdl_per_wave_ = values[6];
+    desc.n_xdl_per_wave_ = values[7];
+
+    return desc;
+}
+
+// Host-only analytic estimate of how well an instance fits a problem. It is meant to order
+// instances before timing them, not to predict absolute performance.
+inline GemmInstanceScore ScoreGemmInstance(const GemmTileDescription& desc,
+                                           const GemmRankingProblem& problem)
+{
+    GemmInstanceScore score;
+
+    const long_index_t M = problem.M_;
+    const long_index_t N = problem.N_;
+    const long_index_t K = problem.K_;
+
+    // the same divisibility rule as codegen's GetGemmSpec: unpadded dims must be tile multiples
+    if((!desc.pad_m_ && M % desc.m_per_block_ != 0) ||
+       (!desc.pad_n_ && N % desc.n_per_block_ != 0) ||
+       (!desc.pad_k_ && K % desc.k_per_block_ != 0) || M <= 0 || N <= 0 || K <= 0)
+        return score;
+
+    const std::size_t num_m_tile = detail::gemm_ranking_integer_divide_ceil(M, desc.m_per_block_);
+    const std::size_t num_n_tile = detail::gemm_ranking_integer_divide_ceil(N, desc.n_per_block_);
+    const std::size_t num_k_loop = detail::gemm_ranking_integer_divide_ceil(K, desc.k_per_block_);
+
+    score.padding_efficiency_ =
+        static_cast<double>(M) / static_cast<double>(num_m_tile * desc.m_per_block_) *
+        static_cast<double>(N) / static_cast<double>(num_n_tile * desc.n_per_block_) *
+        static_cast<double>(K) / static_cast<double>(num_k_loop * desc.k_per_block_);
+
+    // one tile per CU at a time, the last round of tiles may leave CUs idle
+    const std::size_t num_cu = static_cast<std::size_t>(std::max<long_index_t>(problem.num_cu_, 1));
+
+    const std::size_t num_tile  = num_m_tile * num_n_tile;
+    const std::size_t num_round = (num_tile + num_cu - 1) / num_cu;
+
+    score.cu_efficiency_ = static_cast<double>(num_tile) / static_cast<double>(num_round * num_cu);
+
+    const double m_tile = static_cast<double>(desc.m_per_block_);
+    const double n_tile = static_cast<double>(desc.n_per_block_);
+    const double tile_flop_per_byte =
+        2 * m_tile * n_tile /
+        (m_tile * static_cast<double>(problem.a_bytes_) +
+         n_tile * static_cast<double>(problem.b_bytes_));
+    score.intensity_efficiency_ = std::min(1.0, tile_flop_per_byte / problem.cu_flop_per_byte_);
+
+    // waves must cover the block tile; a 64x64 output per wave fully hides its LDS reads
+    const long_index_t m_per_wave = desc.m_per_xdl_ * desc.m_xdl_per_wave_;
+    const long_index_t n_per_wave = desc.n_per_xdl_ * desc.n_xdl_per_wave_;
+    if(desc.m_per_block_ % m_per_wave != 0 || desc.n_per_block_ % n_per_wave != 0 ||
+       (desc.m_per_block_ / m_per_wave) * (desc.n_per_block_ / n_per_wave) * 64 != desc.block_size_)
+        return score;
+
+    const double wave_flop_per_element = 2 * static_cast<double>(m_per_wave * n_per_wave) /
+                                         static_cast<double>(m_per_wave + n_per_wave);
+    score.wave_efficiency_ = std::min(1.0, wave_flop_per_element / 64);
+
+    // prologue and C shuffle epilogue cost about two main loop iterations
+    score.pipeline_efficiency_ =
+        static_cast<double>(num_k_loop) / static_cast<double>(num_k_loop + 2);
+
+    score.score_ = score.padding_efficiency_ * score.cu_efficiency_ * score.intensity_efficiency_ *
+                   score.wave_efficiency_ * score.pipeline_efficiency_;
+
+    score.applicable_ = true;
+
+    return score;
+}
+
+// Orders instances by descending ScoreGemmInstance() and keeps the top_k best (all of them if
+// top_k is 0). Instances the model cannot describe are appended after the ranked ones, since
+// they can not be judged; instances that cannot run the problem are dropped.
+inline std::vector<std::size_t> RankGemmInstances(const std::vector<std::string>& type_strings,
+                                                  const GemmRankingProblem& problem,
+                                                  std::size_t top_k)
+{
+    std::vector<std::pair<double, std::size_t>> ranked;
+    std::vector<std::size_t> unknown;
+
+    for(std::size_t i = 0; i < type_strings.size(); ++i)
+    {
+        const auto desc = ParseGemmTileDescription(type_strings[i]);
+        if(!desc)
+        {
+            unknown.push_back(i);
+            continue;
+        }
+
+        const auto score = ScoreGemmInstance(*desc, problem);
+        if(score.applicable_)
+            ranked.emplace_back(score.score_, i);
+    }
+
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& x, const auto& y) {
+        return x.first > y.first;
+    });
+
+    if(top_k != 0 && ranked.size() > top_k)
+        ranked.resize(top_k);
+
+    std::vector<std::size_t> ids;
+    for(const auto& r : ranked)
+        ids.push_back(r.second);
+    ids.insert(ids.end(), unknown.begin(), unknown.end());
+
+    return ids;
+}
+
+// indices into op_ptrs, see RankGemmInstances
+template <typename OpPtrs>
+std::vector<std::size_t>
+RankInstances(const OpPtrs& op_ptrs, const GemmRankingProblem& problem, std::size_t top_k)
+{
+    std::vector<std::string> type_strings;
+    for(const auto& op_ptr : op_ptrs)
+        type_strings.push_back(op_ptr->GetTypeString());
+
+    return RankGemmInstances(type_strings, problem, top_k);
+}
+
+// the top_k instances of the factory for the problem, best first
+template <typename DeviceOp>
+std::vector<std::unique_ptr<DeviceOp>> GetRankedInstances(const GemmRankingProblem& problem,
+                                                          std::size_t top_k)
+{
+    auto op_ptrs = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    std::vector<std::unique_ptr<DeviceOp>> ranked;
+    for(std::size_t id : RankInstances(op_ptrs, problem, top_k))
+        ranked.push_back(std::move(op_ptrs[id]));
+
+    return ranked;
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -11,6 +11,10 @@
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
 
+#ifdef CK_USE_CPU_INSTANCES
+#include "ck/library/tensor_operation_instance/cpu/device_gemm_cpu.hpp"
+#endif
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -106,6 +110,9 @@ struct DeviceOperationInstanceFactory<
         }
 #endif
 
+#ifdef CK_USE_CPU_INSTANCES
+        add_device_gemm_multiple_d_cpu_instances(op_ptrs);
+#endif
         return op_ptrs;
     }
 };
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -12,6 +12,10 @@
 
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 
+#ifdef CK_USE_CPU_INSTANCES
+#include "ck/library/tensor_operation_instance/cpu/device_gemm_cpu.hpp"
+#endif
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -215,6 +219,10 @@ struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGemmMu
             }
         }
 #endif
+
+#ifdef CK_USE_CPU_INSTANCES
+        add_device_gemm_multiple_d_cpu_instances(op_ptrs);
+#endif
         return op_ptrs;
     }
 };
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -10,6 +10,10 @@
 #include "ck/ck.hpp"
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+
+#ifdef CK_USE_CPU_INSTANCES
+#include "ck/library/tensor_operation_instance/cpu/device_gemm_cpu.hpp"
+#endif
 #ifdef CK_ENABLE_FP16
 namespace ck {
 namespace tensor_operation {
@@ -128,6 +132,9 @@ struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGemmMu
             }
         }
 
+#ifdef CK_USE_CPU_INSTANCES
+        add_device_gemm_multiple_d_cpu_instances(op_ptrs);
+#endif
         return op_ptrs;
     }
 };
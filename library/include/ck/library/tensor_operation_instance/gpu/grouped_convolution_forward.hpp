@@ -11,6 +11,9 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#ifdef CK_DEVICE_OPERATION_PLUGINS
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+#endif
 
 #ifdef DL_KERNELS
 #include "grouped_convolution_forward_dl.inc"
@@ -68,10 +71,10 @@ struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGroupe
                                         AComputeType,
                                         BComputeType>;
 
-    static auto GetInstances()
+    // adds the instances built into the library, shared by GetInstances and the grouped_conv3d_fwd
+    // plugin, which must not call GetInstances as it forwards to the plugin
+    static void AddLibraryInstances(std::vector<std::unique_ptr<DeviceOp>>& op_ptrs)
     {
-        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
-
 #ifdef DL_KERNELS
         if constexpr(NumDimSpatial == 2 && is_same_v<InLayout, GNHWC> &&
                      is_same_v<WeiLayout, GKYXC> && is_same_v<OutLayout, GNHWK>)
@@ -442,8 +445,21 @@ struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGroupe
 #endif
         }
 #endif
+    }
 
-        return op_ptrs;
+    static auto GetInstances()
+    {
+#ifdef CK_DEVICE_OPERATION_PLUGINS
+        // the 3d instances are loaded from the grouped_conv3d_fwd plugin
+        if constexpr(NumDimSpatial == 3)
+            return GetDeviceOperationPluginInstances<DeviceOp>("grouped_conv3d_fwd");
+        else
+#endif
+        {
+            std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+            AddLibraryInstances(op_ptrs);
+            return op_ptrs;
+        }
     }
 };
 
@@ -1,11 +1,12 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_reduce_multiblock.hpp"
 
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance_impl_common.hpp"
 
@@ -119,8 +120,8 @@ void add_device_reduce_instance_blockwise(
                                                cfg2::InSrcVectorSize_,
                                                cfg2::OutDstVectorSize_>;
 
-                    device_op_instances.push_back(
-                        std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+                    add_device_operation_instances(device_op_instances,
+                                                   std::make_tuple(ReduceOpInstance{}));
                 });
         });
 };
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -10,12 +10,85 @@
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 #include "ck/tensor_operation/gpu/device/device_softmax.hpp"
 #include "ck/library/tensor_operation_instance/gpu/softmax/device_softmax_instance.hpp"
+#ifdef CK_DEVICE_OPERATION_PLUGINS
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+#endif
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
 
+// adds the instances built into the library for a problem, shared by GetInstances and the softmax
+// plugin, which must not call the factory as it forwards to the plugin
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          index_t Rank,
+          index_t NumReduceDim>
+void add_device_softmax_instances(
+    std::vector<DeviceSoftmaxPtr<InDataType,
+                                 AccDataType,
+                                 OutDataType,
+                                 PassThrough,
+                                 PassThrough,
+                                 Rank,
+                                 NumReduceDim>>& op_ptrs)
+{
+#ifdef CK_ENABLE_FP16
+    if constexpr(std::is_same_v<InDataType, F16> && std::is_same_v<AccDataType, F32> &&
+                 std::is_same_v<OutDataType, F16>)
+    {
+        if constexpr(Rank == 3)
+        {
+            if constexpr(NumReduceDim == 1)
+                add_device_softmax_f16_f16_rank3_reduce1_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 2)
+                add_device_softmax_f16_f16_rank3_reduce2_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 3)
+                add_device_softmax_f16_f16_rank3_reduce3_instances(op_ptrs);
+        }
+        else if constexpr(Rank == 4)
+        {
+            if constexpr(NumReduceDim == 1)
+                add_device_softmax_f16_f16_rank4_reduce1_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 2)
+                add_device_softmax_f16_f16_rank4_reduce2_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 3)
+                add_device_softmax_f16_f16_rank4_reduce3_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 4)
+                add_device_softmax_f16_f16_rank4_reduce4_instances(op_ptrs);
+        }
+    }
+#endif
+#ifdef CK_ENABLE_FP32
+    if constexpr(std::is_same_v<InDataType, F32> && std::is_same_v<AccDataType, F32> &&
+                 std::is_same_v<OutDataType, F32>)
+    {
+        if constexpr(Rank == 3)
+        {
+            if constexpr(NumReduceDim == 1)
+                add_device_softmax_f32_f32_rank3_reduce1_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 2)
+                add_device_softmax_f32_f32_rank3_reduce2_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 3)
+                add_device_softmax_f32_f32_rank3_reduce3_instances(op_ptrs);
+        }
+        else if constexpr(Rank == 4)
+        {
+            if constexpr(NumReduceDim == 1)
+                add_device_softmax_f32_f32_rank4_reduce1_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 2)
+                add_device_softmax_f32_f32_rank4_reduce2_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 3)
+                add_device_softmax_f32_f32_rank4_reduce3_instances(op_ptrs);
+            else if constexpr(NumReduceDim == 4)
+                add_device_softmax_f32_f32_rank4_reduce4_instances(op_ptrs);
+        }
+    }
+#endif
+}
+
 template <typename InDataType,
           typename AccDataType,
           typename OutDataType,
@@ -39,60 +112,14 @@ struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceSoftma
 
     static auto GetInstances()
     {
+#ifdef CK_DEVICE_OPERATION_PLUGINS
+        return GetDeviceOperationPluginInstances<DeviceOp>("softmax");
+#else
         std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
-#ifdef CK_ENABLE_FP16
-        if constexpr(std::is_same_v<InDataType, F16> && std::is_same_v<AccDataType, F32> &&
-                     std::is_same_v<OutDataType, F16>)
-        {
-            if constexpr(Rank == 3)
-            {
-                if constexpr(NumReduceDim == 1)
-                    add_device_softmax_f16_f16_rank3_reduce1_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 2)
-                    add_device_softmax_f16_f16_rank3_reduce2_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 3)
-                    add_device_softmax_f16_f16_rank3_reduce3_instances(op_ptrs);
-            }
-            else if constexpr(Rank == 4)
-            {
-                if constexpr(NumReduceDim == 1)
-                    add_device_softmax_f16_f16_rank4_reduce1_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 2)
-                    add_device_softmax_f16_f16_rank4_reduce2_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 3)
-                    add_device_softmax_f16_f16_rank4_reduce3_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 4)
-                    add_device_softmax_f16_f16_rank4_reduce4_instances(op_ptrs);
-            }
-        }
-#endif
-#ifdef CK_ENABLE_FP32
-        if constexpr(std::is_same_v<InDataType, F32> && std::is_same_v<AccDataType, F32> &&
-                     std::is_same_v<OutDataType, F32>)
-        {
-            if constexpr(Rank == 3)
-            {
-                if constexpr(NumReduceDim == 1)
-                    add_device_softmax_f32_f32_rank3_reduce1_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 2)
-                    add_device_softmax_f32_f32_rank3_reduce2_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 3)
-                    add_device_softmax_f32_f32_rank3_reduce3_instances(op_ptrs);
-            }
-            else if constexpr(Rank == 4)
-            {
-                if constexpr(NumReduceDim == 1)
-                    add_device_softmax_f32_f32_rank4_reduce1_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 2)
-                    add_device_softmax_f32_f32_rank4_reduce2_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 3)
-                    add_device_softmax_f32_f32_rank4_reduce3_instances(op_ptrs);
-                else if constexpr(NumReduceDim == 4)
-                    add_device_softmax_f32_f32_rank4_reduce4_instances(op_ptrs);
-            }
-        }
-#endif
+        add_device_softmax_instances<InDataType, AccDataType, OutDataType, Rank, NumReduceDim>(
+            op_ptrs);
         return op_ptrs;
+#endif
     }
 };
 
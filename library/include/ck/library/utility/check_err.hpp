@@ -1,15 +1,21 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <numeric>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -18,117 +24,461 @@
 #include "ck/utility/type.hpp"
 #include "ck/host_utility/io.hpp"
 
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 namespace ck {
 namespace utils {
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_floating_point_v<ranges::range_value_t<Range>> &&
-        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-5,
-          double atol            = 3e-6)
+// Controls how much work check_err_report does once mismatches show up.
+struct CheckErrOptions
 {
-    if(out.size() != ref.size())
+    // stop comparing once this many mismatches were found, 0 compares every element
+    std::size_t max_err_count = 0;
+    // number of mismatches recorded in CheckErrReport::mismatches
+    std::size_t max_mismatch_record = 16;
+    std::size_t num_thread          = std::thread::hardware_concurrency();
+};
+
+// Outcome of comparing an output range against a reference range.
+//   The errors are measured over every compared element, not only the mismatching ones.
+//   ulp_histogram counts the compared elements by their distance to the reference in units in the
+//   last place of the compared data type: bin 0 holds exact matches, bin b in [1, 16] distances
+//   up to 2^(b - 1) ULP, the second to last bin larger distances and the last bin non-finite
+//   values.
+struct CheckErrReport
+{
+    static constexpr std::size_t NumUlpBin = 19;
+
+    struct Mismatch
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        // position in the ranges, for tensors the offset into the element space
+        std::size_t offset;
+        // tensor coordinates of offset, only filled in by the Tensor overload of check_err_report
+        std::vector<std::size_t> index;
+        double out;
+        double ref;
+    };
+
+    bool Passed() const { return size_match && err_count == 0; }
+
+    // true if the comparison stopped at CheckErrOptions::max_err_count
+    bool IsPartial() const { return num_checked < num_element; }
+
+    // largest distance in ULP counted by the given bin, infinity for the last two bins
+    static double GetUlpBinUpperBound(std::size_t bin)
+    {
+        if(bin == 0)
+            return 0;
+        if(bin + 2 < NumUlpBin)
+            return std::ldexp(1.0, static_cast<int>(bin) - 1);
+        return std::numeric_limits<double>::infinity();
     }
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<double>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    friend std::ostream& operator<<(std::ostream& os, const CheckErrReport& report)
     {
-        const double o = *std::next(std::begin(out), i);
-        const double r = *std::next(std::begin(ref), i);
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        os << "checked " << report.num_checked << "/" << report.num_element
+           << " elements, errors: " << report.err_count << ", max abs err: " << report.max_abs_err
+           << ", max rel err: " << report.max_rel_err << std::endl;
+
+        os << "ulp histogram:";
+        for(std::size_t bin = 0; bin < NumUlpBin; ++bin)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            if(report.ulp_histogram[bin] == 0)
+                continue;
+
+            if(bin + 1 == NumUlpBin)
+                os << " [non-finite]: ";
+            else if(bin + 2 == NumUlpBin)
+                os << " [>" << GetUlpBinUpperBound(bin - 1) << "]: ";
+            else
+                os << " [<=" << GetUlpBinUpperBound(bin) << "]: ";
+            os << report.ulp_histogram[bin];
+        }
+        os << std::endl;
+
+        for(const auto& mismatch : report.mismatches)
+        {
+            os << "out[" << mismatch.offset << "]";
+            if(!mismatch.index.empty())
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                os << " (";
+                for(std::size_t i = 0; i < mismatch.index.size(); ++i)
+                    os << (i == 0 ? "" : ", ") << mismatch.index[i];
+                os << ")";
             }
-            res = false;
+            os << ": " << mismatch.out << " != " << mismatch.ref << std::endl;
         }
+
+        return os;
     }
-    if(!res)
+
+    bool size_match         = true;
+    std::size_t num_element = 0;
+    std::size_t num_checked = 0;
+    std::size_t err_count   = 0;
+    double max_abs_err      = 0;
+    double max_rel_err      = 0;
+    std::array<std::size_t, NumUlpBin> ulp_histogram{};
+    std::vector<Mismatch> mismatches;
+};
+
+namespace detail {
+
+// Bits of the significand and smallest normal exponent of the data types check_err compares,
+// used to express errors in ULP. Integers use a ULP of 1.
+template <typename T, typename = void>
+struct CheckErrUlpTraits
+{
+    static constexpr bool is_integer = true;
+    static constexpr int mant        = 0;
+    static constexpr int min_exp     = 0;
+};
+
+template <typename T>
+struct CheckErrUlpTraits<T,
+                         std::enable_if_t<is_same_v<T, float> || is_same_v<T, half_t> ||
+                                          is_same_v<T, f8_t> || is_same_v<T, bf8_t>>>
+{
+    static constexpr bool is_integer = false;
+    static constexpr int mant        = NumericUtils<T>::mant;
+    static constexpr int min_exp     = 1 - NumericUtils<T>::bias;
+};
+
+template <>
+struct CheckErrUlpTraits<double>
+{
+    static constexpr bool is_integer = false;
+    static constexpr int mant        = 52;
+    static constexpr int min_exp     = -1022;
+};
+
+template <>
+struct CheckErrUlpTraits<bhalf_t>
+{
+    static constexpr bool is_integer = false;
+    static constexpr int mant        = 7;
+    static constexpr int min_exp     = -126;
+};
+
+template <typename T>
+double check_err_to_double(const T& x)
+{
+    if constexpr(CheckErrUlpTraits<T>::is_integer)
+        return static_cast<double>(static_cast<int64_t>(x));
+    else if constexpr(is_same_v<T, float> || is_same_v<T, double>)
+        return x;
+    else
+        return type_convert<float>(x);
+}
+
+// unbiased binary exponent of a finite, non-zero double and whether its significand is exactly 1
+inline int check_err_exponent(double x, bool& is_power_of_two)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    is_power_of_two = (bits & ((std::uint64_t{1} << 52) - 1)) == 0;
+
+    return static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+}
+
+// Histogram bin of an error of err against the reference value r, see CheckErrReport. The ULP of
+// r is a power of two, so the bin follows from the exponents of err and r without any log.
+template <typename T>
+std::size_t check_err_ulp_bin(double err, double r)
+{
+    using Traits = CheckErrUlpTraits<T>;
+
+    constexpr int last_finite_bin = static_cast<int>(CheckErrReport::NumUlpBin) - 2;
+
+    if(!(err <= std::numeric_limits<double>::max()))
+        return CheckErrReport::NumUlpBin - 1;
+    if(!(err > 0))
+        return 0;
+
+    bool err_is_power_of_two = false;
+    const int err_exp        = check_err_exponent(err, err_is_power_of_two);
+
+    int ulp_exp = 0;
+    if constexpr(!Traits::is_integer)
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        bool r_is_power_of_two = false;
+        const int r_exp =
+            std::abs(r) > 0 ? check_err_exponent(r, r_is_power_of_two) : Traits::min_exp;
+
+        ulp_exp = std::max(r_exp, Traits::min_exp) - Traits::mant;
     }
-    return res;
+
+    // bin b covers (2^(b - 2), 2^(b - 1)] ULP
+    const int ceil_log2_ulps = err_exp - ulp_exp + (err_is_power_of_two ? 0 : 1);
+
+    return static_cast<std::size_t>(std::clamp(ceil_log2_ulps + 1, 1, last_finite_bin));
 }
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+// Maps an offset into the element space back to tensor coordinates, assuming the tensor does not
+// overlap itself. Dimensions are peeled off from the largest stride down.
+template <typename Desc>
+std::vector<std::size_t> check_err_offset_to_index(const Desc& desc, std::size_t offset)
 {
-    if(out.size() != ref.size())
+    const auto& lens    = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    std::vector<std::size_t> order(lens.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return strides[a] > strides[b];
+    });
+
+    std::vector<std::size_t> index(lens.size(), 0);
+    for(std::size_t d : order)
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        if(strides[d] == 0 || lens[d] <= 1)
+            continue;
+
+        index[d] = std::min<std::size_t>(offset / strides[d], lens[d] - 1);
+        offset -= index[d] * strides[d];
+    }
+
+    return index;
+}
+
+// Number of elements one task of the comparison works on. Every chunk is first converted to
+// double and screened by a branch-free loop the compiler vectorizes; only chunks with a mismatch
+// are walked again element by element.
+constexpr std::size_t CheckErrChunkSize = 4096;
+
+template <typename T, typename OutIter, typename RefIter>
+void check_err_chunk(OutIter out,
+                     RefIter ref,
+                     std::size_t begin,
+                     std::size_t end,
+                     double rtol,
+                     double atol,
+                     std::size_t max_mismatch_record,
+                     CheckErrReport& report)
+{
+    constexpr double max_finite = std::numeric_limits<double>::max();
+
+    std::array<double, CheckErrChunkSize> o;
+    std::array<double, CheckErrChunkSize> r;
+
+    const std::size_t n = end - begin;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        o[i] = check_err_to_double(static_cast<T>(out[begin + i]));
+        r[i] = check_err_to_double(static_cast<T>(ref[begin + i]));
+    }
+
+    std::size_t err_count = 0;
+    double max_abs_err    = 0;
+    double max_rel_err    = 0;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const double err = std::abs(o[i] - r[i]);
+        const double rel = std::abs(r[i]) > 0 ? err / std::abs(r[i]) : 0;
+
+        // written so that NaN and infinity on either side count as a mismatch
+        const bool pass = err <= atol + rtol * std::abs(r[i]) && std::abs(o[i]) <= max_finite &&
+                          std::abs(r[i]) <= max_finite;
+
+        err_count += pass ? 0 : 1;
+        max_abs_err = err > max_abs_err ? err : max_abs_err;
+        max_rel_err = rel > max_rel_err ? rel : max_rel_err;
     }
 
-    bool res{true};
-    int err_count = 0;
-    double err    = 0;
-    // TODO: This is a hack. We should have proper specialization for bhalf_t data type.
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    report.num_checked += n;
+    report.err_count += err_count;
+    report.max_abs_err = std::max(report.max_abs_err, max_abs_err);
+    report.max_rel_err = std::max(report.max_rel_err, max_rel_err);
+
+    for(std::size_t i = 0; i < n; ++i)
     {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        const double err = std::abs(o[i] - r[i]);
+        ++report.ulp_histogram[check_err_ulp_bin<T>(err, r[i])];
+    }
+
+    if(err_count == 0)
+        return;
+
+    for(std::size_t i = 0; i < n && report.mismatches.size() < max_mismatch_record; ++i)
+    {
+        const double err = std::abs(o[i] - r[i]);
+
+        if(!(err <= atol + rtol * std::abs(r[i]) && std::abs(o[i]) <= max_finite &&
+             std::abs(r[i]) <= max_finite))
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            report.mismatches.push_back({begin + i, {}, o[i], r[i]});
+        }
+    }
+}
+
+template <typename Range, typename RefRange>
+CheckErrReport check_err_report_impl(const Range& out,
+                                     const RefRange& ref,
+                                     double rtol,
+                                     double atol,
+                                     const CheckErrOptions& options)
+{
+    using T        = ranges::range_value_t<Range>;
+    using Category = typename std::iterator_traits<decltype(std::begin(out))>::iterator_category;
+
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, Category>,
+                  "wrong! check_err needs random access ranges");
+
+    CheckErrReport report;
+
+    report.num_element = std::size(out);
+    report.size_match  = std::size(out) == std::size(ref);
+    if(!report.size_match)
+        return report;
+
+    const std::size_t num_chunk = (report.num_element + CheckErrChunkSize - 1) / CheckErrChunkSize;
+
+    std::vector<CheckErrReport> chunk_reports(num_chunk);
+    std::atomic<std::size_t> err_count{0};
+
+    HostThreadPool::GetInstance().ParallelFor(
+        num_chunk, options.num_thread, [&](std::size_t chunk_begin, std::size_t chunk_end) {
+            for(std::size_t chunk = chunk_begin; chunk < chunk_end; ++chunk)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                if(options.max_err_count > 0 && err_count.load() >= options.max_err_count)
+                    return;
+
+                const std::size_t begin = chunk * CheckErrChunkSize;
+                const std::size_t end = std::min(begin + CheckErrChunkSize, report.num_element);
+
+                check_err_chunk<T>(std::begin(out),
+                                   std::begin(ref),
+                                   begin,
+                                   end,
+                                   rtol,
+                                   atol,
+                                   options.max_mismatch_record,
+                                   chunk_reports[chunk]);
+
+                err_count += chunk_reports[chunk].err_count;
             }
-            res = false;
-        }
+        });
+
+    // merging in chunk order keeps the recorded mismatches sorted by offset
+    for(const auto& chunk_report : chunk_reports)
+    {
+        report.num_checked += chunk_report.num_checked;
+        report.err_count += chunk_report.err_count;
+        report.max_abs_err = std::max(report.max_abs_err, chunk_report.max_abs_err);
+        report.max_rel_err = std::max(report.max_rel_err, chunk_report.max_rel_err);
+
+        for(std::size_t bin = 0; bin < CheckErrReport::NumUlpBin; ++bin)
+            report.ulp_histogram[bin] += chunk_report.ulp_histogram[bin];
+
+        for(const auto& mismatch : chunk_report.mismatches)
+            if(report.mismatches.size() < options.max_mismatch_record)
+                report.mismatches.push_back(mismatch);
     }
-    if(!res)
+
+    return report;
+}
+
+// prints the outcome of a check_err call in the format of the former serial implementation
+inline bool check_err_print(const CheckErrReport& report,
+                            const std::string& msg,
+                            std::size_t ref_size,
+                            bool integral)
+{
+    if(!report.size_match)
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        std::cerr << msg << " out.size() != ref.size(), :" << report.num_element
+                  << " != " << ref_size << std::endl;
+        return false;
     }
-    return res;
+
+    if(report.Passed())
+        return true;
+
+    for(std::size_t i = 0; i < std::min<std::size_t>(report.mismatches.size(), 4); ++i)
+    {
+        const auto& mismatch = report.mismatches[i];
+
+        if(integral)
+        {
+            std::cerr << msg << " out[" << mismatch.offset << "] != ref[" << mismatch.offset
+                      << "]: " << static_cast<int64_t>(mismatch.out)
+                      << " != " << static_cast<int64_t>(mismatch.ref) << std::endl;
+        }
+        else
+        {
+            std::cerr << msg << std::setw(12) << std::setprecision(7) << " out["
+                      << mismatch.offset << "] != ref[" << mismatch.offset
+                      << "]: " << mismatch.out << " != " << mismatch.ref << std::endl;
+        }
+    }
+
+    const float error_percent =
+        static_cast<float>(report.err_count) / static_cast<float>(report.num_element) * 100.f;
+    std::cerr << "max err: " << report.max_abs_err;
+    std::cerr << ", number of errors: " << report.err_count;
+    std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+
+    return false;
+}
+
+} // namespace detail
+
+// Compares out against ref element by element, on the HostThreadPool, and returns the error
+// statistics instead of printing them. An element matches if |out - ref| <= atol + rtol * |ref|
+// and both values are finite.
+template <typename Range, typename RefRange>
+std::enable_if_t<std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>>,
+                 CheckErrReport>
+check_err_report(const Range& out,
+                 const RefRange& ref,
+                 double rtol,
+                 double atol,
+                 const CheckErrOptions& options = {})
+{
+    return detail::check_err_report_impl(out, ref, rtol, atol, options);
+}
+
+// Same as above, the recorded mismatches also carry their tensor coordinates.
+template <typename T, typename Desc>
+CheckErrReport check_err_report(const Tensor<T, Desc>& out,
+                                const Tensor<T, Desc>& ref,
+                                double rtol,
+                                double atol,
+                                const CheckErrOptions& options = {})
+{
+    CheckErrReport report = detail::check_err_report_impl(out, ref, rtol, atol, options);
+
+    for(auto& mismatch : report.mismatches)
+        mismatch.index = detail::check_err_offset_to_index(out.mDesc, mismatch.offset);
+
+    return report;
 }
 
 template <typename Range, typename RefRange>
 typename std::enable_if<
     std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, half_t>,
+        std::is_floating_point_v<ranges::range_value_t<Range>> &&
+        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-5,
+          double atol            = 3e-6)
+{
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, rtol, atol, {}), msg, std::size(ref), false);
+}
+
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
     bool>::type
 check_err(const Range& out,
           const RefRange& ref,
@@ -136,43 +486,23 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, rtol, atol, {}), msg, std::size(ref), false);
+}
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<ranges::range_value_t<Range>>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-3,
+          double atol            = 1e-3)
+{
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, rtol, atol, {}), msg, std::size(ref), false);
 }
 
 template <typename Range, typename RefRange>
@@ -190,44 +520,8 @@ check_err(const Range& out,
           double                 = 0,
           double atol            = 0)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count   = 0;
-    int64_t err     = 0;
-    int64_t max_err = std::numeric_limits<int64_t>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const int64_t o = *std::next(std::begin(out), i);
-        const int64_t r = *std::next(std::begin(ref), i);
-        err             = std::abs(o - r);
-
-        if(err > atol)
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
-                          << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, 0, atol, {}), msg, std::size(ref), true);
 }
 
 template <typename Range, typename RefRange>
@@ -240,39 +534,8 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, rtol, atol, {}), msg, std::size(ref), false);
 }
 
 template <typename Range, typename RefRange>
@@ -285,39 +548,8 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+    return detail::check_err_print(
+        detail::check_err_report_impl(out, ref, rtol, atol, {}), msg, std::size(ref), false);
 }
 
 } // namespace utils
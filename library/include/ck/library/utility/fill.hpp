@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <random>
 #include <type_traits>
@@ -12,21 +13,44 @@
 
 #include "ck/utility/data_type.hpp"
 
+#include "ck/library/utility/host_philox.hpp"
+
 namespace ck {
 namespace utils {
 
+namespace detail {
+
+// Random access ranges are filled in parallel. The values only depend on the seed and on the
+// position in the range, so every way of filling gives the same result.
+template <typename T, typename ForwardIter, typename F>
+void fill_philox(ForwardIter first, ForwardIter last, std::uint64_t seed, F f)
+{
+    using Category = typename std::iterator_traits<ForwardIter>::iterator_category;
+
+    const auto n = static_cast<std::size_t>(std::distance(first, last));
+
+    if constexpr(std::is_base_of_v<std::random_access_iterator_tag, Category>)
+        ParallelPhiloxGenerate<T>(first, n, seed, 0, f);
+    else
+        PhiloxGenerate<T>(first, 0, n, seed, 0, f);
+}
+
+} // namespace detail
+
 template <typename T>
 struct FillUniformDistribution
 {
     float a_{-5.f};
     float b_{5.f};
+    std::uint64_t seed_{11939};
 
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        const float a     = a_;
+        const float range = b_ - a_;
+
+        detail::fill_philox<T>(first, last, seed_, [=](float u) { return a + u * range; });
     }
 
     template <typename ForwardRange>
@@ -64,14 +88,16 @@ struct FillUniformDistributionIntegerValue
 {
     float a_{-5.f};
     float b_{5.f};
+    std::uint64_t seed_{11939};
 
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+        const float a     = a_;
+        const float range = b_ - a_;
+
+        detail::fill_philox<T>(
+            first, last, seed_, [=](float u) { return std::round(a + u * range); });
     }
 
     template <typename ForwardRange>
@@ -0,0 +1,540 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+// The ISA specific kernels are only compiled for the x86-64 host pass. Device passes and other
+// host architectures only see the portable kernel.
+#if(defined(__x86_64__) || defined(_M_X64)) && !defined(__HIP_DEVICE_COMPILE__) && \
+    (defined(__clang__) || defined(__GNUC__))
+#define CK_HOST_BLOCKED_GEMM_X86 1
+#else
+#define CK_HOST_BLOCKED_GEMM_X86 0
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define CK_HOST_BLOCKED_GEMM_INLINE inline __attribute__((always_inline))
+#else
+#define CK_HOST_BLOCKED_GEMM_INLINE inline
+#endif
+
+#if defined(__clang__)
+#define CK_HOST_BLOCKED_GEMM_NO_FP_CONTRACT _Pragma("clang fp contract(off)")
+#define CK_HOST_BLOCKED_GEMM_STRICT_ATTR
+#elif defined(__GNUC__)
+#define CK_HOST_BLOCKED_GEMM_NO_FP_CONTRACT
+#define CK_HOST_BLOCKED_GEMM_STRICT_ATTR __attribute__((optimize("fp-contract=off")))
+#else
+#define CK_HOST_BLOCKED_GEMM_NO_FP_CONTRACT
+#define CK_HOST_BLOCKED_GEMM_STRICT_ATTR
+#endif
+
+namespace ck {
+namespace utils {
+
+// Accumulation order guarantee of host_blocked_gemm
+//   Strict:  every C(m, n) is accumulated in ascending k order, starting from zero, with a
+//            separately rounded multiply and add. This is bit-identical to the naive reference loop
+//            "acc += a(m, k) * b(k, n)".
+//   Relaxed: multiply and add may be fused, results can differ from the naive loop in the last ulp.
+enum struct HostGemmAccumulation
+{
+    Strict,
+    Relaxed,
+};
+
+// the accumulator types host_blocked_gemm has kernels for
+template <typename AccDataType>
+inline constexpr bool is_host_blocked_gemm_acc_v = std::is_same_v<AccDataType, float> ||
+                                                   std::is_same_v<AccDataType, double> ||
+                                                   std::is_same_v<AccDataType, std::int32_t>;
+
+namespace detail {
+
+// Register tile (MR x NR) and cache blocking (MC x KC x NC) for a given vector width in bytes.
+// NR covers two vector registers, MR * 2 accumulators fit in the 16 architectural registers of
+// AVX2 and leave room for the broadcast A value and the B vectors.
+template <typename AccDataType, std::size_t VectorBytes>
+struct HostGemmBlocking
+{
+    static constexpr std::size_t NR =
+        std::max<std::size_t>(2 * VectorBytes / sizeof(AccDataType), 2);
+    static constexpr std::size_t MR = 6;
+    static constexpr std::size_t MC = MR * 16;
+    static constexpr std::size_t NC = NR * 16;
+    static constexpr std::size_t KC = 256;
+};
+
+template <typename AccDataType, std::size_t MR, std::size_t NR>
+CK_HOST_BLOCKED_GEMM_INLINE void host_gemm_micro_kernel_strict(std::size_t kc,
+                                                               const AccDataType* __restrict a,
+                                                               const AccDataType* __restrict b,
+                                                               AccDataType* __restrict c,
+                                                               std::size_t ldc)
+{
+    CK_HOST_BLOCKED_GEMM_NO_FP_CONTRACT
+
+    AccDataType acc[MR][NR];
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            acc[i][j] = c[i * ldc + j];
+
+    for(std::size_t k = 0; k < kc; ++k)
+    {
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            const AccDataType a_ik = a[k * MR + i];
+
+            for(std::size_t j = 0; j < NR; ++j)
+            {
+                const AccDataType prod = a_ik * b[k * NR + j];
+                acc[i][j]              = acc[i][j] + prod;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            c[i * ldc + j] = acc[i][j];
+}
+
+template <typename AccDataType, std::size_t MR, std::size_t NR>
+CK_HOST_BLOCKED_GEMM_INLINE void host_gemm_micro_kernel_relaxed(std::size_t kc,
+                                                                const AccDataType* __restrict a,
+                                                                const AccDataType* __restrict b,
+                                                                AccDataType* __restrict c,
+                                                                std::size_t ldc)
+{
+    AccDataType acc[MR][NR];
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            acc[i][j] = c[i * ldc + j];
+
+    for(std::size_t k = 0; k < kc; ++k)
+    {
+        for(std::size_t i = 0; i < MR; ++i)
+        {
+            const AccDataType a_ik = a[k * MR + i];
+
+            for(std::size_t j = 0; j < NR; ++j)
+                acc[i][j] += a_ik * b[k * NR + j];
+        }
+    }
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            c[i * ldc + j] = acc[i][j];
+}
+
+// Scratch buffers owned by one worker thread. They are sized for the largest blocking so a worker
+// can switch between kernels without reallocating.
+template <typename AccDataType>
+struct HostGemmWorkspace
+{
+    std::vector<AccDataType> a_pack;
+    std::vector<AccDataType> b_pack;
+    std::vector<AccDataType> c_tile;
+};
+
+// Computes the macro tile C[m0 : m0 + MC, n0 : n0 + NC] over the whole K range, starting from
+// init_c(m, n).
+//   A is packed into MR-row slivers (k-major), B into NR-column slivers (k-major), both zero padded
+//   at the M/N edges. Partial sums stay in an AccDataType tile across KC blocks, so splitting K
+//   does not change the per-element accumulation order.
+template <typename Blocking,
+          HostGemmAccumulation Mode,
+          typename AccDataType,
+          typename InitC,
+          typename LoadA,
+          typename LoadB,
+          typename StoreC>
+CK_HOST_BLOCKED_GEMM_INLINE void host_gemm_macro_tile(std::size_t M,
+                                                      std::size_t N,
+                                                      std::size_t K,
+                                                      std::size_t m0,
+                                                      std::size_t n0,
+                                                      const InitC& init_c,
+                                                      const LoadA& load_a,
+                                                      const LoadB& load_b,
+                                                      const StoreC& store_c,
+                                                      HostGemmWorkspace<AccDataType>& ws)
+{
+    constexpr std::size_t MR = Blocking::MR;
+    constexpr std::size_t NR = Blocking::NR;
+    constexpr std::size_t MC = Blocking::MC;
+    constexpr std::size_t NC = Blocking::NC;
+    constexpr std::size_t KC = Blocking::KC;
+
+    const std::size_t mc      = std::min(MC, M - m0);
+    const std::size_t nc      = std::min(NC, N - n0);
+    const std::size_t mc_pad  = (mc + MR - 1) / MR * MR;
+    const std::size_t nc_pad  = (nc + NR - 1) / NR * NR;
+    const std::size_t ldc     = nc_pad;
+    const std::size_t kc_max  = std::min(KC, K);
+    const std::size_t a_space = mc_pad * kc_max;
+    const std::size_t b_space = nc_pad * kc_max;
+
+    if(ws.a_pack.size() < a_space)
+        ws.a_pack.resize(a_space);
+    if(ws.b_pack.size() < b_space)
+        ws.b_pack.resize(b_space);
+    if(ws.c_tile.size() < mc_pad * nc_pad)
+        ws.c_tile.resize(mc_pad * nc_pad);
+
+    AccDataType* a_pack = ws.a_pack.data();
+    AccDataType* b_pack = ws.b_pack.data();
+    AccDataType* c_tile = ws.c_tile.data();
+
+    std::fill(c_tile, c_tile + mc_pad * nc_pad, AccDataType{0});
+
+    for(std::size_t i = 0; i < mc; ++i)
+        for(std::size_t j = 0; j < nc; ++j)
+            c_tile[i * ldc + j] = init_c(m0 + i, n0 + j);
+
+    for(std::size_t k0 = 0; k0 < K; k0 += KC)
+    {
+        const std::size_t kc = std::min(KC, K - k0);
+
+        for(std::size_t j0 = 0; j0 < nc_pad; j0 += NR)
+        {
+            AccDataType* p = b_pack + j0 * kc;
+
+            for(std::size_t k = 0; k < kc; ++k)
+                for(std::size_t j = 0; j < NR; ++j)
+                    p[k * NR + j] = j0 + j < nc ? load_b(k0 + k, n0 + j0 + j) : AccDataType{0};
+        }
+
+        for(std::size_t i0 = 0; i0 < mc_pad; i0 += MR)
+        {
+            AccDataType* p = a_pack + i0 * kc;
+
+            for(std::size_t k = 0; k < kc; ++k)
+                for(std::size_t i = 0; i < MR; ++i)
+                    p[k * MR + i] = i0 + i < mc ? load_a(m0 + i0 + i, k0 + k) : AccDataType{0};
+        }
+
+        for(std::size_t i0 = 0; i0 < mc_pad; i0 += MR)
+        {
+            for(std::size_t j0 = 0; j0 < nc_pad; j0 += NR)
+            {
+                if constexpr(Mode == HostGemmAccumulation::Strict)
+                {
+                    host_gemm_micro_kernel_strict<AccDataType, MR, NR>(
+                        kc, a_pack + i0 * kc, b_pack + j0 * kc, c_tile + i0 * ldc + j0, ldc);
+                }
+                else
+                {
+                    host_gemm_micro_kernel_relaxed<AccDataType, MR, NR>(
+                        kc, a_pack + i0 * kc, b_pack + j0 * kc, c_tile + i0 * ldc + j0, ldc);
+                }
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < mc; ++i)
+        for(std::size_t j = 0; j < nc; ++j)
+            store_c(m0 + i, n0 + j, c_tile[i * ldc + j]);
+}
+
+enum struct HostGemmIsa
+{
+    Generic,
+    Avx2,
+    Avx512,
+};
+
+inline HostGemmIsa get_host_gemm_isa()
+{
+#if CK_HOST_BLOCKED_GEMM_X86
+    static const HostGemmIsa isa = [] {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+            return HostGemmIsa::Avx512;
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return HostGemmIsa::Avx2;
+        return HostGemmIsa::Generic;
+    }();
+    return isa;
+#else
+    return HostGemmIsa::Generic;
+#endif
+}
+
+// One entry point per ISA and accumulation mode. The target attribute makes the compiler generate
+// the inlined micro kernel with the wider vector registers. The strict variants never enable FMA
+// contraction so that they stay bit-identical to the scalar loop.
+template <typename AccDataType, typename... Args>
+CK_HOST_BLOCKED_GEMM_STRICT_ATTR void host_gemm_macro_tile_generic(Args&&... args)
+{
+    host_gemm_macro_tile<HostGemmBlocking<AccDataType, 16>, HostGemmAccumulation::Strict>(
+        std::forward<Args>(args)...);
+}
+
+#if CK_HOST_BLOCKED_GEMM_X86
+template <typename AccDataType, typename... Args>
+__attribute__((target("avx2"))) void host_gemm_macro_tile_avx2_strict(Args&&... args)
+{
+    host_gemm_macro_tile<HostGemmBlocking<AccDataType, 32>, HostGemmAccumulation::Strict>(
+        std::forward<Args>(args)...);
+}
+
+template <typename AccDataType, typename... Args>
+__attribute__((target("avx2,fma"))) void host_gemm_macro_tile_avx2_relaxed(Args&&... args)
+{
+    host_gemm_macro_tile<HostGemmBlocking<AccDataType, 32>, HostGemmAccumulation::Relaxed>(
+        std::forward<Args>(args)...);
+}
+
+template <typename AccDataType, typename... Args>
+__attribute__((target("avx512f"))) CK_HOST_BLOCKED_GEMM_STRICT_ATTR void
+host_gemm_macro_tile_avx512_strict(Args&&... args)
+{
+    host_gemm_macro_tile<HostGemmBlocking<AccDataType, 64>, HostGemmAccumulation::Strict>(
+        std::forward<Args>(args)...);
+}
+
+template <typename AccDataType, typename... Args>
+__attribute__((target("avx512f"))) void host_gemm_macro_tile_avx512_relaxed(Args&&... args)
+{
+    host_gemm_macro_tile<HostGemmBlocking<AccDataType, 64>, HostGemmAccumulation::Relaxed>(
+        std::forward<Args>(args)...);
+}
+#endif
+
+template <typename AccDataType>
+std::pair<std::size_t, std::size_t> get_host_gemm_macro_tile_size(HostGemmIsa isa)
+{
+    switch(isa)
+    {
+    case HostGemmIsa::Avx512:
+        return {HostGemmBlocking<AccDataType, 64>::MC, HostGemmBlocking<AccDataType, 64>::NC};
+    case HostGemmIsa::Avx2:
+        return {HostGemmBlocking<AccDataType, 32>::MC, HostGemmBlocking<AccDataType, 32>::NC};
+    case HostGemmIsa::Generic: break;
+    }
+
+    return {HostGemmBlocking<AccDataType, 16>::MC, HostGemmBlocking<AccDataType, 16>::NC};
+}
+
+} // namespace detail
+
+// Cache-blocked, register-tiled batch of G independent GEMMs on the host:
+//   C(g, m, n) = init_c(g, m, n) + sum_k A(g, m, k) * B(g, k, n).
+//   init_c(g, m, n) returns the starting value of the accumulator. Feeding back the accumulator of
+//   a previous call lets a long K range be processed in several calls without changing the
+//   accumulation order. load_a(g, m, k) and load_b(g, k, n) return the (already element-op'ed)
+//   operands as AccDataType and are called once per element per macro tile while packing.
+//   store_c(g, m, n, acc) receives the final accumulator of every output exactly once. Every
+//   M x N is split into MC x NC macro tiles, the macro tiles of all batches are distributed over
+//   at most num_thread threads of the HostThreadPool, so many small GEMMs still fill the pool.
+template <typename AccDataType, typename InitC, typename LoadA, typename LoadB, typename StoreC>
+void host_blocked_batched_gemm_accumulate(
+    std::size_t G,
+    std::size_t M,
+    std::size_t N,
+    std::size_t K,
+    InitC init_c,
+    LoadA load_a,
+    LoadB load_b,
+    StoreC store_c,
+    HostGemmAccumulation mode = HostGemmAccumulation::Strict,
+    std::size_t num_thread    = std::thread::hardware_concurrency())
+{
+    using detail::HostGemmIsa;
+    using Workspace = detail::HostGemmWorkspace<AccDataType>;
+
+    if(G == 0 || M == 0 || N == 0)
+        return;
+
+    const HostGemmIsa isa = detail::get_host_gemm_isa();
+
+    const auto tile_size = detail::get_host_gemm_macro_tile_size<AccDataType>(isa);
+    const std::size_t MC = tile_size.first;
+    const std::size_t NC = tile_size.second;
+
+    const std::size_t num_tile_m = (M + MC - 1) / MC;
+    const std::size_t num_tile_n = (N + NC - 1) / NC;
+    const std::size_t num_tile   = num_tile_m * num_tile_n;
+
+    auto run_tile = [&](std::size_t tile, Workspace& ws) {
+        const std::size_t g  = tile / num_tile;
+        const std::size_t m0 = (tile % num_tile / num_tile_n) * MC;
+        const std::size_t n0 = (tile % num_tile_n) * NC;
+
+        auto init_c_g  = [&](std::size_t m, std::size_t n) { return init_c(g, m, n); };
+        auto load_a_g  = [&](std::size_t m, std::size_t k) { return load_a(g, m, k); };
+        auto load_b_g  = [&](std::size_t k, std::size_t n) { return load_b(g, k, n); };
+        auto store_c_g = [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+            store_c(g, m, n, v_acc);
+        };
+
+#if CK_HOST_BLOCKED_GEMM_X86
+        const bool strict = mode == HostGemmAccumulation::Strict;
+
+        if(isa == HostGemmIsa::Avx512 && strict)
+            detail::host_gemm_macro_tile_avx512_strict<AccDataType>(
+                M, N, K, m0, n0, init_c_g, load_a_g, load_b_g, store_c_g, ws);
+        else if(isa == HostGemmIsa::Avx512)
+            detail::host_gemm_macro_tile_avx512_relaxed<AccDataType>(
+                M, N, K, m0, n0, init_c_g, load_a_g, load_b_g, store_c_g, ws);
+        else if(isa == HostGemmIsa::Avx2 && strict)
+            detail::host_gemm_macro_tile_avx2_strict<AccDataType>(
+                M, N, K, m0, n0, init_c_g, load_a_g, load_b_g, store_c_g, ws);
+        else if(isa == HostGemmIsa::Avx2)
+            detail::host_gemm_macro_tile_avx2_relaxed<AccDataType>(
+                M, N, K, m0, n0, init_c_g, load_a_g, load_b_g, store_c_g, ws);
+        else
+#endif
+            // the portable kernel is always strict, there is nothing to gain from contraction
+            detail::host_gemm_macro_tile_generic<AccDataType>(
+                M, N, K, m0, n0, init_c_g, load_a_g, load_b_g, store_c_g, ws);
+    };
+
+    HostThreadPool::GetInstance().ParallelFor(
+        G * num_tile, num_thread, [&](std::size_t tile_begin, std::size_t tile_end) {
+            Workspace ws;
+            for(std::size_t tile = tile_begin; tile < tile_end; ++tile)
+                run_tile(tile, ws);
+        });
+}
+
+// C(g, m, n) = sum_k A(g, m, k) * B(g, k, n), see host_blocked_batched_gemm_accumulate
+template <typename AccDataType, typename LoadA, typename LoadB, typename StoreC>
+void host_blocked_batched_gemm(std::size_t G,
+                               std::size_t M,
+                               std::size_t N,
+                               std::size_t K,
+                               LoadA load_a,
+                               LoadB load_b,
+                               StoreC store_c,
+                               HostGemmAccumulation mode = HostGemmAccumulation::Strict,
+                               std::size_t num_thread    = std::thread::hardware_concurrency())
+{
+    host_blocked_batched_gemm_accumulate<AccDataType>(
+        G,
+        M,
+        N,
+        K,
+        [](std::size_t, std::size_t, std::size_t) { return AccDataType{0}; },
+        load_a,
+        load_b,
+        store_c,
+        mode,
+        num_thread);
+}
+
+// The single GEMM of host_blocked_batched_gemm_accumulate:
+//   C(m, n) = init_c(m, n) + sum_k A(m, k) * B(k, n).
+template <typename AccDataType, typename InitC, typename LoadA, typename LoadB, typename StoreC>
+void host_blocked_gemm_accumulate(std::size_t M,
+                                  std::size_t N,
+                                  std::size_t K,
+                                  InitC init_c,
+                                  LoadA load_a,
+                                  LoadB load_b,
+                                  StoreC store_c,
+                                  HostGemmAccumulation mode = HostGemmAccumulation::Strict,
+                                  std::size_t num_thread    = std::thread::hardware_concurrency())
+{
+    host_blocked_batched_gemm_accumulate<AccDataType>(
+        1,
+        M,
+        N,
+        K,
+        [&](std::size_t, std::size_t m, std::size_t n) { return init_c(m, n); },
+        [&](std::size_t, std::size_t m, std::size_t k) { return load_a(m, k); },
+        [&](std::size_t, std::size_t k, std::size_t n) { return load_b(k, n); },
+        [&](std::size_t, std::size_t m, std::size_t n, AccDataType v_acc) {
+            store_c(m, n, v_acc);
+        },
+        mode,
+        num_thread);
+}
+// C(m, n) = sum_k A(m, k) * B(k, n), see host_blocked_gemm_accumulate
+template <typename AccDataType, typename LoadA, typename LoadB, typename StoreC>
+void host_blocked_gemm(std::size_t M,
+                       std::size_t N,
+                       std::size_t K,
+                       LoadA load_a,
+                       LoadB load_b,
+                       StoreC store_c,
+                       HostGemmAccumulation mode = HostGemmAccumulation::Strict,
+                       std::size_t num_thread    = std::thread::hardware_concurrency())
+{
+    host_blocked_gemm_accumulate<AccDataType>(
+        M,
+        N,
+        K,
+        [](std::size_t, std::size_t) { return AccDataType{0}; },
+        load_a,
+        load_b,
+        store_c,
+        mode,
+        num_thread);
+}
+
+// A group of tensor dimensions addressed as one GEMM dimension: element i of the group is at
+// offset i * stride.
+struct HostGemmFoldedDimension
+{
+    std::size_t length;
+    std::size_t stride;
+};
+
+// Folds the dimensions [begin, end) of a tensor into one GEMM dimension, enumerating the group in
+// row-major order of its indices. This works if every dimension of length > 1 has the stride of
+// the next such dimension times that one's length (packed, or padded only outside the group).
+// Returns false if the group cannot be merged.
+template <typename Lengths, typename Strides>
+bool fold_host_gemm_dimensions(const Lengths& lengths,
+                               const Strides& strides,
+                               std::size_t begin,
+                               std::size_t end,
+                               HostGemmFoldedDimension& folded)
+{
+    folded = {1, 0};
+
+    for(std::size_t i = begin; i < end; ++i)
+        folded.length *= lengths[i];
+
+    if(folded.length <= 1)
+        return true;
+
+    bool found_inner        = false;
+    std::size_t next_stride = 0;
+
+    for(std::size_t i = end; i-- > begin;)
+    {
+        if(lengths[i] == 1)
+            continue;
+
+        if(!found_inner)
+        {
+            folded.stride = strides[i];
+            found_inner   = true;
+        }
+        else if(static_cast<std::size_t>(strides[i]) != next_stride)
+        {
+            return false;
+        }
+
+        next_stride = strides[i] * lengths[i];
+    }
+
+    return true;
+}
+
+} // namespace utils
+} // namespace ck
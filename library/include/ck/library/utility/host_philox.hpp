@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+// Counter-based random numbers for host tensor initialization: Philox4x32-10 from Salmon et al.,
+// "Parallel Random Numbers: As Easy as 1, 2, 3". Value i of a stream is a pure function of the key,
+// the stream and i, so any part of a tensor can be generated on its own and the result does not
+// depend on how the work is split between threads.
+struct Philox4x32
+{
+    // counters processed together, the rounds run lane-wise over them so the compiler vectorizes
+    // the 32x32->64 bit multiplies
+    static constexpr std::size_t NumLane          = 16;
+    static constexpr std::size_t NumValuePerBlock = 4 * NumLane;
+
+    // the 4 * NumLane random words of counters [first_counter, first_counter + NumLane)
+    static void GenerateBlock(std::uint64_t key,
+                              std::uint64_t stream,
+                              std::uint64_t first_counter,
+                              std::uint32_t* out)
+    {
+        constexpr std::uint32_t M0 = 0xD2511F53u;
+        constexpr std::uint32_t M1 = 0xCD9E8D57u;
+        constexpr std::uint32_t W0 = 0x9E3779B9u;
+        constexpr std::uint32_t W1 = 0xBB67AE85u;
+
+        std::uint32_t c0[NumLane];
+        std::uint32_t c1[NumLane];
+        std::uint32_t c2[NumLane];
+        std::uint32_t c3[NumLane];
+
+        for(std::size_t lane = 0; lane < NumLane; ++lane)
+        {
+            const std::uint64_t counter = first_counter + lane;
+
+            c0[lane] = static_cast<std::uint32_t>(counter);
+            c1[lane] = static_cast<std::uint32_t>(counter >> 32);
+            c2[lane] = static_cast<std::uint32_t>(stream);
+            c3[lane] = static_cast<std::uint32_t>(stream >> 32);
+        }
+
+        std::uint32_t k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+
+        for(int r = 0; r < 10; ++r)
+        {
+            for(std::size_t lane = 0; lane < NumLane; ++lane)
+            {
+                const std::uint64_t p0 = std::uint64_t{M0} * c0[lane];
+                const std::uint64_t p1 = std::uint64_t{M1} * c2[lane];
+
+                c0[lane] = static_cast<std::uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+                c2[lane] = static_cast<std::uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+                c1[lane] = static_cast<std::uint32_t>(p1);
+                c3[lane] = static_cast<std::uint32_t>(p0);
+            }
+
+            k0 += W0;
+            k1 += W1;
+        }
+
+        for(std::size_t lane = 0; lane < NumLane; ++lane)
+        {
+            out[4 * lane + 0] = c0[lane];
+            out[4 * lane + 1] = c1[lane];
+            out[4 * lane + 2] = c2[lane];
+            out[4 * lane + 3] = c3[lane];
+        }
+    }
+
+    // the upper 24 bits as a float in [0, 1)
+    static float ToUniform(std::uint32_t x)
+    {
+        return static_cast<float>(x >> 8) * (1.f / 16777216.f);
+    }
+};
+
+// Writes ck::type_convert<T>(f(u)) for values [first, first + n) of a stream to out, where u is
+// uniform in [0, 1). Values are converted a block at a time through a small buffer, which keeps
+// the f16/bf16/f8/int8 conversion loops free of the random number generation.
+template <typename T, typename OutputIt, typename F>
+OutputIt PhiloxGenerate(
+    OutputIt out, std::size_t first, std::size_t n, std::uint64_t key, std::uint64_t stream, F f)
+{
+    constexpr std::size_t BlockSize = Philox4x32::NumValuePerBlock;
+
+    std::uint32_t bits[BlockSize];
+    T values[BlockSize];
+
+    const std::size_t last = first + n;
+    for(std::size_t i = first; i < last;)
+    {
+        const std::size_t block_first = i - i % BlockSize;
+        const std::size_t begin       = i - block_first;
+        const std::size_t end         = std::min(BlockSize, last - block_first);
+
+        Philox4x32::GenerateBlock(key, stream, block_first / 4, bits);
+
+        for(std::size_t j = begin; j < end; ++j)
+            values[j] = ck::type_convert<T>(f(Philox4x32::ToUniform(bits[j])));
+
+        out = std::copy(values + begin, values + end, out);
+        i   = block_first + end;
+    }
+
+    return out;
+}
+
+// PhiloxGenerate of values [0, n) to [first, first + n), split over the host thread pool
+template <typename T, typename RandomIt, typename F>
+void ParallelPhiloxGenerate(
+    RandomIt first, std::size_t n, std::uint64_t key, std::uint64_t stream, F f)
+{
+    using Difference = typename std::iterator_traits<RandomIt>::difference_type;
+
+    auto& pool = HostThreadPool::GetInstance();
+    pool.ParallelFor(n, pool.GetNumThreads(), [&](std::size_t begin, std::size_t end) {
+        const auto out = first + static_cast<Difference>(begin);
+        PhiloxGenerate<T>(out, begin, end - begin, key, stream, f);
+    });
+}
+
+// Every tensor initialized by a counter-based generator takes a new stream, so tensors filled with
+// the same generator still differ, like they did when generators drew from std::rand.
+inline std::uint64_t NextPhiloxStream()
+{
+    static std::atomic<std::uint64_t> stream{0};
+    return stream++;
+}
+
+} // namespace utils
+} // namespace ck
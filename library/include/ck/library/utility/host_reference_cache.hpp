@@ -0,0 +1,365 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ck/utility/env.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+// directory of the host reference cache, caching is disabled when unset
+CK_DECLARE_ENV_VAR_STR(CK_REFERENCE_CACHE_DIR)
+
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+// 64-bit multiply-xorshift hash over 8-byte words, fast enough to hash reference inputs of a few
+// hundred MB without showing up next to the reference computation itself
+inline std::uint64_t host_reference_hash(const void* p, std::size_t size, std::uint64_t seed)
+{
+    constexpr std::uint64_t Mul = 0x9e3779b97f4a7c15ull;
+
+    const auto* bytes = static_cast<const unsigned char*>(p);
+    std::uint64_t h   = seed ^ (size * Mul);
+
+    auto mix = [&](std::uint64_t word) {
+        h ^= word * Mul;
+        h = (h << 31 | h >> 33) * 0xbf58476d1ce4e5b9ull;
+    };
+
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        mix(word);
+    }
+
+    std::uint64_t tail = 0;
+    if(size > i)
+        std::memcpy(&tail, bytes + i, size - i);
+    mix(tail);
+
+    h ^= h >> 29;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 32;
+
+    return h;
+}
+
+inline std::string host_reference_hex(std::uint64_t x)
+{
+    std::ostringstream oss;
+    oss << std::hex << std::setw(16) << std::setfill('0') << x;
+    return oss.str();
+}
+
+constexpr char HostReferenceCacheMagic[8] = {'C', 'K', 'R', 'E', 'F', '0', '0', '1'};
+
+} // namespace detail
+
+// Identifies a reference result by the operation, its types, the shape, strides and contents of
+// its inputs and the element-wise operations. Hashing the input contents, instead of trusting the
+// generator configuration, keeps the cache correct for any way the inputs were filled.
+//
+// A key that cannot describe its result exactly, e.g. one with an element-wise operation whose
+// parameters cannot be hashed, is not cacheable and RunCachedReference always computes it.
+class HostReferenceCacheKey
+{
+    public:
+    explicit HostReferenceCacheKey(std::string op) : key_(std::move(op)) {}
+
+    HostReferenceCacheKey& Add(const std::string& s)
+    {
+        key_ += ';' + s;
+        return *this;
+    }
+
+    // scalar parameters of the operation, e.g. convolution strides and pads
+    template <typename Range>
+    HostReferenceCacheKey& AddValues(const std::string& name, const Range& values)
+    {
+        std::ostringstream oss;
+        oss << name << ':';
+        for(const auto& v : values)
+            oss << v << ',';
+        return Add(oss.str());
+    }
+
+    template <typename T>
+    HostReferenceCacheKey& AddType()
+    {
+        return Add(std::string(typeid(T).name()) + ':' + std::to_string(sizeof(T)));
+    }
+
+    // accumulation and compute types of the reference, which change its result for the same inputs
+    template <typename AccDataType,
+              typename ComputeTypeA = AccDataType,
+              typename ComputeTypeB = ComputeTypeA>
+    HostReferenceCacheKey& AddComputeTypes()
+    {
+        Add("acc");
+        AddType<AccDataType>();
+        Add("compute");
+        AddType<ComputeTypeA>();
+        return AddType<ComputeTypeB>();
+    }
+
+    template <typename Desc>
+    HostReferenceCacheKey& AddDescriptor(const Desc& desc)
+    {
+        std::ostringstream oss;
+        oss << "lengths:";
+        for(auto l : desc.GetLengths())
+            oss << l << ',';
+        oss << "strides:";
+        for(auto s : desc.GetStrides())
+            oss << s << ',';
+        return Add(oss.str());
+    }
+
+    template <typename T, typename Desc>
+    HostReferenceCacheKey& AddTensor(const Tensor<T, Desc>& tensor)
+    {
+        const auto hash =
+            detail::host_reference_hash(tensor.mData.data(), tensor.mData.size() * sizeof(T), 0);
+
+        return AddType<T>().AddDescriptor(tensor.mDesc).Add("data:" +
+                                                            detail::host_reference_hex(hash));
+    }
+
+    // the parameters of element-wise operations (scales, alpha/beta, ...) are part of the key.
+    // Only trivially copyable operations are hashed by their bytes; any other stateful operation
+    // makes the key uncacheable unless its parameters are passed with the overload below.
+    template <typename ElementOp>
+    HostReferenceCacheKey& AddElementOp(const ElementOp& op)
+    {
+        AddType<ElementOp>();
+
+        if constexpr(std::is_empty_v<ElementOp>)
+        {
+            return *this;
+        }
+        else if constexpr(std::is_trivially_copyable_v<ElementOp>)
+        {
+            const auto hash = detail::host_reference_hash(&op, sizeof(op), 0);
+            return Add("params:" + detail::host_reference_hex(hash));
+        }
+        else
+        {
+            cacheable_ = false;
+            return *this;
+        }
+    }
+
+    // element-wise operation with a caller provided hash of all of its runtime parameters
+    template <typename ElementOp>
+    HostReferenceCacheKey& AddElementOp(const ElementOp&, std::uint64_t params_hash)
+    {
+        return AddType<ElementOp>().Add("params:" + detail::host_reference_hex(params_hash));
+    }
+
+    bool IsCacheable() const { return cacheable_; }
+
+    const std::string& GetString() const { return key_; }
+
+    std::uint64_t GetHash() const
+    {
+        return detail::host_reference_hash(key_.data(), key_.size(), 0);
+    }
+
+    private:
+    std::string key_;
+    bool cacheable_ = true;
+};
+
+// Content-addressed store of host reference outputs, one file per key in a directory.
+//
+// A file holds a magic number, the full key (to rule out hash collisions) and the raw output. It
+// is written to a temporary name and renamed into place, so concurrent jobs sharing the directory
+// never read a partial file. Loading maps the file and copies the output out of the mapping.
+class HostReferenceCache
+{
+    public:
+    explicit HostReferenceCache(std::string dir) : dir_(std::move(dir)) {}
+
+    // the cache in CK_REFERENCE_CACHE_DIR, disabled if the variable is unset or empty
+    static const HostReferenceCache& GetDefault()
+    {
+        static const HostReferenceCache cache(ck::EnvGetString(CK_ENV(CK_REFERENCE_CACHE_DIR)));
+        return cache;
+    }
+
+    bool IsEnabled() const { return !dir_.empty(); }
+
+    std::string GetPath(const HostReferenceCacheKey& key) const
+    {
+        return dir_ + '/' + detail::host_reference_hex(key.GetHash()) + ".ckref";
+    }
+
+    // copies the cached output into dst, returns false if the key is not cached with that size
+    bool Load(const HostReferenceCacheKey& key, void* dst, std::size_t size) const
+    {
+        if(!IsEnabled())
+            return false;
+
+        constexpr std::size_t MagicSize = sizeof(detail::HostReferenceCacheMagic);
+
+        const std::string& key_str = key.GetString();
+        const std::size_t offset   = MagicSize + 2 * sizeof(std::uint64_t) + key_str.size();
+
+        bool found = false;
+        auto check = [&](const char* file, std::size_t file_size) {
+            if(file_size != offset + size)
+                return;
+
+            std::uint64_t key_size  = 0;
+            std::uint64_t data_size = 0;
+            const char* p           = file + MagicSize;
+            std::memcpy(&key_size, p, sizeof(key_size));
+            std::memcpy(&data_size, p + sizeof(key_size), sizeof(data_size));
+            p += 2 * sizeof(std::uint64_t);
+
+            if(std::memcmp(file, detail::HostReferenceCacheMagic, MagicSize) != 0 ||
+               key_size != key_str.size() || data_size != size ||
+               std::memcmp(p, key_str.data(), key_str.size()) != 0)
+                return;
+
+            std::memcpy(dst, file + offset, size);
+            found = true;
+        };
+
+#ifndef _WIN32
+        const int fd = ::open(GetPath(key).c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat st;
+        if(::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            const auto file_size = static_cast<std::size_t>(st.st_size);
+            void* file           = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(file != MAP_FAILED)
+            {
+                check(static_cast<const char*>(file), file_size);
+                ::munmap(file, file_size);
+            }
+        }
+        ::close(fd);
+#else
+        std::ifstream in(GetPath(key), std::ios::binary);
+        const std::vector<char> file((std::istreambuf_iterator<char>(in)),
+                                     std::istreambuf_iterator<char>());
+        check(file.data(), file.size());
+#endif
+
+        return found;
+    }
+
+    bool Store(const HostReferenceCacheKey& key, const void* src, std::size_t size) const
+    {
+        if(!IsEnabled())
+            return false;
+
+        const std::string& key_str = key.GetString();
+        const std::string path     = GetPath(key);
+
+        // unique per process and thread, so concurrent writers of one key do not interleave
+        const auto thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        std::string tmp_path   = path + ".tmp." + std::to_string(thread_hash);
+#ifndef _WIN32
+        tmp_path += '.' + std::to_string(::getpid());
+#endif
+        {
+            std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+            if(!out)
+                return false;
+
+            const std::uint64_t key_size  = key_str.size();
+            const std::uint64_t data_size = size;
+
+            out.write(detail::HostReferenceCacheMagic, sizeof(detail::HostReferenceCacheMagic));
+            out.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+            out.write(reinterpret_cast<const char*>(&data_size), sizeof(data_size));
+            out.write(key_str.data(), static_cast<std::streamsize>(key_str.size()));
+            out.write(static_cast<const char*>(src), static_cast<std::streamsize>(size));
+
+            if(!out.flush())
+            {
+                std::remove(tmp_path.c_str());
+                return false;
+            }
+        }
+
+        if(std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    private:
+    std::string dir_;
+};
+
+// Fills out from the cache, or runs compute() to fill it and stores the result. The shape and
+// strides of out are added to the key. Returns whether the result came from the cache.
+template <typename T, typename Desc, typename Compute>
+bool RunCachedReference(const HostReferenceCache& cache,
+                        HostReferenceCacheKey key,
+                        Tensor<T, Desc>& out,
+                        Compute&& compute)
+{
+    if(!key.IsCacheable())
+    {
+        compute();
+        return false;
+    }
+
+    key.AddType<T>().AddDescriptor(out.mDesc);
+
+    const std::size_t size = out.mData.size() * sizeof(T);
+
+    if(cache.Load(key, out.mData.data(), size))
+        return true;
+
+    compute();
+    cache.Store(key, out.mData.data(), size);
+
+    return false;
+}
+
+template <typename T, typename Desc, typename Compute>
+bool RunCachedReference(const HostReferenceCacheKey& key, Tensor<T, Desc>& out, Compute&& compute)
+{
+    return RunCachedReference(HostReferenceCache::GetDefault(), key, out, compute);
+}
+
+} // namespace utils
+} // namespace ck
@@ -4,10 +4,14 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <stdexcept>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -16,6 +20,9 @@
 #include "ck/utility/type_convert.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/host_philox.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 template <typename Range>
@@ -127,11 +134,13 @@ struct HostTensorDescriptor
     std::size_t GetOffsetFromMultiIndex(Is... is) const
     {
         assert(sizeof...(Is) == this->GetNumOfDimension());
-        std::initializer_list<std::size_t> iss{static_cast<std::size_t>(is)...};
-        return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
+        std::size_t offset = 0;
+        std::size_t idim   = 0;
+        ((offset += static_cast<std::size_t>(is) * mStrides[idim++]), ...);
+        return offset;
     }
 
-    std::size_t GetOffsetFromMultiIndex(std::vector<std::size_t> iss) const
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
     {
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
@@ -143,6 +152,201 @@ struct HostTensorDescriptor
     std::vector<std::size_t> mStrides;
 };
 
+// Host tensor descriptor whose number of dimensions is known at compile time. Lengths and strides
+// are kept in std::array, so offset computation is allocation free and fully unrolled.
+template <std::size_t NumDim>
+struct HostTensorDescriptorN
+{
+    static_assert(NumDim > 0, "wrong! HostTensorDescriptorN needs at least one dimension");
+
+    static constexpr std::size_t NumOfDimension = NumDim;
+
+    using Indices = std::array<std::size_t, NumDim>;
+
+    HostTensorDescriptorN() = default;
+
+    template <typename X, typename = std::enable_if_t<std::is_convertible_v<X, std::size_t>>>
+    HostTensorDescriptorN(const std::initializer_list<X>& lens)
+    {
+        Assign(mLens, lens);
+        this->CalculateStrides();
+    }
+
+    template <typename Lengths,
+              typename = std::enable_if_t<
+                  std::is_convertible_v<ck::ranges::range_value_t<Lengths>, std::size_t>>>
+    HostTensorDescriptorN(const Lengths& lens)
+    {
+        Assign(mLens, lens);
+        this->CalculateStrides();
+    }
+
+    template <typename X,
+              typename Y,
+              typename = std::enable_if_t<std::is_convertible_v<X, std::size_t> &&
+                                          std::is_convertible_v<Y, std::size_t>>>
+    HostTensorDescriptorN(const std::initializer_list<X>& lens,
+                          const std::initializer_list<Y>& strides)
+    {
+        Assign(mLens, lens);
+        Assign(mStrides, strides);
+        this->UpdateIsPacked();
+    }
+
+    template <typename Lengths,
+              typename Strides,
+              typename = std::enable_if_t<
+                  std::is_convertible_v<ck::ranges::range_value_t<Lengths>, std::size_t> &&
+                  std::is_convertible_v<ck::ranges::range_value_t<Strides>, std::size_t>>>
+    HostTensorDescriptorN(const Lengths& lens, const Strides& strides)
+    {
+        Assign(mLens, lens);
+        Assign(mStrides, strides);
+        this->UpdateIsPacked();
+    }
+
+    explicit HostTensorDescriptorN(const HostTensorDescriptor& desc)
+        : HostTensorDescriptorN(desc.GetLengths(), desc.GetStrides())
+    {
+    }
+
+    operator HostTensorDescriptor() const { return HostTensorDescriptor(mLens, mStrides); }
+
+    std::size_t GetNumOfDimension() const { return NumDim; }
+
+    std::size_t GetElementSize() const
+    {
+        return std::accumulate(
+            mLens.begin(), mLens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    }
+
+    std::size_t GetElementSpaceSize() const
+    {
+        std::size_t space = 1;
+        for(std::size_t i = 0; i < NumDim; ++i)
+        {
+            if(mLens[i] == 0)
+                continue;
+
+            space += (mLens[i] - 1) * mStrides[i];
+        }
+        return space;
+    }
+
+    const Indices& GetLengths() const { return mLens; }
+    const Indices& GetStrides() const { return mStrides; }
+
+    // true if the strides are the row-major packed strides of the lengths, in which case the
+    // offset of an element equals its linear index
+    bool IsPacked() const { return mIsPacked; }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        static_assert(sizeof...(Is) == NumDim, "wrong! number of indices must match the rank");
+        return GetOffsetFromMultiIndexImpl(std::make_index_sequence<NumDim>{}, is...);
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const Indices& iss) const
+    {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < NumDim; ++i)
+            offset += iss[i] * mStrides[i];
+        return offset;
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
+    {
+        assert(iss.size() == NumDim);
+        return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
+    }
+
+    // multi-index of the element with the given linear (row-major) index
+    Indices GetMultiIndexFromLinearIndex(std::size_t i) const
+    {
+        Indices iss;
+        for(std::size_t idim = NumDim; idim-- > 0;)
+        {
+            iss[idim] = i % mLens[idim];
+            i /= mLens[idim];
+        }
+        return iss;
+    }
+
+    // advances iss to the next element in row-major order
+    void MoveToNextMultiIndex(Indices& iss) const
+    {
+        for(std::size_t idim = NumDim; idim-- > 0;)
+        {
+            if(++iss[idim] < mLens[idim])
+                return;
+            iss[idim] = 0;
+        }
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const HostTensorDescriptorN& desc)
+    {
+        return os << HostTensorDescriptor(desc);
+    }
+
+    private:
+    template <typename Range>
+    static void Assign(Indices& dst, const Range& src)
+    {
+        if(static_cast<std::size_t>(std::distance(std::begin(src), std::end(src))) != NumDim)
+            throw std::runtime_error("wrong! rank mismatch in HostTensorDescriptorN");
+
+        std::copy(std::begin(src), std::end(src), dst.begin());
+    }
+
+    template <std::size_t... Ds, typename... Is>
+    std::size_t GetOffsetFromMultiIndexImpl(std::index_sequence<Ds...>, Is... is) const
+    {
+        return ((static_cast<std::size_t>(is) * mStrides[Ds]) + ...);
+    }
+
+    void CalculateStrides()
+    {
+        mStrides.back() = 1;
+        std::partial_sum(mLens.rbegin(),
+                         mLens.rend() - 1,
+                         mStrides.rbegin() + 1,
+                         std::multiplies<std::size_t>());
+        mIsPacked = true;
+    }
+
+    void UpdateIsPacked()
+    {
+        std::size_t packed_stride = 1;
+
+        mIsPacked = true;
+        for(std::size_t idim = NumDim; idim-- > 0;)
+        {
+            if(mLens[idim] != 1 && mStrides[idim] != packed_stride)
+                mIsPacked = false;
+            packed_stride *= mLens[idim];
+        }
+    }
+
+    Indices mLens{};
+    Indices mStrides{};
+    bool mIsPacked = false;
+};
+
+template <typename Descriptor>
+struct is_fixed_rank_host_tensor_descriptor : std::false_type
+{
+};
+
+template <std::size_t NumDim>
+struct is_fixed_rank_host_tensor_descriptor<HostTensorDescriptorN<NumDim>> : std::true_type
+{
+};
+
+template <typename Descriptor>
+inline constexpr bool is_fixed_rank_host_tensor_descriptor_v =
+    is_fixed_rank_host_tensor_descriptor<Descriptor>::value;
+
 template <typename New2Old>
 HostTensorDescriptor transpose_host_tensor_descriptor_given_new2old(const HostTensorDescriptor& a,
                                                                     const New2Old& new2old)
@@ -208,25 +412,31 @@ struct ParallelTensorFunctor
         return indices;
     }
 
-    void operator()(std::size_t num_thread = 1) const
+    // advances indices to the next element in row-major order
+    void NextNdIndices(std::array<std::size_t, NDIM>& indices) const
     {
-        std::size_t work_per_thread = (mN1d + num_thread - 1) / num_thread;
-
-        std::vector<joinable_thread> threads(num_thread);
-
-        for(std::size_t it = 0; it < num_thread; ++it)
+        for(std::size_t idim = NDIM; idim-- > 0;)
         {
-            std::size_t iw_begin = it * work_per_thread;
-            std::size_t iw_end   = std::min((it + 1) * work_per_thread, mN1d);
+            if(++indices[idim] < mLens[idim])
+                return;
+            indices[idim] = 0;
+        }
+    }
+
+    // the elements are distributed over the process-wide HostThreadPool, every sub-range decodes
+    // its first index once and then steps through the remaining ones incrementally
+    void operator()(std::size_t num_thread = 1) const
+    {
+        ck::utils::HostThreadPool::GetInstance().ParallelFor(
+            mN1d, num_thread, [&](std::size_t iw_begin, std::size_t iw_end) {
+                auto indices = GetNdIndices(iw_begin);
 
-            auto f = [=] {
                 for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
                 {
-                    call_f_unpack_args(mF, GetNdIndices(iw));
+                    call_f_unpack_args(mF, indices);
+                    NextNdIndices(indices);
                 }
-            };
-            threads[it] = joinable_thread(f);
-        }
+            });
     }
 };
 
@@ -236,10 +446,30 @@ auto make_ParallelTensorFunctor(F f, Xs... xs)
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
-template <typename T>
+// Generators with a GenerateTensorBulk(g, out, first, n, stream) overload, found by argument
+// dependent lookup, produce any range of elements at once (see host_tensor_generator.hpp).
+template <typename G, typename T, typename = void>
+struct is_bulk_tensor_generator : std::false_type
+{
+};
+
+template <typename G, typename T>
+struct is_bulk_tensor_generator<
+    G,
+    T,
+    std::void_t<decltype(GenerateTensorBulk(std::declval<const G&>(),
+                                            std::declval<T*>(),
+                                            std::size_t{},
+                                            std::size_t{},
+                                            std::uint64_t{}))>> : std::true_type
+{
+};
+
+// Descriptor is HostTensorDescriptor (rank known at runtime) or HostTensorDescriptorN<Rank>
+template <typename T, typename Desc = HostTensorDescriptor>
 struct Tensor
 {
-    using Descriptor = HostTensorDescriptor;
+    using Descriptor = Desc;
     using Data       = std::vector<T>;
 
     template <typename X>
@@ -267,12 +497,12 @@ struct Tensor
     Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
 
     template <typename OutT>
-    Tensor<OutT> CopyAsType() const
+    Tensor<OutT, Descriptor> CopyAsType() const
     {
-        Tensor<OutT> ret(mDesc);
+        Tensor<OutT, Descriptor> ret(mDesc);
 
-        ck::ranges::transform(
-            mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
+        ck::utils::bulk_type_convert<OutT, T>(mData,
+                                              ck::span<OutT>(ret.mData.data(), ret.mData.size()));
 
         return ret;
     }
@@ -287,7 +517,15 @@ struct Tensor
     Tensor& operator=(Tensor&&) = default;
 
     template <typename FromT>
-    explicit Tensor(const Tensor<FromT>& other) : Tensor(other.template CopyAsType<T>())
+    explicit Tensor(const Tensor<FromT, Descriptor>& other)
+        : Tensor(other.template CopyAsType<T>())
+    {
+    }
+
+    // switches between the runtime-rank and the fixed-rank descriptor, keeping the data
+    template <typename FromDesc,
+              typename = std::enable_if_t<!std::is_same_v<FromDesc, Descriptor>>>
+    explicit Tensor(const Tensor<T, FromDesc>& other) : mDesc(other.mDesc), mData(other.mData)
     {
     }
 
@@ -351,9 +589,109 @@ struct Tensor
         ForEach_impl(std::forward<const F>(f), idx, size_t(0));
     }
 
+    // Counter-based generators: element i in row-major order only depends on i and a stream drawn
+    // for this call, so the whole thread pool is used regardless of num_thread and the result is
+    // the same for any number of threads. Row-major packed tensors are generated in place.
     template <typename G>
+    void GenerateTensorValueBulk(const G& g)
+    {
+        const auto& lens    = mDesc.GetLengths();
+        const auto& strides = mDesc.GetStrides();
+        const auto stream   = ck::utils::NextPhiloxStream();
+        const std::size_t n = mDesc.GetElementSize();
+        const auto rank     = lens.size();
+
+        bool row_major     = true;
+        std::size_t stride = 1;
+        for(std::size_t d = rank; d-- > 0;)
+        {
+            row_major = row_major && (lens[d] == 1 || strides[d] == stride);
+            stride *= lens[d];
+        }
+
+        auto& pool = ck::utils::HostThreadPool::GetInstance();
+        pool.ParallelFor(n, pool.GetNumThreads(), [&](std::size_t begin, std::size_t end) {
+            if(row_major)
+            {
+                GenerateTensorBulk(g, mData.data() + begin, begin, end - begin, stream);
+                return;
+            }
+
+            std::vector<T> values(end - begin);
+            GenerateTensorBulk(g, values.data(), begin, end - begin, stream);
+
+            std::vector<std::size_t> indices(rank);
+            for(std::size_t d = rank, i = begin; d-- > 0;)
+            {
+                indices[d] = i % lens[d];
+                i /= lens[d];
+            }
+
+            for(const auto& value : values)
+            {
+                std::size_t offset = 0;
+                for(std::size_t d = 0; d < rank; ++d)
+                    offset += indices[d] * strides[d];
+
+                mData[offset] = value;
+
+                for(std::size_t d = rank; d-- > 0;)
+                {
+                    if(++indices[d] < lens[d])
+                        break;
+                    indices[d] = 0;
+                }
+            }
+        });
+    }
+
+    // fixed rank: walks the elements linearly, a packed tensor is written without any offset math
+    template <typename G,
+              typename D                                                      = Descriptor,
+              std::enable_if_t<is_fixed_rank_host_tensor_descriptor_v<D>, bool> = false>
+    void GenerateTensorValue(G g, std::size_t num_thread = 1)
+    {
+        if constexpr(is_bulk_tensor_generator<G, T>::value)
+        {
+            GenerateTensorValueBulk(g);
+            return;
+        }
+
+        ck::utils::HostThreadPool::GetInstance().ParallelFor(
+            mDesc.GetElementSize(), num_thread, [&](std::size_t iw_begin, std::size_t iw_end) {
+                auto indices = mDesc.GetMultiIndexFromLinearIndex(iw_begin);
+
+                if(mDesc.IsPacked())
+                {
+                    for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+                    {
+                        mData[iw] = call_f_unpack_args(g, indices);
+                        mDesc.MoveToNextMultiIndex(indices);
+                    }
+                }
+                else
+                {
+                    for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+                    {
+                        mData[mDesc.GetOffsetFromMultiIndex(indices)] =
+                            call_f_unpack_args(g, indices);
+                        mDesc.MoveToNextMultiIndex(indices);
+                    }
+                }
+            });
+    }
+
+    template <typename G,
+              typename D                                                       = Descriptor,
+              std::enable_if_t<!is_fixed_rank_host_tensor_descriptor_v<D>, bool> = false>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
+        if constexpr(is_bulk_tensor_generator<G, T>::value)
+        {
+            GenerateTensorValueBulk(g);
+            return;
+        }
+
         switch(mDesc.GetNumOfDimension())
         {
         case 1: {
@@ -461,12 +799,12 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    T& operator()(std::vector<std::size_t> idx)
+    T& operator()(const std::vector<std::size_t>& idx)
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
 
-    const T& operator()(std::vector<std::size_t> idx) const
+    const T& operator()(const std::vector<std::size_t>& idx) const
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
@@ -1,14 +1,18 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <random>
 
 #include "ck/ck.hpp"
 
+#include "ck/library/utility/host_philox.hpp"
+
 template <typename T>
 struct GeneratorTensor_0
 {
@@ -223,6 +227,40 @@ struct GeneratorTensor_3<ck::bf8_t>
 };
 #endif
 
+// Counter-based versions of GeneratorTensor_2 and GeneratorTensor_3 used by
+// Tensor::GenerateTensorValue: values [first, first + n) of `stream` are written to out. They
+// follow the distributions of the per-element operator(), but do not share the std::rand state,
+// so tensors are filled in parallel and identically for any number of threads.
+template <typename T, typename Y>
+void GenerateTensorBulk(const GeneratorTensor_2<T>& g,
+                        Y* out,
+                        std::size_t first,
+                        std::size_t n,
+                        std::uint64_t stream)
+{
+    const float min_value = g.min_value;
+    const float max_value = g.max_value - 1;
+    const float range     = g.max_value - g.min_value;
+
+    ck::utils::PhiloxGenerate<T>(out, first, n, 0, stream, [=](float u) {
+        return std::min(std::floor(min_value + u * range), max_value);
+    });
+}
+
+template <typename T, typename Y>
+void GenerateTensorBulk(const GeneratorTensor_3<T>& g,
+                        Y* out,
+                        std::size_t first,
+                        std::size_t n,
+                        std::uint64_t stream)
+{
+    const float min_value = g.min_value;
+    const float range     = g.max_value - g.min_value;
+
+    ck::utils::PhiloxGenerate<T>(
+        out, first, n, 0, stream, [=](float u) { return min_value + u * range; });
+}
+
 template <typename T>
 struct GeneratorTensor_4
 {
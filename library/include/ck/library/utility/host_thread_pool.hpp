@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Process-wide pool of host worker threads used by the CPU reference operations.
+//
+// ParallelFor splits [0, n) into chunks. Every participating thread (the caller is one of them)
+// starts with a contiguous run of chunks, pops chunks from the front of its own run and, once it is
+// empty, steals the back half of the run of another participant. This keeps the memory locality of
+// static partitioning while balancing ragged workloads.
+//
+// The workers are created on first use and live until the process exits. Calls issued from inside a
+// ParallelFor body, or while another thread owns the pool, run serially on the calling thread.
+//
+// If f throws, the remaining chunks are skipped and the first exception is rethrown on the calling
+// thread once every participant has left the job.
+class HostThreadPool
+{
+    public:
+    static HostThreadPool& GetInstance()
+    {
+        static HostThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    // pool of num_thread threads in total, the calling thread of ParallelFor being one of them
+    explicit HostThreadPool(std::size_t num_thread) : ranges_(std::max<std::size_t>(num_thread, 1))
+    {
+        workers_.reserve(ranges_.size() - 1);
+        for(std::size_t id = 1; id < ranges_.size(); ++id)
+            workers_.emplace_back([this, id] { WorkerLoop(id); });
+    }
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+
+    ~HostThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+
+        for(auto& t : workers_)
+            t.join();
+    }
+
+    // number of threads that can work on a ParallelFor, including the calling thread
+    std::size_t GetNumThreads() const { return workers_.size() + 1; }
+
+    // Invokes f(begin, end) on disjoint sub-ranges covering [0, n), using at most max_threads
+    // threads. Returns once all sub-ranges have been processed.
+    template <typename F>
+    void ParallelFor(std::size_t n, std::size_t max_threads, F&& f)
+    {
+        if(n == 0)
+            return;
+
+        const std::size_t num_participant = std::min({max_threads, GetNumThreads(), n});
+
+        if(num_participant <= 1 || tls_in_parallel_region())
+        {
+            f(std::size_t{0}, n);
+            return;
+        }
+
+        std::unique_lock<std::mutex> submit_lock(submit_mutex_, std::try_to_lock);
+        if(!submit_lock.owns_lock())
+        {
+            f(std::size_t{0}, n);
+            return;
+        }
+
+        // a few chunks per participant leave room for stealing without making chunks tiny
+        const std::size_t num_chunk  = std::min(n, num_participant * ChunksPerThread);
+        const std::size_t chunk_size = (n + num_chunk - 1) / num_chunk;
+
+        auto body = [&](std::size_t chunk) {
+            const std::size_t begin = chunk * chunk_size;
+            const std::size_t end   = std::min(begin + chunk_size, n);
+            if(begin < end)
+                f(begin, end);
+        };
+
+        Job job{&invoke_chunk<decltype(body)>, &body, num_participant, num_chunk};
+        Run(job);
+    }
+
+    private:
+    static constexpr std::size_t ChunksPerThread = 16;
+
+    // [begin, end) run of chunk indices packed into one word so owner and thieves can update it
+    // with a single compare-exchange
+    struct alignas(64) ChunkRange
+    {
+        std::atomic<std::uint64_t> range{0};
+    };
+
+    static std::uint64_t pack(std::uint64_t begin, std::uint64_t end) { return begin << 32 | end; }
+    static std::uint64_t range_begin(std::uint64_t r) { return r >> 32; }
+    static std::uint64_t range_end(std::uint64_t r) { return r & 0xffffffffu; }
+
+    struct Job
+    {
+        void (*invoke)(void*, std::size_t);
+        void* body;
+        std::size_t num_participant;
+        std::size_t num_chunk;
+    };
+
+    template <typename Body>
+    static void invoke_chunk(void* body, std::size_t chunk)
+    {
+        (*static_cast<Body*>(body))(chunk);
+    }
+
+    static bool& tls_in_parallel_region()
+    {
+        static thread_local bool in_parallel_region = false;
+        return in_parallel_region;
+    }
+
+    // marks the current thread as running a ParallelFor body for the lifetime of the object
+    struct ParallelRegionGuard
+    {
+        ParallelRegionGuard() { tls_in_parallel_region() = true; }
+        ~ParallelRegionGuard() { tls_in_parallel_region() = false; }
+    };
+
+    void Run(const Job& job)
+    {
+        // static initial partition of the chunks over the participants
+        for(std::size_t p = 0; p < job.num_participant; ++p)
+        {
+            const std::uint64_t begin = p * job.num_chunk / job.num_participant;
+            const std::uint64_t end   = (p + 1) * job.num_chunk / job.num_participant;
+            ranges_[p].range.store(pack(begin, end), std::memory_order_relaxed);
+        }
+        cancelled_.store(false, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_         = &job;
+            num_pending_ = job.num_participant - 1;
+            ++generation_;
+        }
+        wake_cv_.notify_all();
+
+        Participate(job, 0);
+
+        // the workers still reference job and the body on our stack, wait for them even on failure
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_cv_.wait(lock, [this] { return num_pending_ == 0; });
+            job_ = nullptr;
+            std::swap(exception, exception_);
+        }
+
+        if(exception)
+            std::rethrow_exception(exception);
+    }
+
+    void WorkerLoop(std::size_t id)
+    {
+        std::uint64_t seen_generation = 0;
+
+        for(;;)
+        {
+            const Job* job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_cv_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+                if(stop_)
+                    return;
+                seen_generation = generation_;
+                job             = job_;
+            }
+
+            // the job may already be finished if this worker was not needed for it
+            if(job == nullptr || id >= job->num_participant)
+                continue;
+
+            Participate(*job, id);
+
+            bool last = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                last = --num_pending_ == 0;
+            }
+            if(last)
+                done_cv_.notify_one();
+        }
+    }
+
+    // never throws, the first exception of the job is kept in exception_ for Run to rethrow
+    void Participate(const Job& job, std::size_t id)
+    {
+        ParallelRegionGuard guard;
+
+        std::size_t chunk = 0;
+        while(!cancelled_.load(std::memory_order_relaxed) &&
+              (PopOwn(id, chunk) || Steal(job, id, chunk)))
+        {
+            try
+            {
+                job.invoke(job.body, chunk);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(!exception_)
+                    exception_ = std::current_exception();
+                cancelled_.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool PopOwn(std::size_t id, std::size_t& chunk)
+    {
+        auto& range       = ranges_[id].range;
+        std::uint64_t cur = range.load(std::memory_order_acquire);
+
+        while(range_begin(cur) < range_end(cur))
+        {
+            if(range.compare_exchange_weak(cur,
+                                           pack(range_begin(cur) + 1, range_end(cur)),
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+            {
+                chunk = range_begin(cur);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // moves the back half of the largest remaining run of another participant to our own run
+    bool Steal(const Job& job, std::size_t id, std::size_t& chunk)
+    {
+        for(;;)
+        {
+            std::size_t victim   = id;
+            std::uint64_t remain = 0;
+
+            for(std::size_t p = 0; p < job.num_participant; ++p)
+            {
+                const std::uint64_t r = ranges_[p].range.load(std::memory_order_acquire);
+                if(p != id && range_end(r) - range_begin(r) > remain)
+                {
+                    victim = p;
+                    remain = range_end(r) - range_begin(r);
+                }
+            }
+
+            if(victim == id)
+                return false;
+
+            auto& range       = ranges_[victim].range;
+            std::uint64_t cur = range.load(std::memory_order_acquire);
+
+            const std::uint64_t begin = range_begin(cur);
+            const std::uint64_t end   = range_end(cur);
+            if(begin >= end)
+                continue;
+
+            const std::uint64_t mid = begin + (end - begin) / 2;
+            if(!range.compare_exchange_strong(
+                   cur, pack(begin, mid), std::memory_order_acq_rel, std::memory_order_acquire))
+                continue;
+
+            // [mid, end) is ours now, run the first stolen chunk right away
+            ranges_[id].range.store(pack(mid + 1, end), std::memory_order_release);
+            chunk = mid;
+            return true;
+        }
+    }
+
+    std::vector<ChunkRange> ranges_;
+    std::vector<std::thread> workers_;
+
+    std::mutex submit_mutex_;
+    std::atomic<bool> cancelled_{false};
+
+    std::mutex mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable done_cv_;
+    const Job* job_           = nullptr;
+    std::uint64_t generation_ = 0;
+    std::size_t num_pending_  = 0;
+    std::exception_ptr exception_;
+    bool stop_ = false;
+};
+
+} // namespace utils
+} // namespace ck
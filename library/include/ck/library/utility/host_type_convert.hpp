@@ -0,0 +1,406 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/f8_utils.hpp"
+#include "ck/utility/random_gen.hpp"
+#include "ck/utility/span.hpp"
+#include "ck/utility/type_convert.hpp"
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_HOST_TYPE_CONVERT_X86 1
+#include <immintrin.h>
+#else
+#define CK_HOST_TYPE_CONVERT_X86 0
+#endif
+
+namespace ck {
+namespace utils {
+
+// rounding of bulk_type_convert when the destination type is bhalf_t, f8_t or bf8_t
+enum struct ConvertRounding
+{
+    Default,     // as type_convert: truncation for bhalf_t, CK_USE_SR_F8_CONVERSION for f8/bf8
+    NearestEven, // as bf16_convert_rtn and f8_convert_rne
+    Stochastic,  // as f8_convert_sr, but seeded with the index of the element
+};
+
+namespace detail {
+
+// same seed as f8_convert_sr
+inline constexpr uint32_t stochastic_rounding_seed = 1254739;
+
+#if CK_USE_SR_F8_CONVERSION
+inline constexpr bool f8_default_stochastic = true;
+#else
+inline constexpr bool f8_default_stochastic = false;
+#endif
+
+template <typename T>
+inline constexpr bool is_host_f8_v = is_same_v<T, f8_t> || is_same_v<T, bf8_t>;
+
+// the random bits f8_convert_sr uses for x, with the element index as id. Unlike its address, the
+// index makes the result reproducible and independent of how the span is split across threads.
+template <typename T>
+uint32_t stochastic_rounding_bits(T x, std::size_t index)
+{
+    return prand_generator<T, stochastic_rounding_seed>(
+        static_cast<index_t>(static_cast<uint32_t>(index)), x);
+}
+
+// fp32 to bf16 with stochastic rounding, NaN and Inf are kept like bf16_convert_rtn does
+inline bhalf_t bf16_convert_sr(float x, std::size_t index)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    if((~bits & 0x7f800000) != 0)
+        bits += stochastic_rounding_bits(x, index) & 0xffff;
+    else if((bits & 0xffff) != 0)
+        bits |= 0x10000;
+
+    return static_cast<bhalf_t>(bits >> 16);
+}
+
+// Scalar conversion of the element at index. The bulk kernels below match it bit for bit.
+template <typename Dst, typename Src>
+Dst scalar_type_convert(Src x, ConvertRounding rounding, std::size_t index)
+{
+    if constexpr(is_same_v<Dst, bhalf_t> && (is_same_v<Src, float> || is_same_v<Src, half_t>))
+    {
+        const float x_fp32 = type_convert<float>(x);
+
+        if(rounding == ConvertRounding::NearestEven)
+            return bf16_convert_rtn<bhalf_t>(x_fp32);
+        else if(rounding == ConvertRounding::Stochastic)
+            return bf16_convert_sr(x_fp32, index);
+        else
+            return type_convert<bhalf_t>(x_fp32);
+    }
+    else if constexpr(is_host_f8_v<Dst> && (is_same_v<Src, float> || is_same_v<Src, half_t>))
+    {
+        const bool stochastic =
+            rounding == ConvertRounding::Stochastic ||
+            (rounding == ConvertRounding::Default && f8_default_stochastic);
+
+        if(stochastic)
+            return cast_to_f8<Src, Dst, true, true, true>(x, stochastic_rounding_bits(x, index));
+        else
+            return f8_convert_rne<Dst>(x);
+    }
+    else
+    {
+        std::ignore = rounding;
+        std::ignore = index;
+        return type_convert<Dst>(x);
+    }
+}
+
+// every f8/bf8 code decoded once, decoding is then a table lookup
+template <typename Dst, typename Src>
+const std::array<Dst, 256>& f8_decode_table()
+{
+    static const auto table = [] {
+        std::array<Dst, 256> t{};
+        for(std::size_t i = 0; i < t.size(); ++i)
+        {
+            const auto bits = static_cast<uint8_t>(i);
+            Src x;
+            std::memcpy(&x, &bits, sizeof(x));
+            t[i] = type_convert<Dst>(x);
+        }
+        return t;
+    }();
+    return table;
+}
+
+#if CK_HOST_TYPE_CONVERT_X86
+struct HostConvertIsa
+{
+    bool avx2_f16c_;
+    bool avx512f_;
+
+    static const HostConvertIsa& Get()
+    {
+        static const HostConvertIsa isa{
+            __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c"),
+            __builtin_cpu_supports("avx512f") != 0};
+        return isa;
+    }
+};
+
+__attribute__((target("avx2,f16c"))) inline void
+convert_half_to_float_avx2(const half_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+        _mm256_storeu_ps(p_dst + i, _mm256_cvtph_ps(x));
+    }
+    for(; i < n; ++i)
+        p_dst[i] = type_convert<float>(p_src[i]);
+}
+
+// vcvtps2ph rounds to nearest even like the conversion of float to _Float16
+__attribute__((target("avx2,f16c"))) inline void
+convert_float_to_half_avx2(const float* p_src, half_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(p_src + i), _MM_FROUND_TO_NEAREST_INT));
+    for(; i < n; ++i)
+        p_dst[i] = type_convert<half_t>(p_src[i]);
+}
+
+__attribute__((target("avx512f"))) inline void
+convert_half_to_float_avx512(const half_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+        _mm512_storeu_ps(
+            p_dst + i,
+            _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i))));
+    for(; i < n; ++i)
+        p_dst[i] = type_convert<float>(p_src[i]);
+}
+
+__attribute__((target("avx512f"))) inline void
+convert_float_to_half_avx512(const float* p_src, half_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i),
+                            _mm512_cvtps_ph(_mm512_loadu_ps(p_src + i), _MM_FROUND_TO_NEAREST_INT));
+    for(; i < n; ++i)
+        p_dst[i] = type_convert<half_t>(p_src[i]);
+}
+
+// fp32 to bf16 with the integer rounding of scalar_type_convert. vcvtneps2bf16 is not used, it
+// flushes denormals and does not keep signaling NaN.
+__attribute__((target("avx2"))) inline void
+convert_float_to_bhalf_avx2(const float* p_src,
+                            bhalf_t* p_dst,
+                            std::size_t n,
+                            std::size_t first_index,
+                            ConvertRounding rounding)
+{
+    const __m256i exp_mask  = _mm256_set1_epi32(0x7f800000);
+    const __m256i low_mask  = _mm256_set1_epi32(0xffff);
+    const __m256i one       = _mm256_set1_epi32(1);
+    const __m256i zero      = _mm256_setzero_si256();
+    const __m256i lane_ids  = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i rng_const = _mm256_set1_epi32(0x13371337 ^ stochastic_rounding_seed);
+
+    std::size_t i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+
+        if(rounding != ConvertRounding::Default)
+        {
+            const __m256i non_finite =
+                _mm256_cmpeq_epi32(_mm256_and_si256(bits, exp_mask), exp_mask);
+
+            __m256i inc;
+            if(rounding == ConvertRounding::NearestEven)
+            {
+                inc = _mm256_add_epi32(_mm256_set1_epi32(0x7fff),
+                                       _mm256_and_si256(_mm256_srli_epi32(bits, 16), one));
+            }
+            else
+            {
+                // prand_generator<float> for all 8 lanes
+                __m256i drop = _mm256_xor_si256(_mm256_and_si256(bits, low_mask),
+                                                _mm256_srli_epi32(bits, 16));
+                drop         = _mm256_or_si256(
+                    _mm256_slli_epi32(_mm256_and_si256(drop, _mm256_set1_epi32(31)), 11),
+                    _mm256_srli_epi32(drop, 5));
+                drop = _mm256_mullo_epi32(drop, _mm256_set1_epi32(0x7000149));
+
+                const __m256i ids = _mm256_add_epi32(
+                    _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(first_index + i))),
+                    lane_ids);
+                const __m256i rng = _mm256_xor_si256(
+                    _mm256_xor_si256(drop, rng_const),
+                    _mm256_mullo_epi32(ids, _mm256_set1_epi32(229791)));
+
+                inc = _mm256_and_si256(rng, low_mask);
+            }
+
+            // NaN with a payload only in the dropped bits stays NaN
+            const __m256i has_low = _mm256_andnot_si256(
+                _mm256_cmpeq_epi32(_mm256_and_si256(bits, low_mask), zero), _mm256_set1_epi32(-1));
+            const __m256i nan_bit = _mm256_and_si256(has_low, _mm256_set1_epi32(0x10000));
+
+            bits = _mm256_blendv_epi8(
+                _mm256_add_epi32(bits, inc), _mm256_or_si256(bits, nan_bit), non_finite);
+        }
+
+        const __m256i packed = _mm256_packus_epi32(_mm256_srli_epi32(bits, 16), zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i),
+                         _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08)));
+    }
+    for(; i < n; ++i)
+        p_dst[i] = scalar_type_convert<bhalf_t>(p_src[i], rounding, first_index + i);
+}
+
+__attribute__((target("avx512f"))) inline void
+convert_float_to_bhalf_avx512(const float* p_src,
+                              bhalf_t* p_dst,
+                              std::size_t n,
+                              std::size_t first_index,
+                              ConvertRounding rounding)
+{
+    const __m512i exp_mask  = _mm512_set1_epi32(0x7f800000);
+    const __m512i low_mask  = _mm512_set1_epi32(0xffff);
+    const __m512i one       = _mm512_set1_epi32(1);
+    const __m512i rng_const = _mm512_set1_epi32(0x13371337 ^ stochastic_rounding_seed);
+    const __m512i lane_ids =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    std::size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        __m512i bits = _mm512_loadu_si512(p_src + i);
+
+        if(rounding != ConvertRounding::Default)
+        {
+            const __mmask16 non_finite =
+                _mm512_cmpeq_epi32_mask(_mm512_and_si512(bits, exp_mask), exp_mask);
+
+            __m512i inc;
+            if(rounding == ConvertRounding::NearestEven)
+            {
+                inc = _mm512_add_epi32(_mm512_set1_epi32(0x7fff),
+                                       _mm512_and_si512(_mm512_srli_epi32(bits, 16), one));
+            }
+            else
+            {
+                // prand_generator<float> for all 16 lanes
+                __m512i drop = _mm512_xor_si512(_mm512_and_si512(bits, low_mask),
+                                                _mm512_srli_epi32(bits, 16));
+                drop         = _mm512_or_si512(
+                    _mm512_slli_epi32(_mm512_and_si512(drop, _mm512_set1_epi32(31)), 11),
+                    _mm512_srli_epi32(drop, 5));
+                drop = _mm512_mullo_epi32(drop, _mm512_set1_epi32(0x7000149));
+
+                const __m512i ids = _mm512_add_epi32(
+                    _mm512_set1_epi32(static_cast<int>(static_cast<uint32_t>(first_index + i))),
+                    lane_ids);
+                const __m512i rng = _mm512_xor_si512(
+                    _mm512_xor_si512(drop, rng_const),
+                    _mm512_mullo_epi32(ids, _mm512_set1_epi32(229791)));
+
+                inc = _mm512_and_si512(rng, low_mask);
+            }
+
+            // NaN with a payload only in the dropped bits stays NaN
+            const __mmask16 has_low = _mm512_test_epi32_mask(bits, low_mask);
+            const __m512i nan_bits  = _mm512_mask_or_epi32(
+                bits, has_low, bits, _mm512_set1_epi32(0x10000));
+
+            bits = _mm512_mask_blend_epi32(non_finite, _mm512_add_epi32(bits, inc), nan_bits);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i),
+                            _mm512_cvtepi32_epi16(_mm512_srli_epi32(bits, 16)));
+    }
+    for(; i < n; ++i)
+        p_dst[i] = scalar_type_convert<bhalf_t>(p_src[i], rounding, first_index + i);
+}
+#endif
+
+// converts n elements, the first of which has index first_index in the whole span
+template <typename Dst, typename Src>
+void bulk_type_convert_kernel(
+    const Src* p_src, Dst* p_dst, std::size_t n, std::size_t first_index, ConvertRounding rounding)
+{
+    if constexpr(is_host_f8_v<Src> && (is_same_v<Dst, float> || is_same_v<Dst, half_t>))
+    {
+        const auto& table = f8_decode_table<Dst, Src>();
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            uint8_t bits;
+            std::memcpy(&bits, p_src + i, sizeof(bits));
+            p_dst[i] = table[bits];
+        }
+        return;
+    }
+#if CK_HOST_TYPE_CONVERT_X86
+    else if constexpr(is_same_v<Src, half_t> && is_same_v<Dst, float>)
+    {
+        const auto& isa = HostConvertIsa::Get();
+        if(isa.avx512f_)
+            return convert_half_to_float_avx512(p_src, p_dst, n);
+        else if(isa.avx2_f16c_)
+            return convert_half_to_float_avx2(p_src, p_dst, n);
+    }
+    else if constexpr(is_same_v<Src, float> && is_same_v<Dst, half_t>)
+    {
+        const auto& isa = HostConvertIsa::Get();
+        if(isa.avx512f_)
+            return convert_float_to_half_avx512(p_src, p_dst, n);
+        else if(isa.avx2_f16c_)
+            return convert_float_to_half_avx2(p_src, p_dst, n);
+    }
+    else if constexpr(is_same_v<Src, float> && is_same_v<Dst, bhalf_t>)
+    {
+        const auto& isa = HostConvertIsa::Get();
+        if(isa.avx512f_)
+            return convert_float_to_bhalf_avx512(p_src, p_dst, n, first_index, rounding);
+        else if(isa.avx2_f16c_)
+            return convert_float_to_bhalf_avx2(p_src, p_dst, n, first_index, rounding);
+    }
+#endif
+
+    for(std::size_t i = 0; i < n; ++i)
+        p_dst[i] = scalar_type_convert<Dst>(p_src[i], rounding, first_index + i);
+}
+
+// below this many elements per thread, splitting costs more than it saves
+inline constexpr std::size_t bulk_type_convert_min_elements_per_thread = 1 << 16;
+
+} // namespace detail
+
+// Converts src into dst element by element, like type_convert<Dst> with the given rounding.
+//
+// f8/bf8 to float/half decodes through a table of the 256 codes, float/half conversions use
+// F16C or AVX-512 and float to bhalf_t rounds in AVX2 or AVX-512 registers when the CPU has them.
+// Other pairs, including the encoding to f8/bf8, use the scalar conversion. Every path matches
+// detail::scalar_type_convert bit for bit. Large spans are split across the HostThreadPool.
+template <typename Dst, typename Src>
+void bulk_type_convert(ck::span<const Src> src,
+                       ck::span<Dst> dst,
+                       ConvertRounding rounding = ConvertRounding::Default)
+{
+    if(src.size() != dst.size())
+        throw std::runtime_error("bulk_type_convert: src and dst have different sizes");
+
+    const std::size_t max_threads =
+        std::max<std::size_t>(1, src.size() / detail::bulk_type_convert_min_elements_per_thread);
+
+    HostThreadPool::GetInstance().ParallelFor(
+        src.size(), max_threads, [&](std::size_t begin, std::size_t end) {
+            detail::bulk_type_convert_kernel(
+                src.data() + begin, dst.data() + begin, end - begin, begin, rounding);
+        });
+}
+
+} // namespace utils
+} // namespace ck
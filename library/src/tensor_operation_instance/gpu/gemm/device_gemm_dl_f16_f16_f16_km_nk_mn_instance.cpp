@@ -71,9 +71,8 @@ using device_gemm_dl_f16_f16_f16_km_nk_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_f16_f16_f16_km_nk_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
-        instances)
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>& instances)
 {
     add_device_operation_instances(instances, device_gemm_dl_f16_f16_f16_km_nk_mn_instances{});
 }
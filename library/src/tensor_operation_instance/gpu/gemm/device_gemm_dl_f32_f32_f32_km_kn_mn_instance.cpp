@@ -39,9 +39,8 @@ using device_gemm_dl_f32_f32_f32_km_kn_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_f32_f32_f32_km_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
-        instances)
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>& instances)
 {
     add_device_operation_instances(instances, device_gemm_dl_f32_f32_f32_km_kn_mn_instances{});
 }
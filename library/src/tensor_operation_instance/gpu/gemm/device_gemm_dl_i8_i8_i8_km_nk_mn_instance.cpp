@@ -69,8 +69,8 @@ using device_gemm_dl_i8_i8_i8_km_nk_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_i8_i8_i8_km_nk_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Col, Col, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Col, Col, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
     add_device_operation_instances(instances, device_gemm_dl_i8_i8_i8_km_nk_mn_instances{});
@@ -69,8 +69,8 @@ using device_gemm_dl_i8_i8_i8_mk_kn_mn_instances = std::tuple<
     >;
 
 void add_device_gemm_dl_i8_i8_i8_mk_kn_mn_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>>&
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Row, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>&
         instances)
 {
     add_device_operation_instances(instances, device_gemm_dl_i8_i8_i8_mk_kn_mn_instances{});
@@ -49,9 +49,8 @@ using device_gemm_dpp_f16_f16_f16_mk_kn_mn_irregular_instances = std::tuple<
 // clang-format on
 
 void add_device_gemm_dpp_f16_f16_f16_mk_kn_mn_irregular_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
-        instances)
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>& instances)
 {
     add_device_operation_instances(instances,
                                    device_gemm_dpp_f16_f16_f16_mk_kn_mn_irregular_instances{});
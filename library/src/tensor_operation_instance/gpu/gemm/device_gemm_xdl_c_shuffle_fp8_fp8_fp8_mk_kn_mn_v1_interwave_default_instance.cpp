@@ -12,8 +12,8 @@ namespace instance {
 static constexpr auto GemmDefault = ck::tensor_operation::device::GemmSpecialization::Default;
 
 void add_device_gemm_xdl_c_shuffle_f8_f8_f8_mk_kn_mn_v1_interwave_default_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemm<Row, Row, Row, F8, F8, F8, PassThrough, PassThrough, PassThrough>>>& instances)
+    DeviceOperationInstanceCatalog<
+        DeviceGemm<Row, Row, Row, F8, F8, F8, PassThrough, PassThrough, PassThrough>>& instances)
 {
     add_device_operation_instances(
         instances,
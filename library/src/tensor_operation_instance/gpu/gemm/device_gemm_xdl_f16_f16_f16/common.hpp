@@ -35,7 +35,7 @@ using InstanceTT = DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThr
 using InstanceTN = DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
 
 template <typename Instance>
-using OwnerList = std::vector<std::unique_ptr<Instance>>;
+using InstanceCatalog = DeviceOperationInstanceCatalog<Instance>;
 
 } // namespace instance
 } // namespace device
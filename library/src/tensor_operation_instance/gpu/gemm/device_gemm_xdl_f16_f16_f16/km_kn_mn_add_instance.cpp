@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 using Instance  = InstanceNT;
-using Instances = OwnerList<InstanceNT>;
+using Instances = InstanceCatalog<InstanceNT>;
 
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_default_pipeline_v1_instances(Instances&);
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_interwave_pipeline_v1_instances(Instances&);
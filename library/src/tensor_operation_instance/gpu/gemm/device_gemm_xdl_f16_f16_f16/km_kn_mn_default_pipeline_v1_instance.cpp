@@ -29,7 +29,7 @@ using Instances =
         >;
 
 void add_device_gemm_xdl_f16_f16_f16_km_kn_mn_default_pipeline_v1_instances(
-    OwnerList<InstanceNT>& instances)
+    InstanceCatalog<InstanceNT>& instances)
 {
     add_device_operation_instances(instances, Instances{});
 }
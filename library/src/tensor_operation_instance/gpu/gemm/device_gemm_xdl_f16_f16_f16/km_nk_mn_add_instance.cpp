@@ -9,7 +9,7 @@ namespace device {
 namespace instance {
 
 using Instance  = InstanceNN;
-using Instances = OwnerList<Instance>;
+using Instances = InstanceCatalog<Instance>;
 
 void add_device_gemm_xdl_f16_f16_f16_km_nk_mn_default_pipeline_v1_instances(Instances&);
 void add_device_gemm_xdl_f16_f16_f16_km_nk_mn_interwave_pipeline_v1_instances(Instances&);
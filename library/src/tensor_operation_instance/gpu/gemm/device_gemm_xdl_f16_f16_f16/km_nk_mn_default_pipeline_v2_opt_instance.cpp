@@ -24,7 +24,7 @@ using Instances =
         >;
 
 void add_device_gemm_xdl_f16_f16_f16_km_nk_mn_default_pipeline_v2_opt_instances(
-    OwnerList<InstanceNN>& instances)
+    InstanceCatalog<InstanceNN>& instances)
 {
     add_device_operation_instances(instances, Instances{});
 }
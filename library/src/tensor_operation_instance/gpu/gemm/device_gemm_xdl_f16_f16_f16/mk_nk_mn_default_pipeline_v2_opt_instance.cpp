@@ -23,7 +23,7 @@ using Instances = std::tuple<
     >;
 
 void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_default_pipeline_v2_opt_instances(
-    OwnerList<InstanceTN>& instances)
+    InstanceCatalog<InstanceTN>& instances)
 {
     add_device_operation_instances(instances, Instances{});
 }
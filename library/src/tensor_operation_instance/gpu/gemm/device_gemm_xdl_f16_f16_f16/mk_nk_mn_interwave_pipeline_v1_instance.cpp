@@ -35,7 +35,7 @@ using Instances = std::tuple<
     >;
 
 void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_interwave_pipeline_v1_instances(
-    OwnerList<InstanceTN>& instances)
+    InstanceCatalog<InstanceTN>& instances)
 {
     add_device_operation_instances(instances, Instances{});
 }
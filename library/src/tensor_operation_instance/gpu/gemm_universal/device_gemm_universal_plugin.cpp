@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/library/tensor_operation_instance/gpu/gemm_universal.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+namespace {
+
+template <typename ALayout,
+          typename BLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType>
+void add_gemm_universal(DeviceOperationPluginRegistry& registry)
+{
+    using DeviceOp = DeviceGemmV2<ALayout,
+                                  BLayout,
+                                  Row,
+                                  ADataType,
+                                  BDataType,
+                                  CDataType,
+                                  PassThrough,
+                                  PassThrough,
+                                  PassThrough>;
+
+    // not through DeviceOperationInstanceFactory, which forwards to this plugin in the process
+    registry.Add<DeviceOp>("gemm_universal", [](std::vector<std::unique_ptr<DeviceOp>>& op_ptrs) {
+        add_device_gemm_xdl_universal_instances<ALayout,
+                                                BLayout,
+                                                Row,
+                                                ADataType,
+                                                BDataType,
+                                                CDataType>(op_ptrs);
+    });
+}
+
+} // namespace
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// the problems DeviceOperationInstanceFactory<DeviceGemmV2<...>> has instances for
+extern "C" void ck_device_operation_plugin_register(
+    ck::tensor_operation::device::instance::DeviceOperationPluginRegistry& registry)
+{
+    using namespace ck::tensor_operation::device::instance;
+
+#ifdef CK_ENABLE_FP16
+    add_gemm_universal<Row, Row, F16, F16, F16>(registry);
+    add_gemm_universal<Row, Col, F16, F16, F16>(registry);
+    add_gemm_universal<Row, Row, BF16, BF16, BF16>(registry);
+    add_gemm_universal<Row, Col, BF16, BF16, BF16>(registry);
+#endif
+#if(defined(CK_ENABLE_FP16) || defined(CK_ENABLE_FP8))
+    add_gemm_universal<Row, Col, F16, F8, F16>(registry);
+    add_gemm_universal<Row, Row, F16, F8, F16>(registry);
+    add_gemm_universal<Row, Col, F8, F16, F16>(registry);
+    add_gemm_universal<Row, Row, F8, F16, F16>(registry);
+#endif
+}
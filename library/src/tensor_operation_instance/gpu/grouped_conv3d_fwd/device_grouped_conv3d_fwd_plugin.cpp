@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+namespace {
+
+template <typename InLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename AComputeType = InDataType,
+          typename BComputeType = AComputeType>
+void add_grouped_conv3d_fwd(DeviceOperationPluginRegistry& registry)
+{
+    using DeviceOp = DeviceGroupedConvFwdMultipleABD<3,
+                                                     InLayout,
+                                                     GKZYXC,
+                                                     Empty_Tuple,
+                                                     OutLayout,
+                                                     InDataType,
+                                                     WeiDataType,
+                                                     Empty_Tuple,
+                                                     OutDataType,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     AComputeType,
+                                                     BComputeType>;
+
+    // not through GetInstances, which forwards to this plugin in the process
+    registry.Add<DeviceOp>("grouped_conv3d_fwd",
+                           [](std::vector<std::unique_ptr<DeviceOp>>& op_ptrs) {
+                               DeviceOperationInstanceFactory<DeviceOp>::AddLibraryInstances(
+                                   op_ptrs);
+                           });
+}
+
+} // namespace
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// the 3d problems DeviceOperationInstanceFactory<DeviceGroupedConvFwdMultipleABD<...>> has
+// instances for
+extern "C" void ck_device_operation_plugin_register(
+    ck::tensor_operation::device::instance::DeviceOperationPluginRegistry& registry)
+{
+    using namespace ck::tensor_operation::device::instance;
+
+#ifdef CK_ENABLE_FP32
+    add_grouped_conv3d_fwd<GNDHWC, GNDHWK, F32, F32, F32>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, F32, F32, F32>(registry);
+#endif
+#ifdef CK_ENABLE_FP16
+    add_grouped_conv3d_fwd<GNDHWC, GNDHWK, F16, F16, F16>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, F16, F16, F16>(registry);
+#endif
+#ifdef CK_ENABLE_BF16
+    add_grouped_conv3d_fwd<GNDHWC, GNDHWK, BF16, BF16, BF16>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, BF16, BF16, BF16>(registry);
+#endif
+#ifdef CK_ENABLE_INT8
+    add_grouped_conv3d_fwd<GNDHWC, GNDHWK, I8, I8, I8>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, I8, I8, I8>(registry);
+#endif
+#ifdef CK_ENABLE_FP8
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, F16, F16, F16, F8>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, F8, F8, F8>(registry);
+#endif
+#ifdef CK_ENABLE_BF8
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, BF8, BF8, F8>(registry);
+#endif
+#if(defined(CK_ENABLE_FP8) && defined(CK_ENABLE_BF8))
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, F8, BF8, F8, F8, BF8>(registry);
+    add_grouped_conv3d_fwd<NDHWGC, NDHWGK, BF8, F8, F8, BF8, F8>(registry);
+#endif
+}
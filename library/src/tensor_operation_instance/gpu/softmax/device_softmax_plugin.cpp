@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/library/tensor_operation_instance/gpu/softmax.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+namespace {
+
+template <typename InDataType, typename OutDataType, index_t Rank, index_t NumReduceDim>
+void add_softmax(DeviceOperationPluginRegistry& registry)
+{
+    using DeviceOp =
+        DeviceSoftmax<InDataType, F32, OutDataType, PassThrough, PassThrough, Rank, NumReduceDim>;
+
+    // not through DeviceOperationInstanceFactory, which forwards to this plugin in the process
+    registry.Add<DeviceOp>("softmax", [](std::vector<std::unique_ptr<DeviceOp>>& op_ptrs) {
+        add_device_softmax_instances<InDataType, F32, OutDataType, Rank, NumReduceDim>(op_ptrs);
+    });
+}
+
+template <typename InDataType, typename OutDataType>
+void add_softmax_ranks(DeviceOperationPluginRegistry& registry)
+{
+    add_softmax<InDataType, OutDataType, 3, 1>(registry);
+    add_softmax<InDataType, OutDataType, 3, 2>(registry);
+    add_softmax<InDataType, OutDataType, 3, 3>(registry);
+    add_softmax<InDataType, OutDataType, 4, 1>(registry);
+    add_softmax<InDataType, OutDataType, 4, 2>(registry);
+    add_softmax<InDataType, OutDataType, 4, 3>(registry);
+    add_softmax<InDataType, OutDataType, 4, 4>(registry);
+}
+
+} // namespace
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// the problems DeviceOperationInstanceFactory<DeviceSoftmax<...>> has instances for
+extern "C" void ck_device_operation_plugin_register(
+    ck::tensor_operation::device::instance::DeviceOperationPluginRegistry& registry)
+{
+    using namespace ck::tensor_operation::device::instance;
+
+#ifdef CK_ENABLE_FP16
+    add_softmax_ranks<F16, F16>(registry);
+#endif
+#ifdef CK_ENABLE_FP32
+    add_softmax_ranks<F32, F32>(registry);
+#endif
+}
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -16,11 +16,14 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_reference_cache.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -115,7 +118,16 @@ bool profile_batched_gemm_impl(int do_verification,
         auto ref_argument = ref_batched_gemm.MakeArgument(
             a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        const auto ref_key = ck::utils::HostReferenceCacheKey("ReferenceBatchedGemm")
+                                 .AddComputeTypes<float>()
+                                 .AddTensor(a_g_m_k)
+                                 .AddTensor(b_g_k_n)
+                                 .AddElementOp(a_element_op)
+                                 .AddElementOp(b_element_op)
+                                 .AddElementOp(c_element_op);
+
+        ck::utils::RunCachedReference(
+            ref_key, c_g_m_n_host_result, [&] { ref_invoker.Run(ref_argument); });
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
@@ -132,27 +144,22 @@ bool profile_batched_gemm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
-    std::string best_op_name;
-    float best_ave_time   = 0;
-    float best_tflops     = 0;
-    float best_gb_per_sec = 0;
-
-    // profile device op instances
-    for(auto& op_ptr : op_ptrs)
-    {
+    constexpr bool is_batched_gemm =
+        std::is_same<DeviceOp,
+                     ck::tensor_operation::device::DeviceBatchedGemm<ALayout,
+                                                                     BLayout,
+                                                                     CLayout,
+                                                                     ADataType,
+                                                                     BDataType,
+                                                                     CDataType,
+                                                                     AElementOp,
+                                                                     BElementOp,
+                                                                     CElementOp>>::value;
+
+    auto make_argument = [&](auto& op_ptr) {
         std::unique_ptr<tensor_operation::device::BaseArgument> argument_ptr;
         // false branch for multi d dl kernel
-        if constexpr(std::is_same<
-                         DeviceOp,
-                         ck::tensor_operation::device::DeviceBatchedGemm<ALayout,
-                                                                         BLayout,
-                                                                         CLayout,
-                                                                         ADataType,
-                                                                         BDataType,
-                                                                         CDataType,
-                                                                         AElementOp,
-                                                                         BElementOp,
-                                                                         CElementOp>>::value)
+        if constexpr(is_batched_gemm)
         {
 
             argument_ptr =
@@ -196,6 +203,46 @@ bool profile_batched_gemm_impl(int do_verification,
                                             ck::tensor_operation::element_wise::PassThrough{},
                                             ck::tensor_operation::element_wise::PassThrough{});
         }
+        return argument_ptr;
+    };
+
+    using tensor_operation::device::instance::GetTuningDataTypeString;
+
+    ProfilerTuningDb tuning_db(
+        {is_batched_gemm ? "batched_gemm" : "batched_gemm_multi_d",
+         GetTuningDataTypeString<ADataType>() + "_" + GetTuningDataTypeString<BDataType>() + "_" +
+             GetTuningDataTypeString<CDataType>(),
+         std::string(ALayout::name) + "_" + BLayout::name + "_" + CLayout::name,
+         {M, N, K, StrideA, StrideB, StrideC, BatchStrideA, BatchStrideB, BatchStrideC, BatchCount},
+         ""});
+
+    // a problem found in the tuning db only profiles its cached best instance, as long as that
+    // one still supports the problem
+    auto tuned_instance_id = tuning_db.FindTunedInstance(op_ptrs);
+
+    if(tuned_instance_id &&
+       !op_ptrs[*tuned_instance_id]->IsSupportedArgument(
+           make_argument(op_ptrs[*tuned_instance_id]).get()))
+    {
+        std::cout << "tuning db: cached instance does not support this problem, profiling all "
+                     "instances"
+                  << std::endl;
+        tuned_instance_id.reset();
+    }
+
+    std::string best_op_name;
+    float best_ave_time   = 0;
+    float best_tflops     = 0;
+    float best_gb_per_sec = 0;
+
+    // profile device op instances
+    for(std::size_t instance_id = 0; instance_id < op_ptrs.size(); ++instance_id)
+    {
+        if(tuned_instance_id && instance_id != *tuned_instance_id)
+            continue;
+
+        auto& op_ptr      = op_ptrs[instance_id];
+        auto argument_ptr = make_argument(op_ptr);
 
         auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
@@ -257,6 +304,9 @@ bool profile_batched_gemm_impl(int do_verification,
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
+    if(time_kernel && best_tflops > 0)
+        tuning_db.RecordBestInstance(best_op_name, best_ave_time, best_tflops, !tuned_instance_id);
+
     return pass;
 }
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #pragma once
 
@@ -17,12 +17,16 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_reference_cache.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
 
+#include "profiler/profiler_batch.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -62,10 +66,16 @@ int profile_gemm_impl(int do_verification,
             }
         };
 
-    Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
-    Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
-    Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    // host tensors, like the device buffers and instances below, are kept across the problems of
+    // a batch run
+    Tensor<ADataType>& a_m_k =
+        GetCachedHostTensor<ADataType>(0, f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
+    Tensor<BDataType>& b_k_n =
+        GetCachedHostTensor<BDataType>(1, f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
+    Tensor<CDataType>& c_m_n_host_result =
+        GetCachedHostTensor<CDataType>(2, f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    Tensor<CDataType>& c_m_n_device_result =
+        GetCachedHostTensor<CDataType>(3, f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
@@ -94,9 +104,13 @@ int profile_gemm_impl(int do_verification,
     const auto b_element_op = BElementOp{};
     const auto c_element_op = CElementOp{};
 
-    DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
-    DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
+    // device buffers and instances are kept across the problems of a batch run
+    DeviceMem& a_device_buf =
+        GetCachedDeviceBuffer(0, sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem& b_device_buf =
+        GetCachedDeviceBuffer(1, sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem& c_device_buf = GetCachedDeviceBuffer(
+        2, sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_m_k.mData.data());
     b_device_buf.ToDevice(b_k_n.mData.data());
@@ -112,8 +126,7 @@ int profile_gemm_impl(int do_verification,
                                                               CElementOp>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = GetCachedInstances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
@@ -134,16 +147,76 @@ int profile_gemm_impl(int do_verification,
         auto ref_argument = ref_op.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        // repeated runs of the same problem and inputs reuse the result when
+        // CK_REFERENCE_CACHE_DIR is set
+        const auto ref_key = ck::utils::HostReferenceCacheKey("ReferenceGemm")
+                                 .AddComputeTypes<AccDataType, CDataType>()
+                                 .AddTensor(a_m_k)
+                                 .AddTensor(b_k_n)
+                                 .AddElementOp(a_element_op)
+                                 .AddElementOp(b_element_op)
+                                 .AddElementOp(c_element_op);
+
+        ck::utils::RunCachedReference(
+            ref_key, c_m_n_host_result, [&] { ref_invoker.Run(ref_argument); });
     }
 
+    using tensor_operation::device::instance::GetTuningDataTypeString;
+
+    ProfilerTuningDb tuning_db({"gemm",
+                                GetTuningDataTypeString<ADataType>() + "_" +
+                                    GetTuningDataTypeString<BDataType>() + "_" +
+                                    GetTuningDataTypeString<AccDataType>() + "_" +
+                                    GetTuningDataTypeString<CDataType>(),
+                                std::string(ALayout::name) + "_" + BLayout::name + "_" +
+                                    CLayout::name,
+                                {M, N, K, StrideA, StrideB, StrideC},
+                                ""});
+
+    // a problem found in the tuning db only profiles its cached best instance, as long as that
+    // one still supports the problem
+    auto tuned_instance_id = tuning_db.FindTunedInstance(op_ptrs);
+
+    if(tuned_instance_id)
+    {
+        auto& op_ptr = op_ptrs[*tuned_instance_id];
+        auto argument_ptr =
+            op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
+                                        static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
+                                        static_cast<CDataType*>(c_device_buf.GetDeviceBuffer()),
+                                        M,
+                                        N,
+                                        K,
+                                        StrideA,
+                                        StrideB,
+                                        StrideC,
+                                        a_element_op,
+                                        b_element_op,
+                                        c_element_op);
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            std::cout << "tuning db: cached instance does not support this problem, profiling all "
+                         "instances"
+                      << std::endl;
+            tuned_instance_id.reset();
+        }
+    }
+
+    float best_ave_time  = 0;
     float best_tflops    = 0;
-    int best_instance_id = 0;
+    int best_instance_id = tuned_instance_id ? static_cast<int>(*tuned_instance_id) : 0;
 
     int instance_id = 0;
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
     {
+        if(tuned_instance_id && instance_id != best_instance_id)
+        {
+            instance_id++;
+            continue;
+        }
+
         auto argument_ptr =
             op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
                                         static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
@@ -185,14 +258,21 @@ int profile_gemm_impl(int do_verification,
             if(tflops > best_tflops)
             {
                 best_instance_id = instance_id;
+                best_ave_time    = avg_time;
                 best_tflops      = tflops;
             }
 
+            auto& recorder = ProfilerResultRecorder::GetInstance();
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                pass = pass & instance_pass;
+
+                recorder.Add(op_name, avg_time, tflops, gb_per_sec, instance_pass);
 
                 if(do_log)
                 {
@@ -204,6 +284,10 @@ int profile_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+            else
+            {
+                recorder.Add(op_name, avg_time, tflops, gb_per_sec);
+            }
         }
         else
         {
@@ -213,6 +297,14 @@ int profile_gemm_impl(int do_verification,
         instance_id++;
     }
 
+    if(time_kernel && best_tflops > 0)
+    {
+        tuning_db.RecordBestInstance(op_ptrs[best_instance_id]->GetTypeString(),
+                                     best_ave_time,
+                                     best_tflops,
+                                     !tuned_instance_id);
+    }
+
     sleep(2);
 
     // Run the best instance again
@@ -16,6 +16,7 @@
 #include "ck/library/utility/algorithm.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_reference_cache.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
@@ -132,10 +133,25 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                                                   wei_element_op,
                                                   out_element_op);
 
-        // init host output to zero
-        host_output.SetZero();
-
-        ref_invoker.Run(ref_argument);
+        const auto ref_key =
+            ck::utils::HostReferenceCacheKey("ReferenceConvFwd")
+                .AddComputeTypes<float>()
+                .AddValues("strides", conv_param.conv_filter_strides_)
+                .AddValues("dilations", conv_param.conv_filter_dilations_)
+                .AddValues("left_pads", conv_param.input_left_pads_)
+                .AddValues("right_pads", conv_param.input_right_pads_)
+                .AddTensor(input)
+                .AddTensor(weight)
+                .AddElementOp(in_element_op)
+                .AddElementOp(wei_element_op)
+                .AddElementOp(out_element_op);
+
+        ck::utils::RunCachedReference(ref_key, host_output, [&] {
+            // init host output to zero
+            host_output.SetZero();
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     std::string best_op_name;
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Helpers that let "ckProfiler batch" run many problems in one process. Profilers that use them
+// report per-instance results and share instance lists, host tensors and device buffers between
+// problems.
+
+struct ProfilerInstanceResult
+{
+    enum struct Verification
+    {
+        Skipped,
+        Pass,
+        Fail,
+    };
+
+    std::string instance_;
+    float ave_time_            = 0;
+    float tflops_              = 0;
+    float gb_per_sec_          = 0;
+    Verification verification_ = Verification::Skipped;
+};
+
+// Collects the results of the instances profiled for the current problem of a batch run. Outside
+// of batch mode it is disabled and drops everything.
+class ProfilerResultRecorder
+{
+    public:
+    static ProfilerResultRecorder& GetInstance()
+    {
+        static ProfilerResultRecorder recorder;
+        return recorder;
+    }
+
+    void Enable() { enabled_ = true; }
+
+    bool IsEnabled() const { return enabled_; }
+
+    void Clear() { results_.clear(); }
+
+    void Add(ProfilerInstanceResult result)
+    {
+        if(enabled_)
+            results_.push_back(std::move(result));
+    }
+
+    void Add(const std::string& instance, float ave_time, float tflops, float gb_per_sec)
+    {
+        using Verification = ProfilerInstanceResult::Verification;
+
+        Add({instance, ave_time, tflops, gb_per_sec, Verification::Skipped});
+    }
+
+    void Add(const std::string& instance, float ave_time, float tflops, float gb_per_sec, bool pass)
+    {
+        using Verification = ProfilerInstanceResult::Verification;
+
+        const auto verification = pass ? Verification::Pass : Verification::Fail;
+        Add({instance, ave_time, tflops, gb_per_sec, verification});
+    }
+
+    const std::vector<ProfilerInstanceResult>& GetResults() const { return results_; }
+
+    private:
+    ProfilerResultRecorder() = default;
+
+    bool enabled_ = false;
+    std::vector<ProfilerInstanceResult> results_;
+};
+
+// Instances of DeviceOp, created by the instance factory on first use and kept for the rest of the
+// process.
+template <typename DeviceOp>
+const auto& GetCachedInstances()
+{
+    using tensor_operation::device::instance::DeviceOperationInstanceFactory;
+
+    static const auto op_ptrs = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+    return op_ptrs;
+}
+
+// Device buffer number `slot` resized to `size` bytes. The allocation only grows, so consecutive
+// problems reuse it instead of going through hipMalloc/hipFree again. The returned buffer stays
+// valid until the next call with the same slot.
+inline DeviceMem& GetCachedDeviceBuffer(std::size_t slot, std::size_t size)
+{
+    struct CachedBuffer
+    {
+        DeviceMem mem_;
+        std::size_t capacity_ = 0;
+    };
+
+    // never destroyed: freeing device memory during static destruction may outlive the HIP runtime
+    static auto* buffers = new std::vector<std::unique_ptr<CachedBuffer>>();
+
+    while(buffers->size() <= slot)
+        buffers->push_back(std::make_unique<CachedBuffer>());
+
+    auto& buffer = *(*buffers)[slot];
+    if(buffer.capacity_ < size)
+    {
+        buffer.mem_.Realloc(size);
+        buffer.capacity_ = size;
+    }
+
+    // DeviceMem copies and clears mMemSize bytes, so it must match the caller's size
+    buffer.mem_.mMemSize = size;
+
+    return buffer.mem_;
+}
+
+// Host tensor number `slot` of element type T, described by desc and zeroed like a newly
+// constructed tensor. Its storage only grows, so consecutive problems reuse the allocation. The
+// returned tensor stays valid until the next call with the same T and slot.
+template <typename T>
+Tensor<T>& GetCachedHostTensor(std::size_t slot, const HostTensorDescriptor& desc)
+{
+    static std::vector<std::unique_ptr<Tensor<T>>> tensors;
+
+    while(tensors.size() <= slot)
+        tensors.push_back(nullptr);
+
+    auto& tensor = tensors[slot];
+    if(!tensor)
+    {
+        tensor = std::make_unique<Tensor<T>>(desc);
+        return *tensor;
+    }
+
+    tensor->mDesc = desc;
+    tensor->mData.assign(desc.GetElementSpaceSize(), T{});
+
+    return *tensor;
+}
+
+} // namespace profiler
+} // namespace ck
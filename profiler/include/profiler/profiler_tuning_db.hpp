@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_tuning_db.hpp"
+
+namespace ck {
+namespace profiler {
+
+enum struct TuningDbMode
+{
+    Off,
+    Read,      // profile only the cached best instance when the problem was tuned before
+    Write,     // profile all instances and record the best one
+    ReadWrite, // read, and record the best instance of problems that were not tuned yet
+};
+
+struct TuningDbOption
+{
+    std::string path_;
+    TuningDbMode mode_ = TuningDbMode::Off;
+
+    bool IsReadEnabled() const
+    {
+        return mode_ == TuningDbMode::Read || mode_ == TuningDbMode::ReadWrite;
+    }
+
+    bool IsWriteEnabled() const
+    {
+        return mode_ == TuningDbMode::Write || mode_ == TuningDbMode::ReadWrite;
+    }
+};
+
+// the operations whose profilers read and write the tuning db
+inline constexpr std::array<std::string_view, 3> TuningDbOperations{
+    "gemm", "batched_gemm", "batched_gemm_multi_d"};
+
+inline bool IsTuningDbSupported(std::string_view operation)
+{
+    return std::find(TuningDbOperations.begin(), TuningDbOperations.end(), operation) !=
+           TuningDbOperations.end();
+}
+
+inline TuningDbOption& GetTuningDbOption()
+{
+    static TuningDbOption option;
+    return option;
+}
+
+// Removes "--tune-db <path>" and "--tune-db-mode <read|write|readwrite>" from argv so the
+// positional arguments of the operations stay unchanged, and returns the new argc. The mode
+// defaults to readwrite when only a path is given.
+inline int ParseTuningDbOption(int argc, char* argv[])
+{
+    auto& option = GetTuningDbOption();
+    std::optional<TuningDbMode> mode;
+
+    int dst = 0;
+    for(int src = 0; src < argc; ++src)
+    {
+        if(std::strcmp(argv[src], "--tune-db") == 0 && src + 1 < argc)
+        {
+            option.path_ = argv[++src];
+        }
+        else if(std::strcmp(argv[src], "--tune-db-mode") == 0 && src + 1 < argc)
+        {
+            const std::string value = argv[++src];
+
+            if(value == "read")
+                mode = TuningDbMode::Read;
+            else if(value == "write")
+                mode = TuningDbMode::Write;
+            else if(value == "readwrite")
+                mode = TuningDbMode::ReadWrite;
+            else
+                std::cerr << "unknown --tune-db-mode " << value << ", ignored" << std::endl;
+        }
+        else
+        {
+            argv[dst++] = argv[src];
+        }
+    }
+
+    if(!option.path_.empty())
+        option.mode_ = mode.value_or(TuningDbMode::ReadWrite);
+
+    return dst;
+}
+
+// Tuning db session of one profiled problem. Profilers ask it which instance to start from and
+// report the best instance of their sweep back to it.
+class ProfilerTuningDb
+{
+    public:
+    using Db  = tensor_operation::device::instance::DeviceOperationTuningDb;
+    using Key = tensor_operation::device::instance::DeviceOperationTuningKey;
+
+    explicit ProfilerTuningDb(Key key) : option_(GetTuningDbOption()), key_(std::move(key))
+    {
+        if(option_.mode_ == TuningDbMode::Off)
+            return;
+
+        key_.arch_ = get_device_name();
+        db_        = std::make_unique<Db>(option_.path_);
+    }
+
+    // index of the cached best instance within op_ptrs, if reading is enabled and it is known
+    template <typename OpPtrs>
+    std::optional<std::size_t> FindTunedInstance(const OpPtrs& op_ptrs) const
+    {
+        if(!option_.IsReadEnabled())
+            return std::nullopt;
+
+        const auto record = db_->Find(key_);
+        if(!record)
+            return std::nullopt;
+
+        using tensor_operation::device::instance::FindInstanceByTypeString;
+
+        const auto id = FindInstanceByTypeString(op_ptrs, record->instance_);
+        if(id)
+            std::cout << "tuning db: using " << record->instance_ << std::endl;
+        else
+            std::cout << "tuning db: cached instance " << record->instance_
+                      << " is not available, profiling all instances" << std::endl;
+
+        return id;
+    }
+
+    // records the best instance of a sweep over all instances; a run that only re-timed the cached
+    // instance found nothing new and leaves the db and its file untouched
+    void RecordBestInstance(const std::string& instance,
+                            float ave_time,
+                            float tflops,
+                            bool profiled_all_instances)
+    {
+        if(!option_.IsWriteEnabled() || instance.empty() || !profiled_all_instances)
+            return;
+
+        if(db_->Update(key_, {instance, ave_time, tflops}) && !db_->Save())
+            std::cerr << "tuning db: failed to write " << option_.path_ << std::endl;
+    }
+
+    private:
+    const TuningDbOption& option_;
+    Key key_;
+    std::unique_ptr<Db> db_;
+};
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "profiler/profiler_batch.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "batch"
+#define OP_DESC "Run the problems listed in a file in one process"
+
+namespace {
+
+void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: problem file, one problem per line: the arguments of a ckProfiler run\n"
+              << "      without the program name, separated by spaces or commas, for example\n"
+              << "      gemm,1,1,1,1,0,1,3840,4096,4096,4096,4096,4096\n"
+              << "      empty lines and lines starting with '#' are skipped\n"
+              << "optional:\n"
+              << "arg3: JSON Lines result file (default: <problem file>.jsonl)\n"
+              << std::endl;
+}
+
+std::vector<std::string> split_problem(const std::string& line)
+{
+    std::string normalized = line;
+    for(auto& c : normalized)
+    {
+        if(c == ',' || c == '\t' || c == '\r')
+            c = ' ';
+    }
+
+    std::vector<std::string> tokens;
+    std::istringstream iss(normalized);
+    for(std::string token; iss >> token;)
+        tokens.push_back(token);
+
+    return tokens;
+}
+
+std::string json_string(const std::string& s)
+{
+    std::ostringstream oss;
+
+    oss << '"';
+    for(char c : s)
+    {
+        if(c == '"' || c == '\\')
+            oss << '\\' << c;
+        else if(c == '\n')
+            oss << "\\n";
+        else if(static_cast<unsigned char>(c) < 0x20)
+            oss << ' ';
+        else
+            oss << c;
+    }
+    oss << '"';
+
+    return oss.str();
+}
+
+// timings are inf or nan when kernels were not timed, JSON has no literal for them
+std::string json_number(float x)
+{
+    if(!std::isfinite(x))
+        return "null";
+
+    std::ostringstream oss;
+    oss << x;
+    return oss.str();
+}
+
+std::string json_instance(const ck::profiler::ProfilerInstanceResult& result)
+{
+    using Verification = ck::profiler::ProfilerInstanceResult::Verification;
+
+    std::string verification = "skipped";
+    if(result.verification_ == Verification::Pass)
+        verification = "pass";
+    else if(result.verification_ == Verification::Fail)
+        verification = "fail";
+
+    return "{\"instance\": " + json_string(result.instance_) +
+           ", \"time_ms\": " + json_number(result.ave_time_) +
+           ", \"tflops\": " + json_number(result.tflops_) +
+           ", \"gb_per_sec\": " + json_number(result.gb_per_sec_) +
+           ", \"verification\": \"" + verification + "\"}";
+}
+
+// The problem being run, so that an operation that calls exit() still leaves a result line for it
+// behind. The streams of the batch stay alive during exit(), which does not unwind the stack.
+struct RunningProblem
+{
+    std::ostream* result_file_ = nullptr;
+    std::string result_prefix_;
+};
+
+RunningProblem& running_problem()
+{
+    static RunningProblem problem;
+    return problem;
+}
+
+void record_exit_of_running_problem()
+{
+    const auto& problem = running_problem();
+    if(problem.result_file_ == nullptr)
+        return;
+
+    *problem.result_file_ << problem.result_prefix_ << ", \"status\": \"error: exit() called\""
+                          << ", \"instances\": [], \"best\": null}" << std::endl;
+
+    std::cerr << "batch: an operation called exit(), the remaining problems were not run"
+              << std::endl;
+}
+
+} // namespace
+
+int profile_batch(int argc, char* argv[])
+{
+    if(argc != 3 && argc != 4)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const std::string problem_path = argv[2];
+    const std::string result_path  = argc == 4 ? argv[3] : problem_path + ".jsonl";
+
+    std::ifstream problem_file(problem_path);
+    if(!problem_file)
+    {
+        std::cerr << "cannot open problem file " << problem_path << std::endl;
+        return 1;
+    }
+
+    std::ofstream result_file(result_path, std::ios::trunc);
+    if(!result_file)
+    {
+        std::cerr << "cannot open result file " << result_path << std::endl;
+        return 1;
+    }
+
+    auto& recorder = ck::profiler::ProfilerResultRecorder::GetInstance();
+    recorder.Enable();
+
+    // constructed before the handler is registered, so it is destroyed only after the handler ran
+    running_problem() = {};
+    std::atexit(record_exit_of_running_problem);
+
+    int num_problem = 0;
+    int num_failed  = 0;
+
+    std::string line;
+    for(int line_id = 1; std::getline(problem_file, line); ++line_id)
+    {
+        auto tokens = split_problem(line);
+        if(tokens.empty() || tokens[0][0] == '#')
+            continue;
+
+        ++num_problem;
+
+        // argv of the operation as if it was run on its own
+        tokens.insert(tokens.begin(), argv[0]);
+
+        std::vector<char*> op_argv;
+        for(auto& token : tokens)
+            op_argv.push_back(token.data());
+        op_argv.push_back(nullptr);
+
+        std::cout << "batch: problem " << num_problem << " (line " << line_id << ")" << std::endl;
+
+        std::ostringstream result_prefix;
+        result_prefix << "{\"line\": " << line_id << ", \"op\": " << json_string(tokens[1])
+                      << ", \"args\": [";
+        for(std::size_t i = 2; i < tokens.size(); ++i)
+            result_prefix << (i == 2 ? "" : ", ") << json_string(tokens[i]);
+        result_prefix << "]";
+
+        running_problem() = {&result_file, result_prefix.str()};
+
+        std::string status = "pass";
+        recorder.Clear();
+
+        const auto operation = ProfilerOperationRegistry::GetInstance().Get(tokens[1]);
+        if(!operation.has_value() || tokens[1] == OP_NAME)
+        {
+            status = "unknown operation";
+        }
+        else if(ck::profiler::GetTuningDbOption().mode_ != ck::profiler::TuningDbMode::Off &&
+                !ck::profiler::IsTuningDbSupported(tokens[1]))
+        {
+            status = "error: --tune-db is not supported by operation " + tokens[1];
+        }
+        else
+        {
+            try
+            {
+                if((*operation)(static_cast<int>(tokens.size()), op_argv.data()) != 0)
+                    status = "fail";
+            }
+            catch(const std::exception& e)
+            {
+                status = std::string("error: ") + e.what();
+            }
+        }
+
+        running_problem().result_file_ = nullptr;
+
+        if(status != "pass")
+            ++num_failed;
+
+        // one JSON object per problem, flushed right away so partial runs keep their results
+        const auto& results = recorder.GetResults();
+
+        result_file << result_prefix.str() << ", \"status\": " << json_string(status)
+                    << ", \"instances\": [";
+        for(std::size_t i = 0; i < results.size(); ++i)
+            result_file << (i == 0 ? "" : ", ") << json_instance(results[i]);
+        result_file << "], \"best\": ";
+
+        std::size_t best = results.size();
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            if(std::isfinite(results[i].tflops_) &&
+               (best == results.size() || results[i].tflops_ > results[best].tflops_))
+                best = i;
+        }
+        result_file << (best == results.size() ? "null" : json_instance(results[best])) << "}"
+                    << std::endl;
+    }
+
+    std::cout << "batch: " << num_problem << " problems, " << num_failed << " failed, results in "
+              << result_path << std::endl;
+
+    return num_failed == 0 ? 0 : 1;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_batch);
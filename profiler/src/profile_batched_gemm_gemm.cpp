@@ -117,7 +117,7 @@ int profile_batched_gemm_gemm(int argc, char* argv[])
         printf("arg8 to 12: M, N, K, O, Batch\n");
         printf("arg13 to 16: StrideA0, StrideB0, StrideB1, StrideE1\n");
         printf("arg17 to 20: BatchStrideA0, BatchStrideB0, BatchStrideB1, BatchStrideE1 \n");
-        exit(1);
+        return 1;
     }
 
     if(data_type == GemmDataType::F16_F16_F16_F16 && layout == GemmMatrixLayout::MK_NK_NO_MO)
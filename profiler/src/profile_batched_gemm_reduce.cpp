@@ -41,7 +41,7 @@ int profile_batched_gemm_reduce(int argc, char* argv[])
         printf("arg6: print tensor value (0: no; 1: yes)\n");
         printf("arg7: time kernel (0=n0, 1=yes)\n");
         printf("arg8 to 14: M, N, K, StrideA, StrideB, StrideC, BatchCount\n");
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmReduceDataType>(std::stoi(argv[2]));
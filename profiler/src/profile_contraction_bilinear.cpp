@@ -47,7 +47,7 @@ int profile_contraction_bilinear(int argc, char* argv[])
     if(argc != 34 && argc != 78 && !default_strides)
     {
         print_helper_msg();
-        exit(1);
+        return 1;
     }
 
     const auto data_type          = static_cast<ContractionDataType>(std::stoi(argv[2]));
@@ -46,7 +46,7 @@ int profile_contraction_scale(int argc, char* argv[])
     if(argc != 29 && argc != 65 && !default_strides)
     {
         print_helper_msg();
-        exit(1);
+        return 1;
     }
 
     const auto data_type          = static_cast<ContractionDataType>(std::stoi(argv[2]));
@@ -51,7 +51,7 @@ int profile_conv_fwd_bias_relu_add(int argc, char* argv[])
         printf("arg9: time kernel (0=n0, 1=yes)\n");
         printf("arg10 to 24: N, K, C, Y, X, Hi, Wi, Sy, Sx, Dy, Dx, LeftPy, LeftPx, RightPy, "
                "RightPx\n");
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<ConvDataType>(std::stoi(argv[2]));
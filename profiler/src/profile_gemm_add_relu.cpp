@@ -46,7 +46,7 @@ int profile_gemm_add_relu(int argc, char* argv[])
         printf("arg7: time kernel (0=no, 1=yes)\n");
         printf("arg8 to 14: M, N, K, StrideA, StrideB, StrideD0, StrideE\n");
         // clang-format on
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<MatrixDataType>(std::stoi(argv[2]));
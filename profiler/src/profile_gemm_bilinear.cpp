@@ -46,7 +46,7 @@ int profile_gemm_bilinear(int argc, char* argv[])
         printf("arg8 to 14: M, N, K, StrideA, StrideB, StrideD, StrideE\n");
         printf("arg15 to 16: alhpa, beta\n");
         // clang-format on
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<MatrixDataType>(std::stoi(argv[2]));
@@ -51,7 +51,7 @@ int profile_gemm_splitk(int argc, char* argv[])
         printf("optional:\n");
         printf("arg15: number of warm-up cycles (default 1)\n");
         printf("arg16: number of iterations (default 10)\n");
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
@@ -52,7 +52,7 @@ int profile_gemm_universal(int argc, char* argv[])
         printf("arg15: number of warm-up cycles (default 1)\n");
         printf("arg16: number of iterations (default 10)\n");
         printf("arg17: memory for rotating buffer (default 0, size in MB)\n");
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
@@ -75,7 +75,7 @@ int profile_grouped_gemm(int argc, char* argv[])
             << "arg17: number of iterations (default 10)\n"
             << std::endl;
 
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
@@ -34,7 +34,7 @@ int profile_transpose(int argc, char* argv[])
     if(argc != 12)
     {
         print_helper_msg();
-        exit(1);
+        return 1;
     }
 
     const auto data_type                   = static_cast<DataType>(std::stoi(argv[2]));
@@ -1,18 +1,29 @@
 // SPDX-License-Identifier: MIT
-// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+// Copyright (c) 2018-2024, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cstdlib>
 #include <iostream>
+#include <string_view>
 
+#include "profiler/profiler_tuning_db.hpp"
 #include "profiler_operation_registry.hpp"
 
 static void print_helper_message()
 {
-    std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << std::endl;
+    std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << "\n"
+              << "optional, only for the operations";
+    for(const auto& operation : ck::profiler::TuningDbOperations)
+        std::cout << ' ' << operation << ',';
+    std::cout << " and batch:\n"
+              << "--tune-db <path>: tuning database of the best instance per problem\n"
+              << "--tune-db-mode <read|write|readwrite>: how to use it (default readwrite)"
+              << std::endl;
 }
 
 int main(int argc, char* argv[])
 {
+    argc = ck::profiler::ParseTuningDbOption(argc, argv);
+
     if(argc == 1)
     {
         print_helper_message();
@@ -20,6 +31,14 @@ int main(int argc, char* argv[])
     else if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(argv[1]);
             operation.has_value())
     {
+        // batch checks the operation of every problem itself
+        if(ck::profiler::GetTuningDbOption().mode_ != ck::profiler::TuningDbMode::Off &&
+           !ck::profiler::IsTuningDbSupported(argv[1]) && std::string_view(argv[1]) != "batch")
+        {
+            std::cerr << "--tune-db is not supported by operation " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+
         return (*operation)(argc, argv);
     }
     else
@@ -1,16 +1,25 @@
+import json
 import logging
 import os
-import subprocess
-from dataclasses import fields, replace
+import re
+from dataclasses import asdict, fields, replace
 from functools import lru_cache, partial
-from typing import List
+from typing import List, Optional, Tuple
 
 from ..util import library_path
 
-from .op import CKGemmOperation
+from .op import CKGemmOperation, CKGemmProblem
 
 log = logging.getLogger(__name__)
 
+# written next to the library sources of the package at build time, see setup.py
+MANIFEST_NAME = "gemm_universal_instances.json"
+MANIFEST_VERSION = 1
+
+_TEMPLATE_NAME = "DeviceGemm_Xdl_CShuffleV3"
+# a template argument: S<Index...> or a type alias, global constant or integer
+_TEMPLATE_ARG = re.compile(r"S<([^>]*)>|[^,<>\s]+")
+
 
 def _ck_library_dir():
     gemm_instances_path = os.path.join(
@@ -35,33 +44,15 @@ def parse_instances(str_instances: List[str]) -> List[CKGemmOperation]:
 
     op_instances = []
     for line in str_instances:
-        s_template_args = line.split("DeviceGemm_Xdl_CShuffleV3")[-1].strip("<>, ")
-        template_args = []
-        i_current = 0
-        while i_current < len(s_template_args):
-            if s_template_args[i_current] == " ":
-                # skip whitespace
-                i_current += 1
-                continue
-            elif s_template_args[i_current : i_current + 2] == "S<":
-                # parse template S<Index...>
-                i_next = s_template_args.find(">", i_current)
-                template_args.append(
-                    tuple(map(int, s_template_args[i_current + 2 : i_next].split(",")))
-                )
-                i_current = i_next + 2
-            else:
-                # all string attributes must be either type aliases or global constants in C++
-                i_next = s_template_args.find(",", i_current)
-                template_args.append(
-                    maybe_int(
-                        s_template_args[i_current : i_next if i_next != -1 else None]
-                    )
-                )
-                if i_next != -1:
-                    i_current = i_next + 1
-            if i_next == -1:
-                break
+        s_template_args = line.split(_TEMPLATE_NAME)[-1].strip("<>, ")
+        template_args = [
+            (
+                tuple(map(int, m.group(1).split(",")))
+                if m.group(1)
+                else maybe_int(m.group(0))
+            )
+            for m in _TEMPLATE_ARG.finditer(s_template_args)
+        ]
         # pad with `None`s for the fields which are not defined in the instance
         new_instance = CKGemmOperation(
             *template_args,  # type: ignore[arg-type]
@@ -137,54 +128,174 @@ def default_instances() -> List[CKGemmOperation]:
     ]
 
 
-@lru_cache(None)
-def gen_ops_library() -> List[CKGemmOperation]:
+def _instance_lines(ck_library_dir: str) -> List[str]:
     """
-    Parse the Universal Gemm instances defined in the composable kernel library folder.
+    The lines of the instance headers that declare a Universal Gemm instance,
+    commented out ones excluded
     """
-    ck_library_dir = _ck_library_dir()
-    if not ck_library_dir:
-        return []
-
-    grep_result = subprocess.run(
-        [
-            "grep",
-            "-inR",
-            "DeviceGemm_Xdl_CShuffleV3",
-            _ck_library_dir(),
-        ],
-        capture_output=True,
-        text=True,
-    )
+    lines = []
+    for root, dirs, files in os.walk(ck_library_dir):
+        dirs.sort()
+        for file in sorted(files):
+            if not file.endswith(".hpp"):
+                continue
+            with open(os.path.join(root, file)) as f:
+                for line in f:
+                    line = line.split("//")[0].strip()
+                    if _TEMPLATE_NAME + "<" in line:
+                        lines.append(line)
+    return lines
 
-    op_instances = parse_instances(grep_result.stdout.strip().split("\n"))
 
-    log.debug("ck instances from library: %d", len(op_instances))
+def write_manifest(ck_library_dir: str, path: str) -> int:
+    """
+    Write the Universal Gemm instances declared in the headers under `ck_library_dir`
+    to a JSON manifest, before the templated specialization and scheduler are substituted.
+    Returns the number of instances.
+    """
+    op_instances = parse_instances(_instance_lines(ck_library_dir))
+    with open(path, "w") as f:
+        json.dump(
+            {
+                "version": MANIFEST_VERSION,
+                "instances": [asdict(instance) for instance in op_instances],
+            },
+            f,
+        )
+    return len(op_instances)
 
-    schedulers = [
-        "BlockGemmPipelineScheduler::Intrawave",
-        "BlockGemmPipelineScheduler::Interwave",
-    ]
-    gemm_specs = [
-        "GemmSpecialization::Default",
-        "GemmSpecialization::MPadding",
-        "GemmSpecialization::NPadding",
-        "GemmSpecialization::KPadding",
-        "GemmSpecialization::MNPadding",
-        "GemmSpecialization::MKPadding",
-        "GemmSpecialization::NKPadding",
-        "GemmSpecialization::MNKPadding",
+
+def _load_manifest(path: str) -> Optional[List[CKGemmOperation]]:
+    try:
+        with open(path) as f:
+            manifest = json.load(f)
+    except (OSError, ValueError):
+        return None
+    if manifest.get("version") != MANIFEST_VERSION:
+        log.warning("ignoring CK instance manifest %s of another version", path)
+        return None
+    # JSON has no tuples
+    return [
+        CKGemmOperation(
+            **{
+                name: tuple(value) if isinstance(value, list) else value
+                for name, value in instance.items()
+            }
+        )
+        for instance in manifest["instances"]
     ]
 
+
+@lru_cache(None)
+def _library_instances() -> Tuple[CKGemmOperation, ...]:
+    """
+    The Universal Gemm instances of the library, from the manifest written at build time
+    or, when there is none (e.g. running from the source tree), from the instance headers
+    """
+    op_instances = _load_manifest(os.path.join(library_path(), MANIFEST_NAME))
+    if op_instances is None:
+        ck_library_dir = _ck_library_dir()
+        if not ck_library_dir:
+            return ()
+        op_instances = parse_instances(_instance_lines(ck_library_dir))
+
+    log.debug("ck instances from library: %d", len(op_instances))
+    return tuple(op_instances)
+
+
+_SCHEDULERS = [
+    "BlockGemmPipelineScheduler::Intrawave",
+    "BlockGemmPipelineScheduler::Interwave",
+]
+
+_GEMM_SPECS = [
+    "GemmSpecialization::Default",
+    "GemmSpecialization::MPadding",
+    "GemmSpecialization::NPadding",
+    "GemmSpecialization::KPadding",
+    "GemmSpecialization::MNPadding",
+    "GemmSpecialization::MKPadding",
+    "GemmSpecialization::NKPadding",
+    "GemmSpecialization::MNKPadding",
+]
+
+
+def _padded_dims(gemm_spec: str) -> str:
+    # "GemmSpecialization::MNPadding" -> "MN", "GemmSpecialization::Default" -> ""
+    spec = gemm_spec.split("::")[-1]
+    return spec[: -len("Padding")] if spec.endswith("Padding") else ""
+
+
+def _is_supported(instance: CKGemmOperation, problem: CKGemmProblem) -> bool:
+    """
+    Whether the layouts and data types match the problem and every vector access is aligned
+    """
+    for name in (
+        "a_layout",
+        "b_layout",
+        "c_layout",
+        "a_element_dtype",
+        "b_element_dtype",
+        "c_element_dtype",
+    ):
+        value = getattr(problem, name)
+        if value is not None and getattr(instance, name) != value:
+            return False
+
+    # A and B are loaded along K (vector dim 2) or along M and N (vector dim 1),
+    # C is stored along its rows
+    a_dim = problem.k if instance.a_block_transfer_src_vector_dim == 2 else problem.m
+    b_dim = problem.k if instance.b_block_transfer_src_vector_dim == 2 else problem.n
+    c_dim = problem.n if problem.c_layout == "Row" else problem.m
+    return (
+        a_dim % instance.a_block_transfer_src_scalar_per_vector == 0
+        and b_dim % instance.b_block_transfer_src_scalar_per_vector == 0
+        and c_dim % instance.c_shuffle_block_transfer_scalar_per_vector_n_per_block == 0
+    )
+
+
+@lru_cache(None)
+def gen_ops_library(problem: Optional[CKGemmProblem] = None) -> List[CKGemmOperation]:
+    """
+    The Universal Gemm instances defined in the composable kernel library folder,
+    with every templated specialization and scheduler substituted.
+
+    Given a problem, instances with other layouts or data types or misaligned vector accesses
+    are dropped before the substitution, and a templated specialization is only substituted
+    by the one padding exactly the dimensions the tiles do not divide.
+    """
     # substitute templated args by looping through their domains
     substitute_instances = []
-    for instance in op_instances:
+    for instance in _library_instances():
+        if problem is not None and not _is_supported(instance, problem):
+            continue
+
         sub_scheduler = instance.block_gemm_pipeline_scheduler == "BlkGemmPipeSched"
         sub_spec = instance.gemm_specialization == "GemmSpec"
         schedulers_range = (
-            schedulers if sub_scheduler else [instance.block_gemm_pipeline_scheduler]
+            _SCHEDULERS if sub_scheduler else [instance.block_gemm_pipeline_scheduler]
         )
-        spec_range = gemm_specs if sub_spec else [instance.gemm_specialization]
+        spec_range = _GEMM_SPECS if sub_spec else [instance.gemm_specialization]
+
+        if problem is not None:
+            padded = "".join(
+                dim
+                for dim, size, tile in (
+                    ("M", problem.m, instance.m_per_block),
+                    ("N", problem.n, instance.n_per_block),
+                    ("K", problem.k, instance.k_per_block),
+                )
+                if size % tile != 0
+            )
+            if sub_spec:
+                spec_range = [
+                    f"GemmSpecialization::{padded}Padding"
+                    if padded
+                    else "GemmSpecialization::Default"
+                ]
+            elif not set(padded) <= set(_padded_dims(instance.gemm_specialization)):
+                continue
+
         for scheduler in schedulers_range:
             for spec in spec_range:
                 substitute_instances.append(
@@ -93,3 +93,23 @@ class CKGemmOperation:
 
     def dict_items(self):
         return asdict(self).items()
+
+
+@dataclass(frozen=True)
+class CKGemmProblem:
+    """
+    The shape, layouts and (optionally) data types of a gemm,
+    used to select the instances that can run it
+    """
+
+    m: int
+    n: int
+    k: int
+
+    a_layout: str
+    b_layout: str
+    c_layout: str
+
+    a_element_dtype: Optional[str] = None
+    b_element_dtype: Optional[str] = None
+    c_element_dtype: Optional[str] = None
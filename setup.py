@@ -0,0 +1,32 @@
+import os
+import sys
+
+from setuptools import setup
+from setuptools.command.build_py import build_py
+
+
+class BuildPyWithInstanceManifest(build_py):
+    """
+    Also writes the manifest of the Universal Gemm instances, so ck4inductor does not
+    have to scan the instance headers at run time
+    """
+
+    def run(self):
+        super().run()
+
+        root = os.path.dirname(os.path.abspath(__file__))
+        sys.path.insert(0, os.path.join(root, "python"))
+        from ck4inductor.universal_gemm.gen_instances import MANIFEST_NAME, write_manifest
+
+        library_dir = os.path.join(self.build_lib, "ck4inductor", "library")
+        self.mkpath(library_dir)
+        num_instances = write_manifest(
+            os.path.join(
+                root, "library", "src", "tensor_operation_instance", "gpu", "gemm_universal"
+            ),
+            os.path.join(library_dir, MANIFEST_NAME),
+        )
+        self.announce(f"wrote {num_instances} Universal Gemm instances to {MANIFEST_NAME}", 2)
+
+
+setup(cmdclass={"build_py": BuildPyWithInstanceManifest})
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::check_err_report;
+using ck::utils::CheckErrOptions;
+using ck::utils::CheckErrReport;
+
+TEST(CheckErr, EqualRangesPass)
+{
+    // spans several chunks and a ragged tail
+    std::vector<float> out(3 * 4096 + 17);
+    for(std::size_t i = 0; i < out.size(); ++i)
+        out[i] = 0.25f * static_cast<float>(i % 97) - 7.f;
+
+    const std::vector<float> ref = out;
+
+    EXPECT_TRUE(ck::utils::check_err(out, ref));
+
+    const auto report = check_err_report(out, ref, 0, 0);
+    EXPECT_TRUE(report.Passed());
+    EXPECT_FALSE(report.IsPartial());
+    EXPECT_EQ(report.num_checked, out.size());
+    EXPECT_EQ(report.ulp_histogram[0], out.size());
+    EXPECT_EQ(report.max_abs_err, 0.0);
+}
+
+TEST(CheckErr, ReportsMismatchesInOrder)
+{
+    std::vector<float> out(10000, 1.f);
+    std::vector<float> ref(10000, 1.f);
+
+    out[9000] = 1.5f;
+    out[7]    = std::nextafter(1.f, 2.f); // one ULP, within tolerance
+    out[5000] = std::numeric_limits<float>::quiet_NaN();
+    out[42]   = 3.f;
+
+    EXPECT_FALSE(ck::utils::check_err(out, ref));
+
+    const auto report = check_err_report(out, ref, 1e-5, 3e-6);
+    EXPECT_FALSE(report.Passed());
+    EXPECT_EQ(report.err_count, 3u);
+    EXPECT_EQ(report.max_abs_err, 2.0);
+    EXPECT_EQ(report.max_rel_err, 2.0);
+
+    ASSERT_EQ(report.mismatches.size(), 3u);
+    EXPECT_EQ(report.mismatches[0].offset, 42u);
+    EXPECT_EQ(report.mismatches[1].offset, 5000u);
+    EXPECT_EQ(report.mismatches[2].offset, 9000u);
+
+    EXPECT_EQ(report.ulp_histogram[0], out.size() - 4);
+    EXPECT_EQ(report.ulp_histogram[1], 1u);
+    EXPECT_EQ(report.ulp_histogram[CheckErrReport::NumUlpBin - 1], 1u);
+}
+
+TEST(CheckErr, UlpHistogramUsesDataType)
+{
+    std::vector<ck::half_t> out(4, ck::type_convert<ck::half_t>(1.f));
+    std::vector<ck::half_t> ref = out;
+
+    // 1 and 4 ULP of half_t at 1.0
+    out[1] = ck::type_convert<ck::half_t>(1.f + std::ldexp(1.f, -10));
+    out[2] = ck::type_convert<ck::half_t>(1.f + std::ldexp(1.f, -8));
+
+    const auto report = check_err_report(out, ref, 0, 0);
+    EXPECT_EQ(report.err_count, 2u);
+    EXPECT_EQ(report.ulp_histogram[0], 2u);
+    EXPECT_EQ(report.ulp_histogram[1], 1u);
+    EXPECT_EQ(report.ulp_histogram[3], 1u);
+}
+
+TEST(CheckErr, TensorMismatchCoordinates)
+{
+    // [4, 5, 6] tensor with the first dimension innermost in memory
+    Tensor<float> out(std::vector<std::size_t>{4, 5, 6}, std::vector<std::size_t>{1, 24, 4});
+    Tensor<float> ref(out.mDesc);
+
+    out(3, 2, 1) = 1.f;
+    out(0, 4, 5) = -2.f;
+
+    const auto report = check_err_report(out, ref, 0, 0);
+    ASSERT_EQ(report.mismatches.size(), 2u);
+    EXPECT_EQ(report.mismatches[0].index, (std::vector<std::size_t>{3, 2, 1}));
+    EXPECT_EQ(report.mismatches[1].index, (std::vector<std::size_t>{0, 4, 5}));
+}
+
+TEST(CheckErr, EarlyExit)
+{
+    std::vector<int> out(16 * 4096, 3);
+    std::vector<int> ref(out.size(), 4);
+
+    CheckErrOptions options;
+    options.max_err_count       = 1;
+    options.max_mismatch_record = 2;
+    options.num_thread          = 1;
+
+    const auto report = check_err_report(out, ref, 0, 0, options);
+    EXPECT_TRUE(report.IsPartial());
+    EXPECT_EQ(report.num_checked, 4096u);
+    EXPECT_EQ(report.err_count, 4096u);
+    EXPECT_EQ(report.mismatches.size(), 2u);
+}
+
+TEST(CheckErr, SizeMismatch)
+{
+    const std::vector<float> out(3);
+    const std::vector<float> ref(4);
+
+    EXPECT_FALSE(ck::utils::check_err(out, ref));
+    EXPECT_FALSE(check_err_report(out, ref, 0, 0).size_match);
+}
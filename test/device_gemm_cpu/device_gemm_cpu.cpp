@@ -0,0 +1,494 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/cpu/device_gemm_cpu.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Bilinear    = ck::tensor_operation::element_wise::Bilinear;
+using AddRelu     = ck::tensor_operation::element_wise::AddRelu;
+using FastGelu    = ck::tensor_operation::element_wise::FastGelu;
+
+using ck::tensor_operation::host::ReferenceGemm;
+using ck::utils::HostGemmAccumulation;
+
+template <typename Layout>
+HostTensorDescriptor
+MakeDescriptor(std::size_t rows, std::size_t cols, std::size_t stride, Layout = Layout{})
+{
+    if constexpr(ck::is_same_v<Layout, Row>)
+        return HostTensorDescriptor({rows, cols}, {stride, std::size_t{1}});
+    else
+        return HostTensorDescriptor({rows, cols}, {std::size_t{1}, stride});
+}
+
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          HostGemmAccumulation Accumulation>
+void run_gemm_test(ck::index_t M,
+                   ck::index_t N,
+                   ck::index_t K,
+                   ck::index_t StrideA,
+                   ck::index_t StrideB,
+                   ck::index_t StrideC,
+                   double rtol,
+                   double atol)
+{
+    Tensor<ADataType> a_m_k(MakeDescriptor<ALayout>(M, K, StrideA));
+    Tensor<BDataType> b_k_n(MakeDescriptor<BLayout>(K, N, StrideB));
+    Tensor<CDataType> c_m_n_ref(MakeDescriptor<CLayout>(M, N, StrideC));
+    Tensor<CDataType> c_m_n(MakeDescriptor<CLayout>(M, N, StrideC));
+
+    ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b_k_n);
+
+    using ReferenceGemmInstance = ReferenceGemm<ADataType,
+                                                BDataType,
+                                                CDataType,
+                                                float,
+                                                PassThrough,
+                                                PassThrough,
+                                                PassThrough>;
+
+    auto ref_gemm     = ReferenceGemmInstance{};
+    auto ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmCpu<ALayout,
+                                                                 BLayout,
+                                                                 CLayout,
+                                                                 ADataType,
+                                                                 BDataType,
+                                                                 CDataType,
+                                                                 float,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 Accumulation>;
+
+    auto gemm     = DeviceOp{};
+    auto argument = gemm.MakeArgumentPointer(a_m_k.mData.data(),
+                                             b_k_n.mData.data(),
+                                             c_m_n.mData.data(),
+                                             M,
+                                             N,
+                                             K,
+                                             StrideA,
+                                             StrideB,
+                                             StrideC,
+                                             PassThrough{},
+                                             PassThrough{},
+                                             PassThrough{});
+    ASSERT_TRUE(gemm.IsSupportedArgument(argument.get()));
+    gemm.MakeInvokerPointer()->Run(argument.get());
+
+    EXPECT_TRUE(ck::utils::check_err(c_m_n, c_m_n_ref, "Error: incorrect results!", rtol, atol));
+}
+
+} // anonymous namespace
+
+TEST(DeviceGemmCpu, StrictMatchesReferenceF32)
+{
+    run_gemm_test<Row, Row, Row, float, float, float, HostGemmAccumulation::Strict>(
+        67, 131, 259, 259, 131, 131, 0, 0);
+}
+
+TEST(DeviceGemmCpu, StrictMatchesReferenceF16ColumnMajor)
+{
+    run_gemm_test<Row, Col, Row, ck::half_t, ck::half_t, ck::half_t, HostGemmAccumulation::Strict>(
+        33, 65, 129, 129, 129, 65, 0, 0);
+    run_gemm_test<Col, Row, Col, ck::half_t, ck::half_t, ck::half_t, HostGemmAccumulation::Strict>(
+        40, 24, 72, 40, 24, 40, 0, 0);
+}
+
+TEST(DeviceGemmCpu, StrictMatchesReferencePaddedStrides)
+{
+    run_gemm_test<Row, Col, Row, float, float, float, HostGemmAccumulation::Strict>(
+        45, 70, 100, 104, 112, 80, 0, 0);
+    run_gemm_test<Col, Col, Col, float, float, float, HostGemmAccumulation::Strict>(
+        45, 70, 100, 48, 101, 64, 0, 0);
+}
+
+TEST(DeviceGemmCpu, RelaxedF32)
+{
+    run_gemm_test<Row, Row, Row, float, float, float, HostGemmAccumulation::Relaxed>(
+        128, 256, 512, 512, 256, 256, 1e-5, 1e-4);
+}
+
+TEST(DeviceGemmCpu, MultipleDMatchesElementOps)
+{
+    using ck::half_t;
+
+    constexpr ck::index_t M = 50, N = 70, K = 90;
+
+    Tensor<half_t> a_m_k({M, K});
+    Tensor<half_t> b_k_n(MakeDescriptor<Col>(K, N, K));
+    Tensor<half_t> d_m_n({M, N});
+    Tensor<float> c_m_n({M, N});
+    Tensor<half_t> e_m_n_ref({M, N});
+    Tensor<half_t> e_m_n({M, N});
+
+    ck::utils::FillUniformDistribution<half_t>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<half_t>{-1.f, 1.f}(b_k_n);
+    ck::utils::FillUniformDistribution<half_t>{-1.f, 1.f}(d_m_n);
+
+    auto ref_gemm =
+        ReferenceGemm<half_t, half_t, float, float, PassThrough, PassThrough, PassThrough>{};
+    auto ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    const auto bilinear = Bilinear{0.5f, -2.f};
+    for(ck::index_t m = 0; m < M; ++m)
+        for(ck::index_t n = 0; n < N; ++n)
+            bilinear(e_m_n_ref(m, n), c_m_n(m, n), d_m_n(m, n));
+
+    using DeviceOp =
+        ck::tensor_operation::device::DeviceGemmMultipleDCpu<Row,
+                                                             Col,
+                                                             ck::Tuple<Row>,
+                                                             Row,
+                                                             half_t,
+                                                             half_t,
+                                                             ck::Tuple<half_t>,
+                                                             half_t,
+                                                             float,
+                                                             PassThrough,
+                                                             PassThrough,
+                                                             Bilinear,
+                                                             HostGemmAccumulation::Strict>;
+
+    auto gemm     = DeviceOp{};
+    auto argument = gemm.MakeArgument(a_m_k.mData.data(),
+                                      b_k_n.mData.data(),
+                                      {d_m_n.mData.data()},
+                                      e_m_n.mData.data(),
+                                      M,
+                                      N,
+                                      K,
+                                      K,
+                                      K,
+                                      {N},
+                                      N,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      bilinear);
+    ASSERT_TRUE(gemm.IsSupportedArgument(argument));
+    gemm.MakeInvoker().Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(e_m_n, e_m_n_ref, "Error: incorrect results!", 0, 0));
+
+    // the same product through AddRelu, with an output of another type
+    Tensor<float> d_f32_m_n({M, N});
+    Tensor<float> e_f32_m_n_ref({M, N});
+    Tensor<float> e_f32_m_n({M, N});
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(d_f32_m_n);
+
+    for(ck::index_t m = 0; m < M; ++m)
+        for(ck::index_t n = 0; n < N; ++n)
+            AddRelu{}(e_f32_m_n_ref(m, n), c_m_n(m, n), d_f32_m_n(m, n));
+
+    using DeviceOpAddRelu =
+        ck::tensor_operation::device::DeviceGemmMultipleDCpu<Row,
+                                                             Col,
+                                                             ck::Tuple<Row>,
+                                                             Row,
+                                                             half_t,
+                                                             half_t,
+                                                             ck::Tuple<float>,
+                                                             float,
+                                                             float,
+                                                             PassThrough,
+                                                             PassThrough,
+                                                             AddRelu,
+                                                             HostGemmAccumulation::Strict>;
+
+    auto add_relu_argument = DeviceOpAddRelu::MakeArgument(a_m_k.mData.data(),
+                                                           b_k_n.mData.data(),
+                                                           {d_f32_m_n.mData.data()},
+                                                           e_f32_m_n.mData.data(),
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           K,
+                                                           K,
+                                                           {N},
+                                                           N,
+                                                           PassThrough{},
+                                                           PassThrough{},
+                                                           AddRelu{});
+    DeviceOpAddRelu::MakeInvoker().Run(add_relu_argument);
+
+    EXPECT_TRUE(
+        ck::utils::check_err(e_f32_m_n, e_f32_m_n_ref, "Error: incorrect results!", 0, 0));
+}
+
+TEST(DeviceGemmCpu, FastGeluOutputOp)
+{
+    constexpr ck::index_t M = 31, N = 17, K = 64;
+
+    Tensor<float> a_m_k({M, K});
+    Tensor<float> b_k_n({K, N});
+    Tensor<float> c_m_n({M, N});
+    Tensor<ck::half_t> e_m_n_ref({M, N});
+    Tensor<ck::half_t> e_m_n({M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_k_n);
+
+    auto ref_gemm =
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>{};
+    auto ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    for(ck::index_t m = 0; m < M; ++m)
+        for(ck::index_t n = 0; n < N; ++n)
+            FastGelu{}(e_m_n_ref(m, n), c_m_n(m, n));
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmCpu<Row,
+                                                                 Row,
+                                                                 Row,
+                                                                 float,
+                                                                 float,
+                                                                 ck::half_t,
+                                                                 float,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 FastGelu,
+                                                                 HostGemmAccumulation::Strict>;
+
+    auto argument = DeviceOp::MakeArgument(a_m_k.mData.data(),
+                                           b_k_n.mData.data(),
+                                           e_m_n.mData.data(),
+                                           M,
+                                           N,
+                                           K,
+                                           K,
+                                           N,
+                                           N,
+                                           PassThrough{},
+                                           PassThrough{},
+                                           FastGelu{});
+    DeviceOp::MakeInvoker().Run(argument);
+
+    EXPECT_TRUE(ck::utils::check_err(e_m_n, e_m_n_ref, "Error: incorrect results!", 0, 0));
+}
+
+TEST(DeviceGemmCpu, RejectsShortStrides)
+{
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmCpu<Row,
+                                                                 Col,
+                                                                 Row,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 HostGemmAccumulation::Strict>;
+
+    const auto make = [](ck::index_t StrideA, ck::index_t StrideB, ck::index_t StrideC) {
+        return DeviceOp::MakeArgument(nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      16,
+                                      32,
+                                      64,
+                                      StrideA,
+                                      StrideB,
+                                      StrideC,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    EXPECT_TRUE(DeviceOp::IsSupportedArgument(make(64, 64, 32)));
+    EXPECT_FALSE(DeviceOp::IsSupportedArgument(make(63, 64, 32)));
+    EXPECT_FALSE(DeviceOp::IsSupportedArgument(make(64, 32, 32)));
+    EXPECT_FALSE(DeviceOp::IsSupportedArgument(make(64, 64, 16)));
+}
+
+TEST(DeviceGemmCpu, RejectsDeviceMemory)
+{
+    int num_devices = 0;
+    if(hipGetDeviceCount(&num_devices) != hipSuccess || num_devices == 0)
+    {
+        (void)hipGetLastError();
+        GTEST_SKIP() << "no device to allocate memory on";
+    }
+
+    constexpr ck::index_t M = 8, N = 12, K = 16;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmCpu<Row,
+                                                                 Row,
+                                                                 Row,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 HostGemmAccumulation::Strict>;
+
+    std::vector<float> a(M * K), b(K * N), c(M * N);
+    DeviceMem b_device_buf(sizeof(float) * K * N);
+
+    auto gemm     = DeviceOp{};
+    auto argument = gemm.MakeArgumentPointer(
+        a.data(), b.data(), c.data(), M, N, K, K, N, N, PassThrough{}, PassThrough{}, {});
+    EXPECT_TRUE(gemm.IsSupportedArgument(argument.get()));
+
+    argument = gemm.MakeArgumentPointer(a.data(),
+                                        b_device_buf.GetDeviceBuffer(),
+                                        c.data(),
+                                        M,
+                                        N,
+                                        K,
+                                        K,
+                                        N,
+                                        N,
+                                        PassThrough{},
+                                        PassThrough{},
+                                        {});
+    EXPECT_FALSE(gemm.IsSupportedArgument(argument.get()));
+}
+
+TEST(DeviceGemmCpu, RebindsCopiedArgument)
+{
+    constexpr ck::index_t M = 8, N = 12, K = 16;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmCpu<Row,
+                                                                 Row,
+                                                                 Row,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 float,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 HostGemmAccumulation::Strict>;
+
+    std::vector<float> a(M * K, 1.f), b(K * N, 2.f), c(M * N, 0.f);
+    std::vector<float> a2(M * K, 3.f), c2(M * N, 0.f);
+
+    auto gemm     = DeviceOp{};
+    auto argument = gemm.MakeArgumentPointer(
+        a.data(), b.data(), c.data(), M, N, K, K, N, N, PassThrough{}, PassThrough{}, {});
+
+    std::vector<std::byte> storage(gemm.GetArgumentSize());
+    auto* copy = gemm.CopyArgument(argument.get(), storage.data());
+    ASSERT_NE(copy, nullptr);
+
+    const std::array<const void*, 3> pointers{a2.data(), b.data(), c2.data()};
+    EXPECT_FALSE(gemm.UpdateArgumentPointers(copy, pointers.data(), 2));
+    ASSERT_TRUE(gemm.UpdateArgumentPointers(copy, pointers.data(), pointers.size()));
+
+    auto invoker = gemm.MakeInvokerPointer();
+    invoker->Run(copy);
+    invoker->Run(argument.get());
+    copy->~BaseArgument();
+
+    EXPECT_EQ(c, std::vector<float>(M * N, 2.f * K));
+    EXPECT_EQ(c2, std::vector<float>(M * N, 6.f * K));
+}
+
+TEST(DeviceGemmCpu, AddsInstancesForSupportedTypes)
+{
+    using namespace ck::tensor_operation::device;
+
+    // the gemm family records descriptors, nothing is constructed until MakeInstances
+    instance::DeviceOperationInstanceCatalog<
+        DeviceGemm<Row, Col, Row, float, float, float, PassThrough, PassThrough, PassThrough>>
+        catalog;
+    instance::add_device_gemm_cpu_instances(catalog);
+    ASSERT_EQ(catalog.GetNumInstance(), 2u);
+    EXPECT_EQ(catalog.GetDescriptor(0).GetTypeString(), "DeviceGemmCpu<Strict>");
+    EXPECT_EQ(catalog.GetDescriptor(1).GetTypeString(), "DeviceGemmCpu<Relaxed>");
+
+    const auto gemms = catalog.MakeInstances();
+    ASSERT_EQ(gemms.size(), 2u);
+    EXPECT_EQ(gemms[0]->GetTypeString(), "DeviceGemmCpu<Strict>");
+    EXPECT_EQ(gemms[1]->GetTypeString(), "DeviceGemmCpu<Relaxed>");
+
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Row,
+                                                    ck::Tuple<Row>,
+                                                    Row,
+                                                    ck::half_t,
+                                                    ck::half_t,
+                                                    ck::Tuple<ck::half_t>,
+                                                    ck::half_t,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    Bilinear>>>
+        multiple_d_gemms;
+    instance::add_device_gemm_multiple_d_cpu_instances(multiple_d_gemms);
+    ASSERT_EQ(multiple_d_gemms.size(), 2u);
+    EXPECT_EQ(multiple_d_gemms[0]->GetTypeString(), "DeviceGemmMultipleDCpu<Strict>");
+
+    // there are no double instances
+    instance::DeviceOperationInstanceCatalog<
+        DeviceGemm<Row, Row, Row, double, double, double, PassThrough, PassThrough, PassThrough>>
+        double_catalog;
+    instance::add_device_gemm_cpu_instances(double_catalog);
+    EXPECT_EQ(double_catalog.GetNumInstance(), 0u);
+
+    // AddRelu only has overloads for some (E, D) pairs
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Row,
+                                                    ck::Tuple<Row>,
+                                                    Row,
+                                                    float,
+                                                    float,
+                                                    ck::Tuple<ck::half_t>,
+                                                    float,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    AddRelu>>>
+        add_relu_gemms;
+    instance::add_device_gemm_multiple_d_cpu_instances(add_relu_gemms);
+    EXPECT_EQ(add_relu_gemms.size(), 2u);
+
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Row,
+                                                    ck::Tuple<Row>,
+                                                    Row,
+                                                    ck::bhalf_t,
+                                                    ck::bhalf_t,
+                                                    ck::Tuple<ck::half_t>,
+                                                    ck::bhalf_t,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    AddRelu>>>
+        unsupported_add_relu_gemms;
+    instance::add_device_gemm_multiple_d_cpu_instances(unsupported_add_relu_gemms);
+    EXPECT_TRUE(unsupported_add_relu_gemms.empty());
+}
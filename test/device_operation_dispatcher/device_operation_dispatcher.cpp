@@ -0,0 +1,362 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_dispatcher.hpp"
+
+using ck::tensor_operation::device::BaseArgument;
+using ck::tensor_operation::device::BaseInvoker;
+using ck::tensor_operation::device::BaseOperator;
+
+namespace {
+
+struct MockDeviceOp : public BaseOperator
+{
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+// M, N, K and two buffers
+using Dispatcher =
+    ck::tensor_operation::device::instance::DeviceOperationDispatcher<MockDeviceOp, 3, 2>;
+
+struct MockArgument : public BaseArgument
+{
+    Dispatcher::Shape shape_;
+    Dispatcher::Pointers pointers_;
+};
+
+struct Counters
+{
+    int num_argument_  = 0;
+    int num_supported_ = 0;
+    int num_rebind_    = 0;
+    int num_update_    = 0;
+    int num_run_       = 0;
+};
+
+struct MockInvoker : public BaseInvoker
+{
+    MockInvoker(int id, Counters& counters) : id_(id), counters_(counters) {}
+
+    float Run(const BaseArgument*, const StreamConfig& = StreamConfig{}) override
+    {
+        ++counters_.num_run_;
+        return static_cast<float>(id_);
+    }
+
+    int id_;
+    Counters& counters_;
+};
+
+// supports the shapes whose M is a multiple of m_per_block
+struct MockInstance : public MockDeviceOp
+{
+    MockInstance(int id, ck::long_index_t m_per_block, Counters& counters)
+        : id_(id), m_per_block_(m_per_block), counters_(counters)
+    {
+    }
+
+    std::size_t GetArgumentSize() const override { return sizeof(MockArgument); }
+
+    BaseArgument* CopyArgument(const BaseArgument* p_arg, void* p_storage) const override
+    {
+        return ck::tensor_operation::device::CopyArgumentTo<MockArgument>(p_arg, p_storage);
+    }
+
+    bool UpdateArgumentPointers(BaseArgument* p_arg,
+                                const void* const* p_pointers,
+                                std::size_t num_pointer) const override
+    {
+        auto* arg = dynamic_cast<MockArgument*>(p_arg);
+        if(!update_ || arg == nullptr || num_pointer != arg->pointers_.size())
+            return false;
+
+        ++counters_.num_update_;
+        std::copy(p_pointers, p_pointers + num_pointer, arg->pointers_.begin());
+        return true;
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        ++counters_.num_supported_;
+        return static_cast<const MockArgument*>(p_arg)->shape_[0] % m_per_block_ == 0;
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<MockInvoker>(id_, counters_);
+    }
+
+    int id_;
+    ck::long_index_t m_per_block_;
+    bool update_ = false;
+    Counters& counters_;
+};
+
+class DeviceOperationDispatcher : public ::testing::Test
+{
+    protected:
+    // instance 0 runs M % 128 == 0, instance 1 M % 64 == 0, instance 2 M % 8 == 0
+    Dispatcher
+    MakeDispatcher(bool with_rebind, std::size_t max_num_shape = 16, bool with_update = false)
+    {
+        std::vector<std::unique_ptr<MockDeviceOp>> instances;
+        for(auto [id, m_per_block] : {std::pair{0, 128}, std::pair{1, 64}, std::pair{2, 8}})
+        {
+            auto instance     = std::make_unique<MockInstance>(id, m_per_block, counters_);
+            instance->update_ = with_update;
+            instances.push_back(std::move(instance));
+        }
+
+        auto make_argument = [this](MockDeviceOp&,
+                                    const Dispatcher::Shape& shape,
+                                    const Dispatcher::Pointers& pointers) {
+            ++counters_.num_argument_;
+            auto argument       = std::make_unique<MockArgument>();
+            argument->shape_    = shape;
+            argument->pointers_ = pointers;
+            return std::unique_ptr<BaseArgument>(std::move(argument));
+        };
+
+        Dispatcher::ArgumentRebinder rebind;
+        if(with_rebind)
+        {
+            rebind = [this](MockDeviceOp&, BaseArgument& argument, const Dispatcher::Pointers& p) {
+                ++counters_.num_rebind_;
+                static_cast<MockArgument&>(argument).pointers_ = p;
+                return true;
+            };
+        }
+
+        return Dispatcher{std::move(instances), make_argument, rebind, max_num_shape};
+    }
+
+    static int GetId(const Dispatcher::Selection& selection)
+    {
+        return static_cast<MockInstance*>(selection.op_)->id_;
+    }
+
+    static const MockArgument& GetArgument(const Dispatcher::Selection& selection)
+    {
+        return *static_cast<MockArgument*>(selection.argument_);
+    }
+
+    Counters counters_;
+    int a_ = 0;
+    int b_ = 0;
+    int c_ = 0;
+};
+
+} // namespace
+
+TEST_F(DeviceOperationDispatcher, SelectsFirstSupportedInstance)
+{
+    auto dispatcher = MakeDispatcher(false);
+
+    const auto selection = dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    ASSERT_NE(selection.op_, nullptr);
+    EXPECT_EQ(GetId(selection), 1);
+    EXPECT_EQ(counters_.num_argument_, 2);
+    EXPECT_EQ(counters_.num_supported_, 2);
+
+    const auto& argument = GetArgument(selection);
+    EXPECT_EQ(argument.shape_, (Dispatcher::Shape{192, 256, 64}));
+    EXPECT_EQ(argument.pointers_, (Dispatcher::Pointers{&a_, &b_}));
+}
+
+TEST_F(DeviceOperationDispatcher, ReusesArgument)
+{
+    auto dispatcher = MakeDispatcher(false);
+
+    const auto first  = dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    const auto second = dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    EXPECT_EQ(first.op_, second.op_);
+    EXPECT_EQ(first.argument_, second.argument_);
+    EXPECT_EQ(first.invoker_, second.invoker_);
+    EXPECT_EQ(counters_.num_argument_, 2);
+    EXPECT_EQ(counters_.num_supported_, 2);
+    EXPECT_EQ(dispatcher.GetNumShape(), 1u);
+}
+
+TEST_F(DeviceOperationDispatcher, RebindsPointers)
+{
+    auto dispatcher = MakeDispatcher(true);
+
+    const auto first  = dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    const auto second = dispatcher.Select({192, 256, 64}, {&a_, &c_});
+    EXPECT_EQ(first.argument_, second.argument_);
+    EXPECT_EQ(GetArgument(second).pointers_, (Dispatcher::Pointers{&a_, &c_}));
+    EXPECT_EQ(counters_.num_argument_, 2);
+    EXPECT_EQ(counters_.num_rebind_, 1);
+
+    // rebinding to the current pointers is skipped
+    dispatcher.Select({192, 256, 64}, {&a_, &c_});
+    EXPECT_EQ(counters_.num_rebind_, 1);
+}
+
+TEST_F(DeviceOperationDispatcher, UpdatesArgumentPointers)
+{
+    auto dispatcher = MakeDispatcher(false, 16, true);
+
+    const auto first  = dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    const auto second = dispatcher.Select({192, 256, 64}, {&c_, &b_});
+    EXPECT_EQ(first.argument_, second.argument_);
+    EXPECT_EQ(GetArgument(second).pointers_, (Dispatcher::Pointers{&c_, &b_}));
+    EXPECT_EQ(counters_.num_argument_, 2);
+    EXPECT_EQ(counters_.num_update_, 1);
+}
+
+TEST_F(DeviceOperationDispatcher, RemakesArgumentWithoutRebind)
+{
+    auto dispatcher = MakeDispatcher(false);
+
+    dispatcher.Select({192, 256, 64}, {&a_, &b_});
+    const auto selection = dispatcher.Select({192, 256, 64}, {&a_, &c_});
+    EXPECT_EQ(GetId(selection), 1);
+    EXPECT_EQ(GetArgument(selection).pointers_, (Dispatcher::Pointers{&a_, &c_}));
+    EXPECT_EQ(counters_.num_argument_, 3);
+    EXPECT_EQ(counters_.num_supported_, 2);
+}
+
+TEST_F(DeviceOperationDispatcher, CachesUnsupportedShape)
+{
+    auto dispatcher = MakeDispatcher(false);
+
+    EXPECT_EQ(dispatcher.Select({100, 256, 64}, {&a_, &b_}).op_, nullptr);
+    EXPECT_EQ(counters_.num_supported_, 3);
+
+    EXPECT_EQ(dispatcher.Select({100, 256, 64}, {&a_, &b_}).op_, nullptr);
+    EXPECT_EQ(counters_.num_supported_, 3);
+    EXPECT_THROW(dispatcher.Run({100, 256, 64}, {&a_, &b_}), std::runtime_error);
+}
+
+TEST_F(DeviceOperationDispatcher, PrefersInstanceOfBucket)
+{
+    auto dispatcher = MakeDispatcher(false);
+
+    // 192 and 128 have the same bit width and are multiples of 8: once instance 1 ran 192, it is
+    // tried first for 128 although instance 0 comes first and supports it too
+    EXPECT_EQ(Dispatcher::GetBucket({192, 256, 64}), Dispatcher::GetBucket({128, 256, 64}));
+    EXPECT_EQ(GetId(dispatcher.Select({192, 256, 64}, {&a_, &b_})), 1);
+    EXPECT_EQ(counters_.num_supported_, 2);
+    EXPECT_EQ(GetId(dispatcher.Select({128, 256, 64}, {&a_, &b_})), 1);
+    EXPECT_EQ(counters_.num_supported_, 3);
+
+    // a bucket falls back to the other instances in order
+    EXPECT_EQ(GetId(dispatcher.Select({200, 256, 64}, {&a_, &b_})), 2);
+    EXPECT_EQ(counters_.num_supported_, 6);
+    EXPECT_EQ(GetId(dispatcher.Select({136, 256, 64}, {&a_, &b_})), 2);
+    EXPECT_EQ(counters_.num_supported_, 8);
+
+    // another bucket starts from the first instance
+    EXPECT_NE(Dispatcher::GetBucket({256, 256, 64}), Dispatcher::GetBucket({128, 256, 64}));
+    EXPECT_EQ(GetId(dispatcher.Select({256, 256, 64}, {&a_, &b_})), 0);
+    EXPECT_EQ(dispatcher.GetNumBucket(), 2u);
+}
+
+TEST_F(DeviceOperationDispatcher, Prepare)
+{
+    auto dispatcher = MakeDispatcher(true);
+
+    dispatcher.Prepare({{128, 256, 64}, {64, 256, 64}});
+    EXPECT_EQ(dispatcher.GetNumShape(), 2u);
+    const auto num_argument = counters_.num_argument_;
+
+    const auto selection = dispatcher.Select({64, 256, 64}, {&a_, &b_});
+    EXPECT_EQ(GetId(selection), 1);
+    EXPECT_EQ(counters_.num_argument_, num_argument);
+    EXPECT_EQ(counters_.num_rebind_, 1);
+}
+
+TEST_F(DeviceOperationDispatcher, Run)
+{
+    auto dispatcher = MakeDispatcher(true);
+
+    EXPECT_FLOAT_EQ(dispatcher.Run({128, 256, 64}, {&a_, &b_}), 0.f);
+    EXPECT_FLOAT_EQ(dispatcher.Run({64, 256, 64}, {&a_, &b_}), 1.f);
+    EXPECT_FLOAT_EQ(dispatcher.Run({128, 256, 64}, {&a_, &c_}), 0.f);
+    EXPECT_EQ(counters_.num_run_, 3);
+}
+
+TEST_F(DeviceOperationDispatcher, BoundedShapes)
+{
+    auto dispatcher = MakeDispatcher(false, 2);
+
+    const auto first = dispatcher.Select({64, 256, 64}, {&a_, &b_});
+    dispatcher.Select({128, 256, 64}, {&a_, &b_});
+    EXPECT_EQ(dispatcher.GetNumShape(), 2u);
+
+    // selecting 64 again makes 128 the least recently selected shape, which 256 drops
+    dispatcher.Select({64, 256, 64}, {&a_, &b_});
+    dispatcher.Select({256, 256, 64}, {&a_, &b_});
+    EXPECT_EQ(dispatcher.GetNumShape(), 2u);
+
+    // the argument of a kept shape stays valid
+    auto num_argument = counters_.num_argument_;
+    EXPECT_EQ(dispatcher.Select({64, 256, 64}, {&a_, &b_}).argument_, first.argument_);
+    EXPECT_EQ(GetArgument(first).shape_, (Dispatcher::Shape{64, 256, 64}));
+    EXPECT_EQ(counters_.num_argument_, num_argument);
+
+    // a dropped shape is selected again
+    EXPECT_EQ(GetId(dispatcher.Select({128, 256, 64}, {&a_, &b_})), 0);
+    EXPECT_GT(counters_.num_argument_, num_argument);
+    EXPECT_EQ(dispatcher.GetNumShape(), 2u);
+}
+
+TEST_F(DeviceOperationDispatcher, PrepareKeepsLastShapes)
+{
+    auto dispatcher = MakeDispatcher(true, 2);
+
+    dispatcher.Prepare({{8, 256, 64}, {64, 256, 64}, {128, 256, 64}});
+    EXPECT_EQ(dispatcher.GetNumShape(), 2u);
+
+    const auto num_argument = counters_.num_argument_;
+    dispatcher.Select({64, 256, 64}, {&a_, &b_});
+    dispatcher.Select({128, 256, 64}, {&a_, &b_});
+    EXPECT_EQ(counters_.num_argument_, num_argument);
+}
+
+TEST_F(DeviceOperationDispatcher, BucketOfHugeSize)
+{
+    // a negative size has all 64 bits set, its width must not spill into the next size
+    const auto bucket = Dispatcher::GetBucket({-1, 1, 1});
+    EXPECT_EQ(bucket >> 16, (std::uint64_t{63} << 2));
+    EXPECT_EQ(bucket & 0xffff, Dispatcher::GetBucket({0, 1, 1}) & 0xffff);
+}
+
+TEST_F(DeviceOperationDispatcher, CopyArgument)
+{
+    MockInstance instance{0, 128, counters_};
+    MockArgument argument;
+    argument.shape_    = {128, 256, 64};
+    argument.pointers_ = {&a_, &b_};
+
+    ASSERT_EQ(instance.GetArgumentSize(), sizeof(MockArgument));
+    alignas(std::max_align_t) unsigned char storage[sizeof(MockArgument)];
+
+    BaseArgument* p_copy = instance.CopyArgument(&argument, storage);
+    ASSERT_EQ(static_cast<void*>(p_copy), static_cast<void*>(storage));
+    EXPECT_EQ(static_cast<MockArgument*>(p_copy)->shape_, argument.shape_);
+
+    // the copy is rebound without touching the original
+    instance.update_                  = true;
+    const Dispatcher::Pointers others = {&c_, &c_};
+    EXPECT_TRUE(instance.UpdateArgumentPointers(p_copy, others.data(), others.size()));
+    EXPECT_FALSE(instance.UpdateArgumentPointers(p_copy, others.data(), 1));
+    EXPECT_EQ(static_cast<MockArgument*>(p_copy)->pointers_, others);
+    EXPECT_EQ(argument.pointers_, (Dispatcher::Pointers{&a_, &b_}));
+
+    p_copy->~BaseArgument();
+
+    // arguments of other operators are not copied
+    EXPECT_EQ(instance.CopyArgument(nullptr, storage), nullptr);
+}
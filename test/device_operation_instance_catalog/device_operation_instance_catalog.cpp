@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_ranking.hpp"
+
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::instance::add_device_operation_instances;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceFactory;
+using ck::tensor_operation::device::instance::GetDeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::ParseGemmTileDescription;
+
+namespace {
+
+struct MockDeviceOp : public BaseOperator
+{
+};
+
+int num_constructed = 0;
+
+template <int MPerBlock, int NPerBlock>
+struct MockInstance : public MockDeviceOp
+{
+    MockInstance() { ++num_constructed; }
+    MockInstance(const MockInstance&) : MockDeviceOp() { ++num_constructed; }
+
+    std::string GetTypeString() const override
+    {
+        return "DeviceGemmXdlUniversal<Default, RRR> BlkSize: 256, BlkTile: " +
+               std::to_string(MPerBlock) + "x" + std::to_string(NPerBlock) +
+               "x64, WaveTile: 32x32, WaveMap: 4x2, VmemReadVec: 8x8";
+    }
+};
+
+using MockInstances = std::tuple<MockInstance<256, 128>, MockInstance<128, 128>>;
+using MoreInstances = std::tuple<MockInstance<64, 64>>;
+
+using Catalog = DeviceOperationInstanceCatalog<MockDeviceOp>;
+
+void add_mock_instances(Catalog& catalog)
+{
+    add_device_operation_instances(catalog, MockInstances{});
+    add_device_operation_instances(catalog, MoreInstances{});
+}
+
+} // namespace
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <>
+struct DeviceOperationInstanceFactory<MockDeviceOp>
+{
+    static void AddInstances(Catalog& catalog) { add_mock_instances(catalog); }
+
+    static auto GetInstances()
+    {
+        return GetDeviceOperationInstanceCatalog<MockDeviceOp>().MakeInstances();
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+TEST(DeviceOperationInstanceCatalog, CollectDoesNotConstructInstances)
+{
+    // the tuples themselves are built by the caller of add_device_operation_instances
+    num_constructed = 0;
+
+    const auto catalog = Catalog::Collect(add_mock_instances);
+
+    EXPECT_EQ(catalog.GetNumInstance(), 3u);
+    EXPECT_EQ(num_constructed, 3);
+
+    num_constructed = 0;
+    const auto again = Catalog::Collect(add_mock_instances);
+    EXPECT_EQ(again.GetNumInstance(), 3u);
+    EXPECT_EQ(num_constructed, 3);
+}
+
+TEST(DeviceOperationInstanceCatalog, DescriptorsAreSharedAndTypeStringsKept)
+{
+    const auto catalog = Catalog::Collect(add_mock_instances);
+    const auto again   = Catalog::Collect(add_mock_instances);
+
+    for(std::size_t i = 0; i < catalog.GetNumInstance(); ++i)
+        EXPECT_EQ(&catalog.GetDescriptor(i), &again.GetDescriptor(i));
+
+    const auto& type_string = catalog.GetDescriptor(1).GetTypeString();
+    EXPECT_EQ(&type_string, &again.GetDescriptor(1).GetTypeString());
+
+    const auto desc = ParseGemmTileDescription(type_string);
+    ASSERT_TRUE(desc.has_value());
+    EXPECT_EQ(desc->m_per_block_, 128);
+    EXPECT_EQ(desc->n_per_block_, 128);
+    EXPECT_FALSE(desc->pad_m_);
+
+    // the string is made once, later calls construct nothing
+    for(std::size_t i = 0; i < catalog.GetNumInstance(); ++i)
+        catalog.GetDescriptor(i).GetTypeString();
+    num_constructed = 0;
+    for(std::size_t i = 0; i < catalog.GetNumInstance(); ++i)
+        catalog.GetDescriptor(i).GetTypeString();
+    EXPECT_EQ(num_constructed, 0);
+}
+
+TEST(DeviceOperationInstanceCatalog, MakesOnlySelectedInstances)
+{
+    const auto catalog = Catalog::Collect(add_mock_instances);
+    for(std::size_t i = 0; i < catalog.GetNumInstance(); ++i)
+        catalog.GetDescriptor(i).GetTypeString();
+
+    num_constructed  = 0;
+    const auto small = catalog.MakeInstances([](const Catalog::Descriptor& descriptor) {
+        const auto desc = ParseGemmTileDescription(descriptor.GetTypeString());
+        return desc && desc->m_per_block_ <= 128;
+    });
+
+    ASSERT_EQ(small.size(), 2u);
+    EXPECT_EQ(num_constructed, 2);
+    EXPECT_EQ(small[0]->GetTypeString(), catalog.GetDescriptor(1).GetTypeString());
+    EXPECT_EQ(small[1]->GetTypeString(), catalog.GetDescriptor(2).GetTypeString());
+
+    num_constructed = 0;
+    const auto op   = catalog.MakeInstance(0);
+    EXPECT_EQ(num_constructed, 1);
+    EXPECT_EQ(op->GetTypeString(), catalog.GetDescriptor(0).GetTypeString());
+
+    EXPECT_THROW(catalog.MakeInstance(3), std::out_of_range);
+}
+
+TEST(DeviceOperationInstanceCatalog, VectorOverloadConstructsInstances)
+{
+    // families that do not take a catalog yet get the instances of the catalog
+    std::vector<std::unique_ptr<MockDeviceOp>> instances;
+    add_device_operation_instances(instances, MockInstances{});
+    add_device_operation_instances(instances, MoreInstances{});
+
+    const auto catalog = Catalog::Collect(add_mock_instances);
+    ASSERT_EQ(instances.size(), catalog.GetNumInstance());
+    for(std::size_t i = 0; i < instances.size(); ++i)
+        EXPECT_EQ(instances[i]->GetTypeString(), catalog.GetDescriptor(i).GetTypeString());
+}
+
+TEST(DeviceOperationInstanceCatalog, FactoryCatalogIsCollectedOnce)
+{
+    const auto& catalog = GetDeviceOperationInstanceCatalog<MockDeviceOp>();
+    EXPECT_EQ(&catalog, &GetDeviceOperationInstanceCatalog<MockDeviceOp>());
+    EXPECT_EQ(catalog.GetNumInstance(), 3u);
+    EXPECT_EQ(catalog.MakeInstances().size(), 3u);
+
+    // GetInstances constructs every instance of the catalog
+    num_constructed      = 0;
+    const auto instances = DeviceOperationInstanceFactory<MockDeviceOp>::GetInstances();
+    ASSERT_EQ(instances.size(), 3u);
+    EXPECT_EQ(num_constructed, 3);
+    EXPECT_EQ(instances[0]->GetTypeString(), catalog.GetDescriptor(0).GetTypeString());
+}
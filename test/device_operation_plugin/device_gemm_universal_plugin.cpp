@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm_universal.hpp"
+
+#ifndef CK_DEVICE_OPERATION_PLUGINS
+#error "the test queries the factories of a process built with CK_DEVICE_OPERATION_PLUGINS"
+#endif
+
+using ck::tensor_operation::device::DeviceGemmV2;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceFactory;
+using ck::tensor_operation::device::instance::DeviceOperationPluginRegistry;
+
+#ifdef CK_ENABLE_FP16
+TEST(DeviceGemmUniversalPlugin, FactoryLoadsPlugin)
+{
+    using namespace ck::tensor_operation::device::instance;
+    using DeviceOp =
+        DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+    auto& registry = DeviceOperationPluginRegistry::Get();
+    EXPECT_FALSE(registry.IsLoaded("gemm_universal"));
+
+    const auto instances = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+    EXPECT_TRUE(registry.IsLoaded("gemm_universal"));
+    EXPECT_FALSE(instances.empty());
+
+    // the plugin adds the instances it was built with and a second query does not load it again
+    EXPECT_EQ(DeviceOperationInstanceFactory<DeviceOp>::GetInstances().size(), instances.size());
+}
+#endif
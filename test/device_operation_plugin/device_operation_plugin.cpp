@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+#include "device_operation_plugin_stub.hpp"
+
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationPluginRegistry;
+using ck::tensor_operation::device::instance::GetDeviceOperationPluginCatalog;
+using ck::tensor_operation::device::instance::GetDeviceOperationPluginInstances;
+using device_operation_plugin_test::MockDeviceOp;
+using device_operation_plugin_test::OtherDeviceOp;
+
+TEST(DeviceOperationPlugin, LoadsFamilyOnFirstQuery)
+{
+    auto& registry = DeviceOperationPluginRegistry::Get();
+    EXPECT_FALSE(registry.IsLoaded("stub"));
+
+    std::vector<std::unique_ptr<MockDeviceOp>> instances;
+    registry.AddInstances("stub", instances);
+    EXPECT_TRUE(instances.empty());
+
+    instances = GetDeviceOperationPluginInstances<MockDeviceOp>("stub");
+    EXPECT_TRUE(registry.IsLoaded("stub"));
+
+    ASSERT_EQ(instances.size(), 3u);
+    EXPECT_EQ(instances[0]->GetTypeString(), "MockInstance<0>");
+    EXPECT_EQ(instances[1]->GetTypeString(), "MockInstance<1>");
+    EXPECT_EQ(instances[2]->GetTypeString(), "MockInstance<2>");
+
+    // a second query does not load the plugin again
+    EXPECT_EQ(GetDeviceOperationPluginInstances<MockDeviceOp>("stub").size(), 3u);
+}
+
+TEST(DeviceOperationPlugin, InstancesAreKeyedByOpAndFamily)
+{
+    const auto others = GetDeviceOperationPluginInstances<OtherDeviceOp>("stub");
+    ASSERT_EQ(others.size(), 1u);
+    EXPECT_EQ(others[0]->GetTypeString(), "MockInstance<3>");
+
+    std::vector<std::unique_ptr<MockDeviceOp>> instances;
+    DeviceOperationPluginRegistry::Get().AddInstances("other", instances);
+    EXPECT_TRUE(instances.empty());
+}
+
+TEST(DeviceOperationPlugin, LoadsEachFamilyFromItsPlugin)
+{
+    auto& registry = DeviceOperationPluginRegistry::Get();
+    EXPECT_FALSE(registry.IsLoaded("other_stub"));
+
+    const auto others = GetDeviceOperationPluginInstances<MockDeviceOp>("other_stub");
+    EXPECT_TRUE(registry.IsLoaded("other_stub"));
+
+    ASSERT_EQ(others.size(), 1u);
+    EXPECT_EQ(others[0]->GetTypeString(), "MockInstance<4>");
+
+    // the instances of the same DeviceOp in the stub family are not mixed with them
+    const auto stubs = GetDeviceOperationPluginInstances<MockDeviceOp>("stub");
+    ASSERT_EQ(stubs.size(), 3u);
+    EXPECT_EQ(stubs[2]->GetTypeString(), "MockInstance<2>");
+
+    EXPECT_TRUE(GetDeviceOperationPluginInstances<OtherDeviceOp>("other_stub").empty());
+}
+
+TEST(DeviceOperationPlugin, CatalogsThroughPlugin)
+{
+    const auto catalog = GetDeviceOperationPluginCatalog<MockDeviceOp>("stub");
+
+    ASSERT_EQ(catalog.GetNumInstance(), 3u);
+    EXPECT_EQ(catalog.GetDescriptor(1).GetTypeString(), "MockInstance<1>");
+    EXPECT_EQ(catalog.MakeInstance(2)->GetTypeString(), "MockInstance<2>");
+
+    // OtherDeviceOp is added to a vector, it has no descriptors to record
+    DeviceOperationInstanceCatalog<OtherDeviceOp> others;
+    EXPECT_THROW(DeviceOperationPluginRegistry::Get().AddDescriptors("stub", others),
+                 std::runtime_error);
+}
+
+TEST(DeviceOperationPlugin, EmptyIfFamilyIsMissing)
+{
+    auto& registry = DeviceOperationPluginRegistry::Get();
+
+    ::testing::internal::CaptureStderr();
+    EXPECT_TRUE(GetDeviceOperationPluginInstances<MockDeviceOp>("missing").empty());
+    EXPECT_TRUE(GetDeviceOperationPluginInstances<MockDeviceOp>("missing").empty());
+    EXPECT_FALSE(registry.Load("missing"));
+    const auto errors = ::testing::internal::GetCapturedStderr();
+
+    EXPECT_FALSE(registry.IsLoaded("missing"));
+
+    // reported once, with the dlopen errors
+    const auto first = errors.find("cannot load libdevice_missing_plugin.so");
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_EQ(errors.find("cannot load", first + 1), std::string::npos);
+}
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+// op and instances shared by the test and the stub plugin, type names must match across both
+namespace device_operation_plugin_test {
+
+struct MockDeviceOp : public ck::tensor_operation::device::BaseOperator
+{
+};
+
+// a second op of the family, its instances must not show up for MockDeviceOp
+struct OtherDeviceOp : public ck::tensor_operation::device::BaseOperator
+{
+};
+
+template <typename DeviceOp, int Id>
+struct MockInstance : public DeviceOp
+{
+    std::string GetTypeString() const override
+    {
+        return "MockInstance<" + std::to_string(Id) + ">";
+    }
+};
+
+} // namespace device_operation_plugin_test
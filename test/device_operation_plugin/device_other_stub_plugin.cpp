@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <tuple>
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+#include "device_operation_plugin_stub.hpp"
+
+using ck::tensor_operation::device::instance::add_device_operation_instances;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationPluginRegistry;
+using device_operation_plugin_test::MockDeviceOp;
+using device_operation_plugin_test::MockInstance;
+
+// a second family with instances of the same DeviceOp as the stub family
+extern "C" void ck_device_operation_plugin_register(DeviceOperationPluginRegistry& registry)
+{
+    registry.Add<MockDeviceOp>(
+        "other_stub", [](DeviceOperationInstanceCatalog<MockDeviceOp>& catalog) {
+            add_device_operation_instances(catalog, std::tuple<MockInstance<MockDeviceOp, 4>>{});
+        });
+}
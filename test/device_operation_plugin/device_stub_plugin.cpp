@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_plugin.hpp"
+
+#include "device_operation_plugin_stub.hpp"
+
+using ck::tensor_operation::device::instance::add_device_operation_instances;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationPluginRegistry;
+using device_operation_plugin_test::MockDeviceOp;
+using device_operation_plugin_test::MockInstance;
+using device_operation_plugin_test::OtherDeviceOp;
+
+// MockDeviceOp records descriptors, OtherDeviceOp adds instances like a family that does not
+// take a catalog yet
+extern "C" void ck_device_operation_plugin_register(DeviceOperationPluginRegistry& registry)
+{
+    registry.Add<MockDeviceOp>("stub", [](DeviceOperationInstanceCatalog<MockDeviceOp>& catalog) {
+        add_device_operation_instances(
+            catalog, std::tuple<MockInstance<MockDeviceOp, 0>, MockInstance<MockDeviceOp, 1>>{});
+    });
+    registry.Add<MockDeviceOp>("stub", [](DeviceOperationInstanceCatalog<MockDeviceOp>& catalog) {
+        add_device_operation_instances(catalog, std::tuple<MockInstance<MockDeviceOp, 2>>{});
+    });
+    registry.Add<OtherDeviceOp>("stub", [](std::vector<std::unique_ptr<OtherDeviceOp>>& instances) {
+        add_device_operation_instances(instances, std::tuple<MockInstance<OtherDeviceOp, 3>>{});
+    });
+}
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/tensor_operation_instance/gemm_instance_ranking.hpp"
+
+using ck::tensor_operation::device::instance::GemmRankingProblem;
+using ck::tensor_operation::device::instance::ParseGemmTileDescription;
+using ck::tensor_operation::device::instance::RankGemmInstances;
+using ck::tensor_operation::device::instance::ScoreGemmInstance;
+
+namespace {
+
+// type strings as printed by the device operations
+const std::string CShuffle256x128 =
+    "DeviceGemm_Xdl_CShuffle<Default, 256, 256, 128, 32, 8, 8, 32, 32, 4, 2, 8, 8, 1, 1> "
+    "LoopScheduler: Default, PipelineVersion: v1";
+const std::string CShuffle64x64Padded =
+    "DeviceGemm_Xdl_CShuffle<MNKPadding, 64, 64, 64, 32, 8, 8, 32, 32, 2, 2, 8, 8, 1, 1> "
+    "LoopScheduler: Default, PipelineVersion: v1";
+const std::string MultipleD128x128 =
+    "DeviceGemmMultipleD_Xdl_CShuffle<256, 128, 128, 32, 8, 8, 32, 32, 2, 2, 8, 8, 1, 1, "
+    "MNPadding> LoopScheduler: Default, PipelineVersion: v1";
+const std::string Universal256x256 =
+    "DeviceGemmXdlUniversal<MNKPadding, RCR> BlkSize: 256, BlkTile: 256x256x32, WaveTile: 32x32, "
+    "WaveMap: 4x4, VmemReadVec: 8x8, BlkGemmPipelineScheduler: Intrawave, BlkGemmPipelineVersion: "
+    "v3, BlkGemmPipelinePrefetchStages: 2";
+const std::string Unknown = "DeviceGemmDl<256, 128, 128, 16, 2, 4, 4, 1>";
+
+GemmRankingProblem MakeProblem(ck::long_index_t M, ck::long_index_t N, ck::long_index_t K)
+{
+    GemmRankingProblem problem;
+    problem.M_ = M;
+    problem.N_ = N;
+    problem.K_ = K;
+    return problem;
+}
+
+struct MockDeviceOp : public ck::tensor_operation::device::BaseOperator
+{
+};
+
+struct MockInstance : public MockDeviceOp
+{
+    explicit MockInstance(std::string name) : name_(std::move(name)) {}
+
+    std::string GetTypeString() const override { return name_; }
+
+    std::string name_;
+};
+
+} // namespace
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <>
+struct DeviceOperationInstanceFactory<MockDeviceOp>
+{
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<MockDeviceOp>> op_ptrs;
+        for(const auto& name : {CShuffle64x64Padded, Unknown, CShuffle256x128, Universal256x256})
+            op_ptrs.push_back(std::make_unique<MockInstance>(name));
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+TEST(GemmInstanceRanking, ParseTypeStrings)
+{
+    const auto cshuffle = ParseGemmTileDescription(CShuffle256x128);
+    ASSERT_TRUE(cshuffle.has_value());
+    EXPECT_EQ(cshuffle->block_size_, 256);
+    EXPECT_EQ(cshuffle->m_per_block_, 256);
+    EXPECT_EQ(cshuffle->n_per_block_, 128);
+    EXPECT_EQ(cshuffle->k_per_block_, 32);
+    EXPECT_EQ(cshuffle->m_per_xdl_, 32);
+    EXPECT_EQ(cshuffle->m_xdl_per_wave_, 4);
+    EXPECT_EQ(cshuffle->n_xdl_per_wave_, 2);
+    EXPECT_FALSE(cshuffle->pad_m_ || cshuffle->pad_n_ || cshuffle->pad_k_);
+
+    const auto multiple_d = ParseGemmTileDescription(MultipleD128x128);
+    ASSERT_TRUE(multiple_d.has_value());
+    EXPECT_EQ(multiple_d->m_per_block_, 128);
+    EXPECT_TRUE(multiple_d->pad_m_ && multiple_d->pad_n_);
+    EXPECT_FALSE(multiple_d->pad_k_);
+
+    const auto universal = ParseGemmTileDescription(Universal256x256);
+    ASSERT_TRUE(universal.has_value());
+    EXPECT_EQ(universal->block_size_, 256);
+    EXPECT_EQ(universal->n_per_block_, 256);
+    EXPECT_EQ(universal->k_per_block_, 32);
+    EXPECT_EQ(universal->n_xdl_per_wave_, 4);
+    EXPECT_TRUE(universal->pad_k_);
+
+    EXPECT_FALSE(ParseGemmTileDescription(Unknown).has_value());
+    EXPECT_FALSE(ParseGemmTileDescription("DeviceGemm_Xdl_CShuffle<Default, 256>").has_value());
+}
+
+TEST(GemmInstanceRanking, ScoreFactors)
+{
+    const auto desc = *ParseGemmTileDescription(CShuffle256x128);
+
+    // 2 x 4 tiles fill 8 of 304 CUs
+    const auto small = ScoreGemmInstance(desc, MakeProblem(512, 512, 1024));
+    ASSERT_TRUE(small.applicable_);
+    EXPECT_DOUBLE_EQ(small.padding_efficiency_, 1.0);
+    EXPECT_DOUBLE_EQ(small.cu_efficiency_, 8.0 / 304);
+    EXPECT_DOUBLE_EQ(small.pipeline_efficiency_, 32.0 / 34);
+    EXPECT_GT(small.score_, 0);
+
+    // an unpadded instance cannot run a problem that is not a multiple of its tile
+    EXPECT_FALSE(ScoreGemmInstance(desc, MakeProblem(500, 512, 1024)).applicable_);
+
+    const auto padded = ScoreGemmInstance(*ParseGemmTileDescription(CShuffle64x64Padded),
+                                          MakeProblem(96, 64, 64));
+    ASSERT_TRUE(padded.applicable_);
+    EXPECT_DOUBLE_EQ(padded.padding_efficiency_, 96.0 / 128);
+}
+
+TEST(GemmInstanceRanking, PrefersTileThatFitsProblem)
+{
+    const std::vector<std::string> type_strings = {
+        CShuffle64x64Padded, CShuffle256x128, Universal256x256};
+
+    // large problems favour the large, high intensity tiles
+    const auto large = RankGemmInstances(type_strings, MakeProblem(8192, 8192, 8192), 0);
+    ASSERT_EQ(large.size(), 3u);
+    EXPECT_EQ(large.back(), 0u);
+
+    // a small problem cannot fill the CUs with large tiles
+    const auto small = RankGemmInstances(type_strings, MakeProblem(256, 256, 4096), 0);
+    ASSERT_EQ(small.size(), 3u);
+    EXPECT_EQ(small.front(), 0u);
+}
+
+TEST(GemmInstanceRanking, TopKKeepsUnknownInstances)
+{
+    const std::vector<std::string> type_strings = {
+        CShuffle64x64Padded, Unknown, CShuffle256x128, Universal256x256};
+
+    // 250 rows rule out the unpadded instance
+    const auto ids = RankGemmInstances(type_strings, MakeProblem(250, 8192, 8192), 1);
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_EQ(ids[1], 1u);
+
+    EXPECT_EQ(RankGemmInstances(type_strings, MakeProblem(8192, 8192, 8192), 0).size(), 4u);
+}
+
+TEST(GemmInstanceRanking, GetRankedInstances)
+{
+    using ck::tensor_operation::device::instance::GetRankedInstances;
+
+    const auto op_ptrs = GetRankedInstances<MockDeviceOp>(MakeProblem(8192, 8192, 8192), 2);
+    ASSERT_EQ(op_ptrs.size(), 3u);
+    EXPECT_NE(op_ptrs[0]->GetTypeString(), CShuffle64x64Padded);
+    EXPECT_EQ(op_ptrs[2]->GetTypeString(), Unknown);
+}
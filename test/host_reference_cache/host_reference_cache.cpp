@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/host_reference_cache.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::HostReferenceCache;
+using ck::utils::HostReferenceCacheKey;
+using ck::utils::RunCachedReference;
+
+namespace {
+
+struct ScaleOp
+{
+    float scale_;
+};
+
+// not trivially copyable, so its parameters cannot be hashed by bytes
+struct TableOp
+{
+    std::vector<float> table_;
+};
+
+Tensor<float> MakeInput(float offset)
+{
+    Tensor<float> x({7, 5}, {8, 1});
+    for(std::size_t i = 0; i < x.mData.size(); ++i)
+        x.mData[i] = offset + 0.5f * static_cast<float>(i);
+    return x;
+}
+
+class HostReferenceCacheTest : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        dir_ = ::testing::TempDir();
+        // files left behind by an earlier, aborted run must not hit
+        op_ = "negate" + std::to_string(std::random_device{}());
+    }
+
+    HostReferenceCacheKey Key() const { return HostReferenceCacheKey(op_); }
+
+    void TearDown() override
+    {
+        for(const auto& path : paths_)
+            std::remove(path.c_str());
+    }
+
+    // runs a fake reference that negates the input, counting how often it really computes
+    bool Run(const HostReferenceCache& cache,
+             const HostReferenceCacheKey& key,
+             const Tensor<float>& x,
+             Tensor<float>& y)
+    {
+        // the key RunCachedReference looks up
+        auto full_key = key;
+        paths_.push_back(cache.GetPath(full_key.AddType<float>().AddDescriptor(y.mDesc)));
+
+        return RunCachedReference(cache, key, y, [&] {
+            ++num_compute_;
+            y.ForEach([&](auto& self, auto idx) { self(idx) = -x(idx); });
+        });
+    }
+
+    std::string dir_;
+    std::string op_;
+    std::vector<std::string> paths_;
+    int num_compute_ = 0;
+};
+
+} // namespace
+
+TEST_F(HostReferenceCacheTest, ComputesOnceThenLoads)
+{
+    const HostReferenceCache cache(dir_);
+    const auto x   = MakeInput(1.f);
+    const auto key = Key().AddTensor(x).AddElementOp(ScaleOp{2.f});
+
+    Tensor<float> y0({7, 5}, {8, 1});
+    EXPECT_FALSE(Run(cache, key, x, y0));
+
+    Tensor<float> y1({7, 5}, {8, 1});
+    EXPECT_TRUE(Run(cache, key, x, y1));
+
+    EXPECT_EQ(num_compute_, 1);
+    EXPECT_EQ(y0.mData, y1.mData);
+}
+
+TEST_F(HostReferenceCacheTest, KeyCoversContentsAndParameters)
+{
+    const HostReferenceCache cache(dir_);
+    const auto x = MakeInput(1.f);
+
+    Tensor<float> y({7, 5}, {8, 1});
+    Run(cache, Key().AddTensor(x).AddElementOp(ScaleOp{2.f}), x, y);
+
+    // other input values, element-op parameters or output strides are misses
+    const auto x2 = MakeInput(3.f);
+    Run(cache, Key().AddTensor(x2).AddElementOp(ScaleOp{2.f}), x2, y);
+    EXPECT_EQ(y.mData[0], -3.f);
+
+    Run(cache, Key().AddTensor(x).AddElementOp(ScaleOp{4.f}), x, y);
+
+    Tensor<float> y_col({7, 5}, {1, 7});
+    Run(cache, Key().AddTensor(x).AddElementOp(ScaleOp{2.f}), x, y_col);
+
+    EXPECT_EQ(num_compute_, 4);
+}
+
+TEST_F(HostReferenceCacheTest, CorruptFileIsRecomputed)
+{
+    const HostReferenceCache cache(dir_);
+    const auto x   = MakeInput(1.f);
+    const auto key = Key().AddTensor(x);
+
+    Tensor<float> y({7, 5}, {8, 1});
+    Run(cache, key, x, y);
+
+    // truncate the cached file
+    std::ofstream(paths_.back(), std::ios::trunc) << "CKREF001";
+
+    EXPECT_FALSE(Run(cache, key, x, y));
+    EXPECT_EQ(num_compute_, 2);
+    EXPECT_EQ(y.mData[1], -1.5f);
+
+    // and the recomputed result was stored again
+    EXPECT_TRUE(Run(cache, key, x, y));
+}
+
+TEST_F(HostReferenceCacheTest, DisabledWithoutDirectory)
+{
+    const HostReferenceCache cache("");
+    const auto x   = MakeInput(1.f);
+    const auto key = Key().AddTensor(x);
+
+    EXPECT_FALSE(cache.IsEnabled());
+
+    Tensor<float> y({7, 5}, {8, 1});
+    EXPECT_FALSE(Run(cache, key, x, y));
+    EXPECT_FALSE(Run(cache, key, x, y));
+    EXPECT_EQ(num_compute_, 2);
+}
+
+TEST_F(HostReferenceCacheTest, KeyCoversComputeTypes)
+{
+    const auto x = MakeInput(1.f);
+
+    const auto f32 = Key().AddComputeTypes<float>().AddTensor(x);
+    const auto f64 = Key().AddComputeTypes<double>().AddTensor(x);
+    const auto mix = Key().AddComputeTypes<float, double>().AddTensor(x);
+
+    EXPECT_NE(f32.GetString(), f64.GetString());
+    EXPECT_NE(f32.GetString(), mix.GetString());
+    EXPECT_NE(f64.GetString(), mix.GetString());
+}
+
+TEST_F(HostReferenceCacheTest, StatefulElementOpIsNotCached)
+{
+    const HostReferenceCache cache(dir_);
+    const auto x = MakeInput(1.f);
+
+    const auto key = Key().AddTensor(x).AddElementOp(TableOp{{1.f, 2.f}});
+    EXPECT_FALSE(key.IsCacheable());
+
+    Tensor<float> y({7, 5}, {8, 1});
+    EXPECT_FALSE(Run(cache, key, x, y));
+    EXPECT_FALSE(Run(cache, key, x, y));
+    EXPECT_EQ(num_compute_, 2);
+
+    // with an explicit hash of its parameters it is cached again
+    const auto hashed_key = Key().AddTensor(x).AddElementOp(TableOp{{1.f, 2.f}}, 12);
+    EXPECT_TRUE(hashed_key.IsCacheable());
+    EXPECT_FALSE(Run(cache, hashed_key, x, y));
+    EXPECT_TRUE(Run(cache, hashed_key, x, y));
+    EXPECT_EQ(num_compute_, 3);
+}
+
+TEST_F(HostReferenceCacheTest, EmptyTensorKey)
+{
+    const HostReferenceCache cache(dir_);
+    const Tensor<float> x(std::vector<std::size_t>{0});
+
+    Tensor<float> y(std::vector<std::size_t>{0});
+    EXPECT_FALSE(Run(cache, Key().AddTensor(x), x, y));
+    EXPECT_TRUE(Run(cache, Key().AddTensor(x), x, y));
+    EXPECT_EQ(num_compute_, 1);
+}
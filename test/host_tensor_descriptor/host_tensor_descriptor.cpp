@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+TEST(HostTensorDescriptorN, PackedOffsets)
+{
+    const HostTensorDescriptorN<3> desc({2, 3, 4});
+    const HostTensorDescriptor runtime_desc({2, 3, 4});
+
+    EXPECT_TRUE(desc.IsPacked());
+    EXPECT_EQ(desc.GetStrides(), (std::array<std::size_t, 3>{12, 4, 1}));
+    EXPECT_EQ(desc.GetElementSize(), 24u);
+    EXPECT_EQ(desc.GetElementSpaceSize(), 24u);
+
+    // a packed descriptor maps the row-major linear index to itself
+    auto indices = desc.GetMultiIndexFromLinearIndex(0);
+    for(std::size_t i = 0; i < desc.GetElementSize(); ++i)
+    {
+        EXPECT_EQ(desc.GetMultiIndexFromLinearIndex(i), indices);
+        EXPECT_EQ(desc.GetOffsetFromMultiIndex(indices), i);
+        EXPECT_EQ(desc.GetOffsetFromMultiIndex(indices[0], indices[1], indices[2]),
+                  runtime_desc.GetOffsetFromMultiIndex(indices[0], indices[1], indices[2]));
+        desc.MoveToNextMultiIndex(indices);
+    }
+    EXPECT_EQ(indices, (std::array<std::size_t, 3>{0, 0, 0}));
+
+    // strides that only differ in dimensions of length 1 are still packed
+    EXPECT_TRUE(HostTensorDescriptorN<3>({2, 1, 4}, {4, 7, 1}).IsPacked());
+}
+
+TEST(HostTensorDescriptorN, StridedOffsets)
+{
+    // column-major [4, 5] with a padded leading dimension of 8
+    const HostTensorDescriptorN<2> desc({4, 5}, {1, 8});
+    const HostTensorDescriptor runtime_desc({4, 5}, {1, 8});
+
+    EXPECT_FALSE(desc.IsPacked());
+    EXPECT_EQ(desc.GetElementSize(), 20u);
+    EXPECT_EQ(desc.GetElementSpaceSize(), runtime_desc.GetElementSpaceSize());
+    EXPECT_EQ(desc.GetOffsetFromMultiIndex(3, 2), 19u);
+    EXPECT_EQ(desc.GetOffsetFromMultiIndex(std::vector<std::size_t>{3, 2}), 19u);
+
+    for(std::size_t i = 0; i < 4; ++i)
+        for(std::size_t j = 0; j < 5; ++j)
+            EXPECT_EQ(desc.GetOffsetFromMultiIndex(i, j),
+                      runtime_desc.GetOffsetFromMultiIndex(i, j));
+
+    // broadcast dimension
+    const HostTensorDescriptorN<3> broadcast({2, 3, 4}, {4, 0, 1});
+    EXPECT_FALSE(broadcast.IsPacked());
+    EXPECT_EQ(broadcast.GetOffsetFromMultiIndex(1, 2, 3), 7u);
+    EXPECT_EQ(broadcast.GetElementSpaceSize(), 8u);
+
+    // round trip through the runtime-rank descriptor
+    const HostTensorDescriptorN<2> copy(static_cast<HostTensorDescriptor>(desc));
+    EXPECT_EQ(copy.GetLengths(), desc.GetLengths());
+    EXPECT_EQ(copy.GetStrides(), desc.GetStrides());
+    EXPECT_FALSE(copy.IsPacked());
+}
+
+TEST(HostTensorDescriptorN, RankMismatchThrows)
+{
+    EXPECT_THROW(HostTensorDescriptorN<2>({2, 3, 4}), std::runtime_error);
+    EXPECT_THROW(HostTensorDescriptorN<2>(HostTensorDescriptor({2, 3, 4})), std::runtime_error);
+}
+
+TEST(HostTensorDescriptorN, TensorMatchesRuntimeRank)
+{
+    // the digits of the value are the indices
+    const auto g = [](auto... is) {
+        float value = 0;
+        ((value = value * 10 + static_cast<float>(is)), ...);
+        return value;
+    };
+    const std::vector<std::size_t> lengths{2, 3, 4};
+
+    for(const auto& strides : {std::vector<std::size_t>{12, 4, 1}, {1, 2, 6}})
+    {
+        Tensor<float> runtime_tensor(lengths, strides);
+        Tensor<float, HostTensorDescriptorN<3>> tensor(lengths, strides);
+
+        runtime_tensor.GenerateTensorValue(g, 2);
+        tensor.GenerateTensorValue(g, 2);
+
+        EXPECT_EQ(tensor.mData, runtime_tensor.mData);
+        EXPECT_EQ(tensor(1, 2, 3), 123.f);
+
+        // switching the descriptor keeps the data
+        const Tensor<float> converted(tensor);
+        EXPECT_EQ(converted.mData, tensor.mData);
+        EXPECT_EQ(converted.GetStrides(), runtime_tensor.GetStrides());
+    }
+}
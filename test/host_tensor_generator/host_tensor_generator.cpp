@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_philox.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using ck::utils::Philox4x32;
+
+namespace {
+
+std::vector<float> GenerateUniform(std::size_t first, std::size_t n, std::uint64_t stream)
+{
+    std::vector<float> values(n);
+    ck::utils::PhiloxGenerate<float>(
+        values.data(), first, n, 42, stream, [](float u) { return u; });
+    return values;
+}
+
+} // namespace
+
+TEST(HostTensorGenerator, PhiloxKnownAnswer)
+{
+    std::uint32_t bits[Philox4x32::NumValuePerBlock];
+
+    Philox4x32::GenerateBlock(0, 0, 0, bits);
+    EXPECT_EQ(bits[0], 0x6627e8d5u);
+    EXPECT_EQ(bits[1], 0xe169c58du);
+    EXPECT_EQ(bits[2], 0xbc57ac4cu);
+    EXPECT_EQ(bits[3], 0x9b00dbd8u);
+
+    Philox4x32::GenerateBlock(
+        0x299f31d0a4093822ull, 0x0370734413198a2eull, 0x85a308d3243f6a88ull, bits);
+    EXPECT_EQ(bits[0], 0xd16cfe09u);
+    EXPECT_EQ(bits[1], 0x94fdccebu);
+    EXPECT_EQ(bits[2], 0x5001e420u);
+    EXPECT_EQ(bits[3], 0x24126ea1u);
+}
+
+TEST(HostTensorGenerator, ValuesDependOnlyOnPosition)
+{
+    constexpr std::size_t N = 1000;
+
+    const auto all = GenerateUniform(0, N, 7);
+
+    // unaligned pieces give the same values as one call
+    for(std::size_t first : {1u, 63u, 64u, 65u, 333u})
+    {
+        const auto piece = GenerateUniform(first, N - first, 7);
+        for(std::size_t i = 0; i < piece.size(); ++i)
+            ASSERT_EQ(piece[i], all[first + i]) << "first " << first << " index " << i;
+    }
+
+    std::vector<float> parallel(N);
+    ck::utils::ParallelPhiloxGenerate<float>(
+        parallel.begin(), N, 42, 7, [](float u) { return u; });
+    EXPECT_EQ(parallel, all);
+
+    EXPECT_NE(GenerateUniform(0, N, 8), all);
+
+    for(float u : all)
+    {
+        EXPECT_GE(u, 0.f);
+        EXPECT_LT(u, 1.f);
+    }
+}
+
+TEST(HostTensorGenerator, FillUniformDistribution)
+{
+    std::vector<float> x(5000);
+    ck::utils::FillUniformDistribution<float>{-2.f, 3.f}(x);
+
+    for(float v : x)
+    {
+        EXPECT_GE(v, -2.f);
+        EXPECT_LE(v, 3.f);
+    }
+
+    // same seed, same values, also through forward iterators
+    std::list<float> y(x.size());
+    ck::utils::FillUniformDistribution<float>{-2.f, 3.f}(y);
+    EXPECT_EQ(std::vector<float>(y.begin(), y.end()), x);
+
+    std::vector<float> z(x.size());
+    ck::utils::FillUniformDistribution<float>{-2.f, 3.f, 1}(z);
+    EXPECT_NE(z, x);
+
+    std::vector<int> w(x.size());
+    ck::utils::FillUniformDistributionIntegerValue<int>{-3.f, 3.f}(w);
+    const std::set<int> w_values(w.begin(), w.end());
+    EXPECT_EQ(w_values, (std::set<int>{-3, -2, -1, 0, 1, 2, 3}));
+}
+
+TEST(HostTensorGenerator, GeneratorTensor2Range)
+{
+    Tensor<int8_t> x({64, 100});
+    x.GenerateTensorValue(GeneratorTensor_2<int8_t>{-5, 5});
+
+    const std::set<int> values(x.mData.begin(), x.mData.end());
+    EXPECT_EQ(values, (std::set<int>{-5, -4, -3, -2, -1, 0, 1, 2, 3, 4}));
+}
+
+TEST(HostTensorGenerator, GeneratorTensor3Strided)
+{
+    const GeneratorTensor_3<float> g{-1.f, 1.f};
+
+    Tensor<float> a({37, 53});
+    a.GenerateTensorValue(g);
+
+    Tensor<float> b({37, 53});
+    b.GenerateTensorValue(g);
+    EXPECT_NE(a.mData, b.mData);
+
+    // a column-major tensor holds the values of its row-major order at transposed offsets
+    Tensor<float> c({37, 53}, {1, 37});
+    const auto stream = ck::utils::NextPhiloxStream() + 1;
+    c.GenerateTensorValue(g, 4);
+
+    std::vector<float> expected(37 * 53);
+    GenerateTensorBulk(g, expected.data(), 0, expected.size(), stream);
+
+    for(std::size_t i = 0; i < 37; ++i)
+    {
+        for(std::size_t j = 0; j < 53; ++j)
+        {
+            ASSERT_EQ(c(i, j), expected[i * 53 + j]);
+            EXPECT_GE(c(i, j), -1.f);
+            EXPECT_LT(c(i, j), 1.f);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+using ck::utils::HostThreadPool;
+
+namespace {
+
+constexpr std::size_t NumThread = 4;
+
+// runs a ParallelFor over [0, n), checks every index is visited once and returns the number of
+// sub-ranges f was called with, which is 1 when the call ran serially
+std::size_t count_sub_ranges(HostThreadPool& pool, std::size_t n)
+{
+    std::vector<std::atomic<int>> visits(n);
+    std::atomic<std::size_t> num_sub_range{0};
+
+    pool.ParallelFor(n, NumThread, [&](std::size_t begin, std::size_t end) {
+        ++num_sub_range;
+        for(std::size_t i = begin; i < end; ++i)
+            ++visits[i];
+    });
+
+    for(std::size_t i = 0; i < n; ++i)
+        EXPECT_EQ(visits[i].load(), 1) << "index " << i;
+
+    return num_sub_range.load();
+}
+
+} // anonymous namespace
+
+TEST(HostThreadPool, CoversRange)
+{
+    HostThreadPool pool(NumThread);
+
+    EXPECT_GT(count_sub_ranges(pool, 1000), 1u);
+    EXPECT_EQ(count_sub_ranges(pool, 1), 1u);
+    EXPECT_EQ(count_sub_ranges(pool, 0), 0u);
+}
+
+TEST(HostThreadPool, NestedCallsRunSerially)
+{
+    HostThreadPool pool(NumThread);
+
+    std::atomic<int> num_nested_sub_range{0};
+    std::atomic<int> num_wrong_thread{0};
+
+    pool.ParallelFor(64, NumThread, [&](std::size_t, std::size_t) {
+        const auto id = std::this_thread::get_id();
+        pool.ParallelFor(16, NumThread, [&](std::size_t begin, std::size_t end) {
+            ++num_nested_sub_range;
+            if(begin != 0 || end != 16 || std::this_thread::get_id() != id)
+                ++num_wrong_thread;
+        });
+    });
+
+    EXPECT_EQ(num_nested_sub_range.load(), 64);
+    EXPECT_EQ(num_wrong_thread.load(), 0);
+
+    // leaving the nested region must not leave the calling thread marked as inside one
+    EXPECT_GT(count_sub_ranges(pool, 1000), 1u);
+}
+
+TEST(HostThreadPool, RethrowsOnCallingThread)
+{
+    HostThreadPool pool(NumThread);
+
+    EXPECT_THROW(pool.ParallelFor(64,
+                                  NumThread,
+                                  [&](std::size_t begin, std::size_t) {
+                                      if(begin == 5)
+                                          throw std::runtime_error("chunk 5");
+                                  }),
+                 std::runtime_error);
+
+    // the pool is still usable in parallel from the same thread
+    EXPECT_GT(count_sub_ranges(pool, 1000), 1u);
+}
+
+TEST(HostThreadPool, RethrowsWorkerException)
+{
+    HostThreadPool pool(NumThread);
+
+    const auto caller = std::this_thread::get_id();
+
+    // the calling thread is slow, so the workers are guaranteed to pick up some chunks
+    EXPECT_THROW(pool.ParallelFor(64,
+                                  NumThread,
+                                  [&](std::size_t, std::size_t) {
+                                      if(std::this_thread::get_id() != caller)
+                                          throw std::runtime_error("worker");
+                                      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                  }),
+                 std::runtime_error);
+
+    EXPECT_GT(count_sub_ranges(pool, 1000), 1u);
+}
+
+TEST(HostThreadPool, ConcurrentSubmitters)
+{
+    HostThreadPool pool(NumThread);
+
+    constexpr std::size_t NumSubmitter = 4;
+    std::vector<std::thread> submitters;
+
+    for(std::size_t s = 0; s < NumSubmitter; ++s)
+        submitters.emplace_back([&pool] {
+            for(int iter = 0; iter < 50; ++iter)
+                count_sub_ranges(pool, 257);
+        });
+
+    for(auto& t : submitters)
+        t.join();
+}
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_type_convert.hpp"
+
+using ck::bf8_t;
+using ck::bhalf_t;
+using ck::f8_t;
+using ck::half_t;
+using ck::utils::bulk_type_convert;
+using ck::utils::ConvertRounding;
+using ck::utils::detail::scalar_type_convert;
+
+namespace {
+
+template <typename T, typename Bits>
+T FromBits(Bits bits)
+{
+    static_assert(sizeof(T) == sizeof(Bits));
+    T x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+template <typename T>
+std::uint32_t ToBits(T x)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &x, sizeof(x));
+    return bits;
+}
+
+// every bit pattern of a 8 or 16 bit type
+template <typename T>
+std::vector<T> AllValues()
+{
+    using Bits = std::conditional_t<sizeof(T) == 1, std::uint8_t, std::uint16_t>;
+
+    std::vector<T> values;
+    for(std::uint32_t i = 0; i < (1u << (8 * sizeof(T))); ++i)
+        values.push_back(FromBits<T>(static_cast<Bits>(i)));
+    return values;
+}
+
+// random bit patterns, among them NaN, Inf, denormals and ties of every rounding
+std::vector<float> SomeFloats(std::size_t n)
+{
+    std::mt19937 gen(2024);
+    std::uniform_int_distribution<std::uint32_t> dist;
+
+    std::vector<float> values;
+    for(std::uint32_t special : {0x00000000u, 0x80000000u, 0x7f800000u, 0xff800000u, 0x7fc00000u,
+                                 0x7f800001u, 0x7f808000u, 0xff800100u, 0x00000001u, 0x807fffffu,
+                                 0x3f808000u, 0x3f818000u, 0x7f7fffffu, 0x43700000u, 0x43780000u})
+        values.push_back(FromBits<float>(special));
+
+    while(values.size() < n)
+    {
+        const std::uint32_t bits = dist(gen);
+        // keep the low bits of every fourth value, the rest only have bits that bf16 keeps or
+        // sit exactly on a tie
+        switch(values.size() % 4)
+        {
+        case 0: values.push_back(FromBits<float>(bits)); break;
+        case 1: values.push_back(FromBits<float>(bits & 0xffff0000u)); break;
+        case 2: values.push_back(FromBits<float>((bits & 0xffff0000u) | 0x8000u)); break;
+        default: values.push_back(FromBits<float>((bits & 0x7fffffffu) >> 4)); break;
+        }
+    }
+    return values;
+}
+
+template <typename Dst, typename Src>
+void ExpectSameAsScalar(const std::vector<Src>& src, ConvertRounding rounding)
+{
+    std::vector<Dst> dst(src.size());
+    bulk_type_convert<Dst, Src>(src, ck::span<Dst>(dst.data(), dst.size()), rounding);
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        const auto expected = scalar_type_convert<Dst>(src[i], rounding, i);
+        ASSERT_EQ(ToBits(dst[i]), ToBits(expected))
+            << "element " << i << ", source bits 0x" << std::hex << ToBits(src[i]);
+    }
+}
+
+} // namespace
+
+TEST(HostTypeConvert, F8DecodeMatchesTypeConvert)
+{
+    ExpectSameAsScalar<float>(AllValues<f8_t>(), ConvertRounding::Default);
+    ExpectSameAsScalar<half_t>(AllValues<f8_t>(), ConvertRounding::Default);
+    ExpectSameAsScalar<float>(AllValues<bf8_t>(), ConvertRounding::Default);
+    ExpectSameAsScalar<half_t>(AllValues<bf8_t>(), ConvertRounding::Default);
+
+    const auto codes = AllValues<f8_t>();
+    std::vector<float> decoded(codes.size());
+    bulk_type_convert<float, f8_t>(codes, ck::span<float>(decoded.data(), decoded.size()));
+    for(std::size_t i = 0; i < codes.size(); ++i)
+        EXPECT_EQ(ToBits(decoded[i]), ToBits(ck::type_convert<float>(codes[i])));
+}
+
+TEST(HostTypeConvert, HalfFloatMatchesTypeConvert)
+{
+    ExpectSameAsScalar<float>(AllValues<half_t>(), ConvertRounding::Default);
+    ExpectSameAsScalar<half_t>(SomeFloats(1 << 16), ConvertRounding::Default);
+
+    // every half is exact in float and comes back unchanged, except NaN which is made quiet
+    const auto halves = AllValues<half_t>();
+    std::vector<float> floats(halves.size());
+    std::vector<half_t> back(halves.size());
+    bulk_type_convert<float, half_t>(halves, ck::span<float>(floats.data(), floats.size()));
+    bulk_type_convert<half_t, float>(floats, ck::span<half_t>(back.data(), back.size()));
+    for(std::size_t i = 0; i < halves.size(); ++i)
+    {
+        if((i & 0x7c00) != 0x7c00 || (i & 0x3ff) == 0)
+        {
+            EXPECT_EQ(ToBits(back[i]), i);
+        }
+    }
+}
+
+TEST(HostTypeConvert, BhalfRoundingMatchesScalar)
+{
+    const auto floats = SomeFloats(1 << 16);
+    for(auto rounding :
+        {ConvertRounding::Default, ConvertRounding::NearestEven, ConvertRounding::Stochastic})
+    {
+        ExpectSameAsScalar<bhalf_t>(floats, rounding);
+        ExpectSameAsScalar<bhalf_t>(AllValues<half_t>(), rounding);
+    }
+
+    // the scalar paths are the ones of type_convert and bf16_convert_rtn
+    for(float x : floats)
+    {
+        EXPECT_EQ(scalar_type_convert<bhalf_t>(x, ConvertRounding::Default, 0),
+                  ck::type_convert<bhalf_t>(x));
+        EXPECT_EQ(scalar_type_convert<bhalf_t>(x, ConvertRounding::NearestEven, 0),
+                  ck::bf16_convert_rtn<bhalf_t>(x));
+    }
+}
+
+#if CK_HOST_TYPE_CONVERT_X86
+TEST(HostTypeConvert, BhalfKernelsOfEveryIsaMatchScalar)
+{
+    const auto& isa               = ck::utils::detail::HostConvertIsa::Get();
+    const auto floats             = SomeFloats(4099);
+    const std::size_t first_index = 123456789;
+
+    for(auto rounding :
+        {ConvertRounding::Default, ConvertRounding::NearestEven, ConvertRounding::Stochastic})
+    {
+        std::vector<bhalf_t> expected(floats.size());
+        for(std::size_t i = 0; i < floats.size(); ++i)
+            expected[i] = scalar_type_convert<bhalf_t>(floats[i], rounding, first_index + i);
+
+        std::vector<bhalf_t> dst(floats.size());
+        if(isa.avx2_f16c_)
+        {
+            ck::utils::detail::convert_float_to_bhalf_avx2(
+                floats.data(), dst.data(), dst.size(), first_index, rounding);
+            EXPECT_EQ(dst, expected);
+        }
+        if(isa.avx512f_)
+        {
+            ck::utils::detail::convert_float_to_bhalf_avx512(
+                floats.data(), dst.data(), dst.size(), first_index, rounding);
+            EXPECT_EQ(dst, expected);
+        }
+    }
+}
+#endif
+
+TEST(HostTypeConvert, F8EncodeMatchesScalar)
+{
+    const auto floats = SomeFloats(1 << 14);
+    const auto halves = AllValues<half_t>();
+    for(auto rounding :
+        {ConvertRounding::Default, ConvertRounding::NearestEven, ConvertRounding::Stochastic})
+    {
+        ExpectSameAsScalar<f8_t>(floats, rounding);
+        ExpectSameAsScalar<bf8_t>(floats, rounding);
+        ExpectSameAsScalar<f8_t>(halves, rounding);
+        ExpectSameAsScalar<bf8_t>(halves, rounding);
+    }
+
+    for(float x : floats)
+    {
+        EXPECT_EQ(scalar_type_convert<f8_t>(x, ConvertRounding::NearestEven, 0),
+                  ck::f8_convert_rne<f8_t>(x));
+        EXPECT_EQ(scalar_type_convert<bf8_t>(x, ConvertRounding::NearestEven, 0),
+                  ck::f8_convert_rne<bf8_t>(x));
+    }
+}
+
+TEST(HostTypeConvert, StochasticRoundingDoesNotDependOnThreading)
+{
+    // large enough to be split across the thread pool
+    const auto floats = SomeFloats((1 << 20) + 5);
+
+    std::vector<bhalf_t> bulk(floats.size());
+    bulk_type_convert<bhalf_t, float>(
+        floats, ck::span<bhalf_t>(bulk.data(), bulk.size()), ConvertRounding::Stochastic);
+
+    std::vector<f8_t> bulk_f8(floats.size());
+    bulk_type_convert<f8_t, float>(
+        floats, ck::span<f8_t>(bulk_f8.data(), bulk_f8.size()), ConvertRounding::Stochastic);
+
+    for(std::size_t i = 0; i < floats.size(); ++i)
+    {
+        ASSERT_EQ(bulk[i], scalar_type_convert<bhalf_t>(floats[i], ConvertRounding::Stochastic, i));
+        ASSERT_EQ(ToBits(bulk_f8[i]),
+                  ToBits(scalar_type_convert<f8_t>(floats[i], ConvertRounding::Stochastic, i)));
+    }
+}
+
+TEST(HostTypeConvert, StochasticRoundingIsUnbiased)
+{
+    // 1 + 2^-9 sits a quarter of the way between two bf16 values
+    const std::vector<float> src(1 << 16, 1.0f + 1.0f / 512);
+    std::vector<bhalf_t> dst(src.size());
+    bulk_type_convert<bhalf_t, float>(
+        src, ck::span<bhalf_t>(dst.data(), dst.size()), ConvertRounding::Stochastic);
+
+    double sum = 0;
+    for(auto x : dst)
+        sum += ck::type_convert<float>(x);
+    EXPECT_NEAR(sum / dst.size(), 1.0 + 1.0 / 512, 1e-4);
+}
+
+TEST(HostTypeConvert, ThrowsOnSizeMismatch)
+{
+    const std::vector<float> src(8);
+    std::vector<half_t> dst(7);
+    EXPECT_THROW((bulk_type_convert<half_t, float>(src, ck::span<half_t>(dst.data(), dst.size()))),
+                 std::runtime_error);
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+// runs the blocked and the naive path of a batched reference and checks they agree bit for bit
+template <typename ReferenceBatchedGemm, typename ADataType, typename BDataType, typename CDataType>
+void check_batched_gemm(const HostTensorDescriptor& a_desc,
+                        const HostTensorDescriptor& b_desc,
+                        const HostTensorDescriptor& c_desc,
+                        Scale c_element_op)
+{
+    static_assert(ReferenceBatchedGemm::UseBlockedGemm);
+
+    Tensor<ADataType> a(a_desc);
+    Tensor<BDataType> b(b_desc);
+    Tensor<CDataType> c(c_desc);
+    Tensor<CDataType> c_ref(c_desc);
+
+    ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a);
+    ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b);
+
+    auto argument =
+        ReferenceBatchedGemm::MakeArgument(a, b, c, PassThrough{}, PassThrough{}, c_element_op);
+    auto ref_argument =
+        ReferenceBatchedGemm::MakeArgument(a, b, c_ref, PassThrough{}, PassThrough{}, c_element_op);
+
+    ReferenceBatchedGemm::MakeInvoker().Run(argument);
+    ReferenceBatchedGemm::Invoker::RunNaive(ref_argument);
+
+    EXPECT_TRUE(ck::utils::check_err(c, c_ref, "Error: incorrect results!", 0, 0));
+}
+
+} // anonymous namespace
+
+TEST(ReferenceBatchedGemm, BlockedMatchesLoop)
+{
+    using ReferenceBatchedGemm =
+        ck::tensor_operation::host::ReferenceBatchedGemm<ck::half_t,
+                                                         ck::half_t,
+                                                         ck::half_t,
+                                                         float,
+                                                         PassThrough,
+                                                         PassThrough,
+                                                         Scale>;
+
+    const std::size_t G = 5, M = 37, N = 70, K = 129;
+
+    // row-major A and C, column-major B with a padded leading dimension
+    check_batched_gemm<ReferenceBatchedGemm, ck::half_t, ck::half_t, ck::half_t>(
+        HostTensorDescriptor({G, M, K}),
+        HostTensorDescriptor({G, K, N}, {N * (K + 3), std::size_t{1}, K + 3}),
+        HostTensorDescriptor({G, M, N}),
+        Scale{0.5f});
+}
+
+TEST(ReferenceBatchedGemm, MultiQueryBlockedMatchesLoop)
+{
+    using ReferenceBatchedGemm = ck::tensor_operation::host::
+        ReferenceBatchedGemm_MQA<float, float, float, float, PassThrough, PassThrough, Scale>;
+
+    const std::size_t G0 = 2, G1 = 6, M = 19, N = 33, K = 64;
+
+    check_batched_gemm<ReferenceBatchedGemm, float, float, float>(
+        HostTensorDescriptor({G0, G1, M, K}),
+        HostTensorDescriptor({G0, std::size_t{1}, K, N}),
+        HostTensorDescriptor({G0, G1, M, N}, {M * G1 * N, N, G1 * N, std::size_t{1}}),
+        Scale{1.f});
+}
+
+TEST(ReferenceBatchedGemm, GroupedQueryBlockedMatchesLoop)
+{
+    constexpr ck::index_t QueryGroupNumber = 3;
+
+    using ReferenceBatchedGemm =
+        ck::tensor_operation::host::ReferenceBatchedGemm_GQA<float,
+                                                             float,
+                                                             float,
+                                                             float,
+                                                             PassThrough,
+                                                             PassThrough,
+                                                             Scale,
+                                                             QueryGroupNumber>;
+
+    const std::size_t G0 = 2, G1 = 12, M = 25, N = 40, K = 48;
+
+    check_batched_gemm<ReferenceBatchedGemm, float, float, float>(
+        HostTensorDescriptor({G0, G1, M, K}),
+        HostTensorDescriptor({G0, std::size_t{QueryGroupNumber}, K, N}),
+        HostTensorDescriptor({G0, G1, M, N}),
+        Scale{2.f});
+}
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_blocked_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_contraction.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// strides of a tensor whose dims [0, outer_end) are padded by `padding` elements on top of the
+// packed size of the inner dims
+std::vector<std::size_t> padded_strides(const std::vector<std::size_t>& lengths,
+                                        std::size_t outer_end,
+                                        std::size_t padding)
+{
+    std::vector<std::size_t> strides(lengths.size());
+    std::size_t stride = 1;
+
+    for(std::size_t i = lengths.size(); i-- > 0;)
+    {
+        if(i + 1 == outer_end)
+            stride += padding;
+
+        strides[i] = stride;
+        stride *= lengths[i];
+    }
+    return strides;
+}
+
+template <typename T>
+std::vector<T> concat(std::vector<T> a, const std::vector<T>& b)
+{
+    a.insert(a.end(), b.begin(), b.end());
+    return a;
+}
+
+// runs the reference on the given A[ms, ks], B[ns, ks] and C[ms, ns] layouts and checks it against
+// the loop nest, returns whether the dimensions folded into a GEMM
+template <ck::index_t NumDim, typename ADataType, typename CDataType>
+bool check_contraction(const HostTensorDescriptor& a_desc,
+                       const HostTensorDescriptor& b_desc,
+                       const HostTensorDescriptor& c_desc)
+{
+    using ReferenceContraction =
+        ck::tensor_operation::host::ReferenceContraction_M2_N2_K2<NumDim,
+                                                                  NumDim,
+                                                                  NumDim,
+                                                                  ADataType,
+                                                                  ADataType,
+                                                                  CDataType,
+                                                                  float,
+                                                                  ADataType,
+                                                                  PassThrough,
+                                                                  PassThrough>;
+    static_assert(ReferenceContraction::UseBlockedGemm);
+
+    Tensor<ADataType> a_ms_ks(a_desc);
+    Tensor<ADataType> b_ns_ks(b_desc);
+    Tensor<CDataType> c_ms_ns(c_desc);
+    Tensor<CDataType> c_ms_ns_ref(c_desc);
+
+    ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a_ms_ks);
+    ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(b_ns_ks);
+
+    auto argument =
+        ReferenceContraction::MakeArgument(a_ms_ks, b_ns_ks, c_ms_ns, PassThrough{}, PassThrough{});
+    auto ref_argument = ReferenceContraction::MakeArgument(
+        a_ms_ks, b_ns_ks, c_ms_ns_ref, PassThrough{}, PassThrough{});
+
+    const bool folded = ReferenceContraction::Invoker::RunFolded(argument);
+    if(!folded)
+        ReferenceContraction::MakeInvoker().Run(argument);
+    ReferenceContraction::Invoker::RunNaive(ref_argument);
+
+    EXPECT_TRUE(ck::utils::check_err(c_ms_ns, c_ms_ns_ref, "Error: incorrect results!", 0, 0));
+    return folded;
+}
+
+} // anonymous namespace
+
+TEST(ReferenceContraction, FoldsPackedDimensions)
+{
+    const std::vector<std::size_t> ms{13, 7}, ns{11, 9}, ks{6, 45};
+
+    EXPECT_TRUE((check_contraction<2, float, float>(
+        concat(ms, ks), concat(ns, ks), concat(ms, ns))));
+}
+
+TEST(ReferenceContraction, FoldsPaddedSixDimensions)
+{
+    const std::vector<std::size_t> ms{2, 1, 3, 1, 2, 2};
+    const std::vector<std::size_t> ns{2, 2, 1, 1, 3, 1};
+    const std::vector<std::size_t> ks{3, 1, 2, 2, 1, 4};
+
+    const auto a_lengths = concat(ms, ks);
+    const auto b_lengths = concat(ns, ks);
+    const auto c_lengths = concat(ms, ns);
+
+    EXPECT_TRUE((check_contraction<6, ck::half_t, float>(
+        HostTensorDescriptor(a_lengths, padded_strides(a_lengths, 6, 5)),
+        HostTensorDescriptor(b_lengths, padded_strides(b_lengths, 6, 3)),
+        HostTensorDescriptor(c_lengths, padded_strides(c_lengths, 6, 7)))));
+}
+
+TEST(ReferenceContraction, FallsBackOnUnmergeableStrides)
+{
+    const std::vector<std::size_t> ms{5, 4}, ns{6, 3}, ks{7, 8};
+
+    // K0 is the fastest dimension of A, the K group is not in row-major order
+    EXPECT_FALSE((check_contraction<2, float, float>(
+        HostTensorDescriptor(concat(ms, ks), std::vector<std::size_t>{4 * 56, 56, 1, 7}),
+        concat(ns, ks),
+        concat(ms, ns))));
+
+    // padding between M0 and M1 of C
+    EXPECT_FALSE((check_contraction<2, float, float>(
+        concat(ms, ks),
+        concat(ns, ks),
+        HostTensorDescriptor(concat(ms, ns), padded_strides(concat(ms, ns), 1, 2)))));
+}
+
+TEST(ReferenceContraction, FoldHostGemmDimensions)
+{
+    using ck::utils::fold_host_gemm_dimensions;
+    using ck::utils::HostGemmFoldedDimension;
+
+    HostGemmFoldedDimension folded;
+
+    const std::vector<std::size_t> lengths{4, 1, 3, 5, 2};
+    ASSERT_TRUE(fold_host_gemm_dimensions(
+        lengths, std::vector<std::size_t>{60, 999, 20, 4, 2}, 0, 5, folded));
+    EXPECT_EQ(folded.length, 120u);
+    EXPECT_EQ(folded.stride, 2u);
+
+    // broadcast dimensions fold with each other, not with the others
+    ASSERT_TRUE(fold_host_gemm_dimensions(
+        lengths, std::vector<std::size_t>{0, 0, 0, 1, 5}, 0, 3, folded));
+    EXPECT_EQ(folded.length, 12u);
+    EXPECT_EQ(folded.stride, 0u);
+    EXPECT_FALSE(fold_host_gemm_dimensions(
+        lengths, std::vector<std::size_t>{0, 0, 0, 1, 5}, 0, 4, folded));
+
+    EXPECT_FALSE(fold_host_gemm_dimensions(
+        lengths, std::vector<std::size_t>{60, 1, 20, 2, 1}, 2, 5, folded));
+
+    ASSERT_TRUE(fold_host_gemm_dimensions(
+        std::vector<std::size_t>{3, 0, 2}, std::vector<std::size_t>{7, 5, 1}, 0, 3, folded));
+    EXPECT_EQ(folded.length, 0u);
+}
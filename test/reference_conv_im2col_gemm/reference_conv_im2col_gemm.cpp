@@ -0,0 +1,421 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Algorithm   = ck::tensor_operation::host::ConvReferenceAlgorithm;
+
+// Runs every convolution direction once with the direct loops and once lowered to im2col + GEMM.
+// Forward and backward weight keep the reduction order of the direct loops and must match
+// exactly, backward data reorders the sum over the filter taps.
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void run_conv_im2col_gemm_test(const ck::utils::conv::ConvParam& conv_param)
+{
+    using namespace ck::tensor_operation::host;
+
+    const auto in_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param);
+
+    Tensor<float> input(in_desc);
+    Tensor<float> weight(wei_desc);
+    Tensor<float> output(out_desc);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(input);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(weight);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(output);
+
+    {
+        using RefConv = ReferenceConvFwd<NDimSpatial,
+                                         float,
+                                         float,
+                                         float,
+                                         PassThrough,
+                                         PassThrough,
+                                         PassThrough>;
+
+        Tensor<float> out_direct(out_desc);
+        Tensor<float> out_lowered(out_desc);
+
+        for(auto algorithm : {Algorithm::Direct, Algorithm::Im2colGemm})
+        {
+            auto ref_argument =
+                RefConv::MakeArgument(input,
+                                      weight,
+                                      algorithm == Algorithm::Direct ? out_direct : out_lowered,
+                                      conv_param.conv_filter_strides_,
+                                      conv_param.conv_filter_dilations_,
+                                      conv_param.input_left_pads_,
+                                      conv_param.input_right_pads_,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{},
+                                      {},
+                                      {},
+                                      {},
+                                      algorithm);
+            RefConv::MakeInvoker().Run(ref_argument);
+        }
+
+        EXPECT_TRUE(ck::utils::check_err(out_lowered, out_direct, "Error: fwd", 0, 0));
+    }
+
+    {
+        using RefConv = ReferenceConvBwdData<NDimSpatial,
+                                             float,
+                                             float,
+                                             float,
+                                             PassThrough,
+                                             PassThrough,
+                                             PassThrough>;
+
+        Tensor<float> in_direct(in_desc);
+        Tensor<float> in_lowered(in_desc);
+
+        for(auto algorithm : {Algorithm::Direct, Algorithm::Im2colGemm})
+        {
+            auto ref_argument =
+                RefConv::MakeArgument(algorithm == Algorithm::Direct ? in_direct : in_lowered,
+                                      weight,
+                                      output,
+                                      conv_param.conv_filter_strides_,
+                                      conv_param.conv_filter_dilations_,
+                                      conv_param.input_left_pads_,
+                                      conv_param.input_right_pads_,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{},
+                                      {},
+                                      {},
+                                      {},
+                                      algorithm);
+            RefConv::MakeInvoker().Run(ref_argument);
+        }
+
+        EXPECT_TRUE(ck::utils::check_err(in_lowered, in_direct, "Error: bwd data", 1e-5, 1e-5));
+    }
+
+    {
+        using RefConv = ReferenceConvBwdWeight<NDimSpatial,
+                                               float,
+                                               float,
+                                               float,
+                                               PassThrough,
+                                               PassThrough,
+                                               PassThrough>;
+
+        Tensor<float> wei_direct(wei_desc);
+        Tensor<float> wei_lowered(wei_desc);
+
+        for(auto algorithm : {Algorithm::Direct, Algorithm::Im2colGemm})
+        {
+            auto ref_argument =
+                RefConv::MakeArgument(input,
+                                      algorithm == Algorithm::Direct ? wei_direct : wei_lowered,
+                                      output,
+                                      conv_param.conv_filter_strides_,
+                                      conv_param.conv_filter_dilations_,
+                                      conv_param.input_left_pads_,
+                                      conv_param.input_right_pads_,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{},
+                                      {},
+                                      {},
+                                      {},
+                                      algorithm);
+            RefConv::MakeInvoker().Run(ref_argument);
+        }
+
+        EXPECT_TRUE(ck::utils::check_err(wei_lowered, wei_direct, "Error: bwd weight", 0, 0));
+    }
+}
+
+// Runs the lowered convolutions with a column buffer of max_column_bytes, so that the problem is
+// split into several chunks, and checks them against the direct loops.
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void run_conv_im2col_gemm_chunked_test(const ck::utils::conv::ConvParam& conv_param,
+                                       std::size_t max_column_bytes)
+{
+    using namespace ck::tensor_operation::host;
+
+    const auto in_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+    const auto wei_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+    const auto out_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+            conv_param);
+
+    Tensor<float> input(in_desc);
+    Tensor<float> weight(wei_desc);
+    Tensor<float> output(out_desc);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(input);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(weight);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(output);
+
+    const auto to_acc = [](float x) { return x; };
+
+    // stores into t, counting every store so that each element must be written exactly once
+    const auto store_into = [](Tensor<float>& t, Tensor<int>& count) {
+        return [&t, &count](const auto& idx, float acc) {
+            std::apply([&](auto... is) { t(is...) = acc; }, idx);
+            std::apply([&](auto... is) { ++count(is...); }, idx);
+        };
+    };
+
+    const auto run_direct = [&](auto ref_conv, Tensor<float>& in, Tensor<float>& wei, auto& out) {
+        using RefConv     = decltype(ref_conv);
+        auto ref_argument = RefConv::MakeArgument(in,
+                                                  wei,
+                                                  out,
+                                                  conv_param.conv_filter_strides_,
+                                                  conv_param.conv_filter_dilations_,
+                                                  conv_param.input_left_pads_,
+                                                  conv_param.input_right_pads_,
+                                                  PassThrough{},
+                                                  PassThrough{},
+                                                  PassThrough{},
+                                                  {},
+                                                  {},
+                                                  {},
+                                                  Algorithm::Direct);
+        RefConv::MakeInvoker().Run(ref_argument);
+    };
+
+    {
+        Tensor<float> out_direct(out_desc);
+        Tensor<float> out_lowered(out_desc);
+        Tensor<int> count(out_desc);
+
+        run_direct(ReferenceConvFwd<NDimSpatial,
+                                    float,
+                                    float,
+                                    float,
+                                    PassThrough,
+                                    PassThrough,
+                                    PassThrough>{},
+                   input,
+                   weight,
+                   out_direct);
+
+        ConvFwdIm2colGemm<NDimSpatial>(input,
+                                       weight,
+                                       out_lowered,
+                                       conv_param.conv_filter_strides_,
+                                       conv_param.conv_filter_dilations_,
+                                       conv_param.input_left_pads_,
+                                       conv_param.input_right_pads_,
+                                       to_acc,
+                                       to_acc,
+                                       store_into(out_lowered, count),
+                                       max_column_bytes);
+
+        EXPECT_TRUE(ck::utils::check_err(out_lowered, out_direct, "Error: fwd", 0, 0));
+        EXPECT_TRUE(std::all_of(count.begin(), count.end(), [](int c) { return c == 1; }));
+    }
+
+    {
+        Tensor<float> in_direct(in_desc);
+        Tensor<float> in_lowered(in_desc);
+        Tensor<int> count(in_desc);
+
+        run_direct(ReferenceConvBwdData<NDimSpatial,
+                                        float,
+                                        float,
+                                        float,
+                                        PassThrough,
+                                        PassThrough,
+                                        PassThrough>{},
+                   in_direct,
+                   weight,
+                   output);
+
+        ConvBwdDataIm2colGemm<NDimSpatial>(in_lowered,
+                                           weight,
+                                           output,
+                                           conv_param.conv_filter_strides_,
+                                           conv_param.conv_filter_dilations_,
+                                           conv_param.input_left_pads_,
+                                           conv_param.input_right_pads_,
+                                           to_acc,
+                                           to_acc,
+                                           store_into(in_lowered, count),
+                                           max_column_bytes);
+
+        EXPECT_TRUE(ck::utils::check_err(in_lowered, in_direct, "Error: bwd data", 1e-5, 1e-5));
+        EXPECT_TRUE(std::all_of(count.begin(), count.end(), [](int c) { return c == 1; }));
+    }
+
+    {
+        Tensor<float> wei_direct(wei_desc);
+        Tensor<float> wei_lowered(wei_desc);
+        Tensor<int> count(wei_desc);
+
+        run_direct(ReferenceConvBwdWeight<NDimSpatial,
+                                          float,
+                                          float,
+                                          float,
+                                          PassThrough,
+                                          PassThrough,
+                                          PassThrough>{},
+                   input,
+                   wei_direct,
+                   output);
+
+        ConvBwdWeightIm2colGemm<NDimSpatial>(input,
+                                             wei_lowered,
+                                             output,
+                                             conv_param.conv_filter_strides_,
+                                             conv_param.conv_filter_dilations_,
+                                             conv_param.input_left_pads_,
+                                             conv_param.input_right_pads_,
+                                             to_acc,
+                                             to_acc,
+                                             store_into(wei_lowered, count),
+                                             max_column_bytes);
+
+        EXPECT_TRUE(ck::utils::check_err(wei_lowered, wei_direct, "Error: bwd weight", 0, 0));
+        EXPECT_TRUE(std::all_of(count.begin(), count.end(), [](int c) { return c == 1; }));
+    }
+}
+
+} // anonymous namespace
+
+TEST(ReferenceConvIm2colGemm, Conv1DGNWC)
+{
+    ck::utils::conv::ConvParam conv_param(1,
+                                          2,
+                                          3,
+                                          7,
+                                          5,
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{17},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{1});
+
+    run_conv_im2col_gemm_test<1,
+                              ck::tensor_layout::convolution::GNWC,
+                              ck::tensor_layout::convolution::GKXC,
+                              ck::tensor_layout::convolution::GNWK>(conv_param);
+}
+
+TEST(ReferenceConvIm2colGemm, Conv2DNHWGCStridesDilationsPadding)
+{
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          3,
+                                          5,
+                                          6,
+                                          std::vector<ck::index_t>{3, 2},
+                                          std::vector<ck::index_t>{14, 11},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 0},
+                                          std::vector<ck::index_t>{2, 1});
+
+    run_conv_im2col_gemm_test<2,
+                              ck::tensor_layout::convolution::NHWGC,
+                              ck::tensor_layout::convolution::GKYXC,
+                              ck::tensor_layout::convolution::NHWGK>(conv_param);
+}
+
+TEST(ReferenceConvIm2colGemm, Conv3DGNDHWC)
+{
+    ck::utils::conv::ConvParam conv_param(3,
+                                          3,
+                                          2,
+                                          3,
+                                          4,
+                                          std::vector<ck::index_t>{3, 3, 2},
+                                          std::vector<ck::index_t>{6, 7, 5},
+                                          std::vector<ck::index_t>{1, 1, 2},
+                                          std::vector<ck::index_t>{1, 2, 1},
+                                          std::vector<ck::index_t>{1, 1, 0},
+                                          std::vector<ck::index_t>{1, 0, 1});
+
+    run_conv_im2col_gemm_test<3,
+                              ck::tensor_layout::convolution::GNDHWC,
+                              ck::tensor_layout::convolution::GKZYXC,
+                              ck::tensor_layout::convolution::GNDHWK>(conv_param);
+}
+
+TEST(ReferenceConvIm2colGemm, Conv2DChunked)
+{
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          5,
+                                          4,
+                                          3,
+                                          std::vector<ck::index_t>{3, 3},
+                                          std::vector<ck::index_t>{13, 9},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 1});
+
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    // one column row holds C * Y * X floats, an image has Ho * Wo = 7 * 7 rows
+    const std::size_t row_bytes = 3 * 3 * 3 * sizeof(float);
+
+    // windows of a few output rows of one image, the last window being shorter
+    run_conv_im2col_gemm_chunked_test<2, InLayout, WeiLayout, OutLayout>(conv_param,
+                                                                         17 * row_bytes);
+    // a single output row per chunk, even though it does not fit
+    run_conv_im2col_gemm_chunked_test<2, InLayout, WeiLayout, OutLayout>(conv_param, 1);
+    // two images per chunk, the last chunk holding only one
+    run_conv_im2col_gemm_chunked_test<2, InLayout, WeiLayout, OutLayout>(conv_param,
+                                                                         2 * 49 * row_bytes);
+}
+
+TEST(ReferenceConvIm2colGemm, Conv1DChunkedPaddingOnlyWindows)
+{
+    // the pads are larger than the dilated filter, so the first and last windows read no input
+    ck::utils::conv::ConvParam conv_param(1,
+                                          1,
+                                          2,
+                                          3,
+                                          2,
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{5},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{3});
+
+    run_conv_im2col_gemm_chunked_test<1,
+                                      ck::tensor_layout::convolution::GNWC,
+                                      ck::tensor_layout::convolution::GKXC,
+                                      ck::tensor_layout::convolution::GNWK>(conv_param, 1);
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <functional>
+#include <gtest/gtest.h>
+
+#include "ck_tile/core.hpp"
+#include "ck_tile/host.hpp"
+#include "ck_tile/ops/fmha/block/block_masking.hpp"
+
+namespace {
+
+using NoMask     = ck_tile::GenericAttentionMask<false>;
+using CausalMask = ck_tile::GenericAttentionMask<true, false>;
+using WindowMask = ck_tile::GenericAttentionMask<true, true>;
+
+struct FmhaProblem
+{
+    ck_tile::index_t nhead;
+    ck_tile::index_t nhead_k;
+    ck_tile::index_t seqlen_q;
+    ck_tile::index_t seqlen_k;
+    ck_tile::index_t hdim_q;
+    ck_tile::index_t hdim_v;
+};
+
+// runs reference_fmha_fwd and the multi-step path it replaces (gemm -> masking -> softmax ->
+// gemm on the materialized S and P) and checks O and LSE agree
+template <typename MaskingType>
+void check_fmha_fwd(const FmhaProblem& problem, const MaskingType& mask)
+{
+    const auto [nhead, nhead_k, seqlen_q, seqlen_k, hdim_q, hdim_v] = problem;
+    const float scale_s = 1.f / std::sqrt(static_cast<float>(hdim_q));
+
+    ck_tile::HostTensor<float> q({nhead, seqlen_q, hdim_q});
+    ck_tile::HostTensor<float> k({nhead_k, seqlen_k, hdim_q});
+    ck_tile::HostTensor<float> v({nhead_k, hdim_v, seqlen_k});
+
+    ck_tile::FillUniformDistribution<float>{-1.f, 1.f, 1}(q);
+    ck_tile::FillUniformDistribution<float>{-1.f, 1.f, 2}(k);
+    ck_tile::FillUniformDistribution<float>{-1.f, 1.f, 3}(v);
+
+    ck_tile::HostTensor<float> o({nhead, seqlen_q, hdim_v});
+    ck_tile::HostTensor<float> lse({nhead, seqlen_q});
+
+    ck_tile::reference_fmha_fwd<float, float, float, float>(q,
+                                                            k,
+                                                            v,
+                                                            o,
+                                                            mask,
+                                                            ck_tile::reference_fmha_fwd_no_bias{},
+                                                            ck_tile::scales(scale_s),
+                                                            ck_tile::identity{},
+                                                            ck_tile::identity{},
+                                                            std::ref(lse));
+
+    // the multi-step path has no MQA/GQA support, repeat the key/value heads
+    const ck_tile::index_t nhead_ratio = nhead / nhead_k;
+
+    ck_tile::HostTensor<float> k_ref({nhead, seqlen_k, hdim_q});
+    ck_tile::HostTensor<float> v_ref({nhead, hdim_v, seqlen_k});
+
+    k_ref.ForEach(
+        [&](auto& self, auto idx) { self(idx) = k(idx[0] / nhead_ratio, idx[1], idx[2]); });
+    v_ref.ForEach(
+        [&](auto& self, auto idx) { self(idx) = v(idx[0] / nhead_ratio, idx[1], idx[2]); });
+
+    ck_tile::HostTensor<float> s_ref({nhead, seqlen_q, seqlen_k});
+    ck_tile::HostTensor<float> p_ref({nhead, seqlen_q, seqlen_k});
+    ck_tile::HostTensor<float> o_ref({nhead, seqlen_q, hdim_v});
+    ck_tile::HostTensor<float> lse_ref({nhead, seqlen_q});
+
+    ck_tile::reference_batched_gemm<float, float, float, float>(
+        q, k_ref, s_ref, ck_tile::identity{}, ck_tile::identity{}, ck_tile::scales(scale_s));
+    ck_tile::reference_batched_masking<float>(s_ref, mask);
+    ck_tile::reference_batched_softmax<float, float, float>(
+        s_ref, p_ref, ck_tile::identity{}, std::ref(lse_ref));
+    ck_tile::reference_batched_gemm<float, float, float, float>(p_ref, v_ref, o_ref);
+
+    EXPECT_TRUE(ck_tile::check_err(o, o_ref, "Error: incorrect o!", 1e-5, 1e-5));
+    // rows without any unmasked key have an lse of -inf in both paths
+    EXPECT_TRUE(ck_tile::check_err(lse, lse_ref, "Error: incorrect lse!", 1e-5, 1e-5, true));
+}
+
+// several q/k tiles with partial tails, GQA
+constexpr FmhaProblem kProblem{4, 2, 70, 300, 32, 48};
+
+} // anonymous namespace
+
+TEST(ReferenceFmhaFwd, NoMaskMatchesMultiStep)
+{
+    check_fmha_fwd(kProblem, NoMask{kProblem.seqlen_q, kProblem.seqlen_k});
+}
+
+TEST(ReferenceFmhaFwd, CausalTopLeftMatchesMultiStep)
+{
+    check_fmha_fwd(kProblem,
+                   ck_tile::make_generic_attention_mask_from_lr_window<CausalMask>(
+                       -1, 0, kProblem.seqlen_q, kProblem.seqlen_k, true));
+}
+
+TEST(ReferenceFmhaFwd, CausalBottomRightMatchesMultiStep)
+{
+    check_fmha_fwd(kProblem,
+                   ck_tile::make_generic_attention_mask_from_lr_window<CausalMask>(
+                       -1, 0, kProblem.seqlen_q, kProblem.seqlen_k, false));
+}
+
+TEST(ReferenceFmhaFwd, CausalFullyMaskedRowsMatchMultiStep)
+{
+    // seqlen_q > seqlen_k with a bottom-right causal mask leaves the first rows without any key
+    constexpr FmhaProblem problem{2, 2, 160, 40, 16, 16};
+
+    check_fmha_fwd(problem,
+                   ck_tile::make_generic_attention_mask_from_lr_window<CausalMask>(
+                       -1, 0, problem.seqlen_q, problem.seqlen_k, false));
+}
+
+TEST(ReferenceFmhaFwd, SlidingWindowMatchesMultiStep)
+{
+    check_fmha_fwd(kProblem,
+                   ck_tile::make_generic_attention_mask_from_lr_window<WindowMask>(
+                       50, 10, kProblem.seqlen_q, kProblem.seqlen_k, true));
+}
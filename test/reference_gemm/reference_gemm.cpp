@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// an A element-op that is not PassThrough, so ReferenceGemm uses its per-element loop
+struct Negate
+{
+    template <typename Y, typename X>
+    void operator()(Y& y, const X& x) const
+    {
+        y = -x;
+    }
+};
+
+// plain triple loop with the same conversion chain as ReferenceGemm
+template <typename ADataType, typename BDataType, typename CDataType, typename AccDataType>
+void naive_gemm(const Tensor<ADataType>& a_m_k,
+                const Tensor<BDataType>& b_k_n,
+                Tensor<CDataType>& c_m_n)
+{
+    const std::size_t M = c_m_n.mDesc.GetLengths()[0];
+    const std::size_t N = c_m_n.mDesc.GetLengths()[1];
+    const std::size_t K = a_m_k.mDesc.GetLengths()[1];
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            AccDataType v_acc = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                CDataType v_a = 0;
+                CDataType v_b = 0;
+
+                PassThrough{}(v_a, a_m_k(m, k));
+                PassThrough{}(v_b, b_k_n(k, n));
+
+                v_acc += ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
+            }
+
+            CDataType v_c = 0;
+            PassThrough{}(v_c, v_acc);
+            c_m_n(m, n) = v_c;
+        }
+    }
+}
+
+template <typename ADataType, typename BDataType, typename CDataType, typename AccDataType>
+void run_reference_gemm_test(std::size_t M,
+                             std::size_t N,
+                             std::size_t K,
+                             bool b_col_major,
+                             ck::utils::HostGemmAccumulation accumulation,
+                             double rtol,
+                             double atol)
+{
+    Tensor<ADataType> a_m_k({M, K});
+    Tensor<BDataType> b_k_n = b_col_major ? Tensor<BDataType>({K, N}, {std::size_t{1}, K})
+                                          : Tensor<BDataType>({K, N});
+    Tensor<CDataType> c_m_n_ref({M, N});
+    Tensor<CDataType> c_m_n({M, N});
+
+    ck::utils::FillUniformDistribution<ADataType>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<BDataType>{-1.f, 1.f}(b_k_n);
+
+    naive_gemm<ADataType, BDataType, CDataType, AccDataType>(a_m_k, b_k_n, c_m_n_ref);
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+    static_assert(ReferenceGemmInstance::UseBlockedGemm);
+
+    auto ref_gemm     = ReferenceGemmInstance{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument = ref_gemm.MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}, accumulation);
+
+    ref_invoker.Run(ref_argument);
+
+    EXPECT_TRUE(ck::utils::check_err(c_m_n, c_m_n_ref, "Error: incorrect results!", rtol, atol));
+}
+
+} // anonymous namespace
+
+using ck::utils::HostGemmAccumulation;
+
+TEST(ReferenceGemm, StrictIsBitExactF32)
+{
+    run_reference_gemm_test<float, float, float, float>(
+        67, 131, 259, false, HostGemmAccumulation::Strict, 0, 0);
+}
+
+TEST(ReferenceGemm, StrictIsBitExactF32ColumnMajorB)
+{
+    run_reference_gemm_test<float, float, float, float>(
+        97, 300, 513, true, HostGemmAccumulation::Strict, 0, 0);
+}
+
+TEST(ReferenceGemm, StrictIsBitExactF16)
+{
+    run_reference_gemm_test<ck::half_t, ck::half_t, ck::half_t, float>(
+        33, 65, 129, false, HostGemmAccumulation::Strict, 0, 0);
+}
+
+TEST(ReferenceGemm, StrictIsBitExactF64)
+{
+    run_reference_gemm_test<double, double, double, double>(
+        19, 23, 1000, true, HostGemmAccumulation::Strict, 0, 0);
+}
+
+TEST(ReferenceGemm, RelaxedF32)
+{
+    run_reference_gemm_test<float, float, float, float>(
+        128, 256, 512, false, HostGemmAccumulation::Relaxed, 1e-5, 1e-4);
+}
+
+TEST(ReferenceGemm, FixedRankTensorsMatchRuntimeRank)
+{
+    constexpr std::size_t M = 37, N = 45, K = 70;
+
+    using Desc = HostTensorDescriptorN<2>;
+
+    Tensor<float> a_m_k({M, K});
+    Tensor<float> b_k_n({K, N}, {std::size_t{1}, K + 3});
+    Tensor<float> c_m_n({M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_m_k);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_k_n);
+
+    const Tensor<float, Desc> a_m_k_fixed(a_m_k);
+    const Tensor<float, Desc> b_k_n_fixed(b_k_n);
+    Tensor<float, Desc> c_m_n_fixed(c_m_n.mDesc);
+
+    // per-element loop
+    using ReferenceGemmNaive = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, Negate, PassThrough, PassThrough>;
+    using ReferenceGemmNaiveFixed = ck::tensor_operation::host::ReferenceGemm<float,
+                                                                             float,
+                                                                             float,
+                                                                             float,
+                                                                             Negate,
+                                                                             PassThrough,
+                                                                             PassThrough,
+                                                                             float,
+                                                                             float,
+                                                                             Desc>;
+    static_assert(!ReferenceGemmNaiveFixed::UseBlockedGemm);
+
+    auto naive_argument = ReferenceGemmNaive::MakeArgument(
+        a_m_k, b_k_n, c_m_n, Negate{}, PassThrough{}, PassThrough{});
+    ReferenceGemmNaive::MakeInvoker().Run(naive_argument);
+
+    auto naive_fixed_argument = ReferenceGemmNaiveFixed::MakeArgument(
+        a_m_k_fixed, b_k_n_fixed, c_m_n_fixed, Negate{}, PassThrough{}, PassThrough{});
+    ReferenceGemmNaiveFixed::MakeInvoker().Run(naive_fixed_argument);
+
+    EXPECT_EQ(c_m_n_fixed.mData, c_m_n.mData);
+
+    // blocked GEMM
+    using ReferenceGemmBlockedFixed = ck::tensor_operation::host::ReferenceGemm<float,
+                                                                               float,
+                                                                               float,
+                                                                               float,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               float,
+                                                                               float,
+                                                                               Desc>;
+    static_assert(ReferenceGemmBlockedFixed::UseBlockedGemm);
+
+    auto blocked_fixed_argument = ReferenceGemmBlockedFixed::MakeArgument(
+        a_m_k_fixed, b_k_n_fixed, c_m_n_fixed, PassThrough{}, PassThrough{}, PassThrough{});
+    ReferenceGemmBlockedFixed::MakeInvoker().Run(blocked_fixed_argument);
+
+    naive_gemm<float, float, float, float>(a_m_k, b_k_n, c_m_n);
+
+    EXPECT_EQ(c_m_n_fixed.mData, c_m_n.mData);
+}
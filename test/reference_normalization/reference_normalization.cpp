@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// mean and population variance of x[m, :] in double precision
+template <typename T>
+std::vector<double> row_moments(const Tensor<T>& x, std::size_t row, std::size_t row_size)
+{
+    double mean = 0;
+    for(std::size_t i = 0; i < row_size; ++i)
+        mean += x.mData[row * row_size + i];
+    mean /= row_size;
+
+    double var = 0;
+    for(std::size_t i = 0; i < row_size; ++i)
+        var += (x.mData[row * row_size + i] - mean) * (x.mData[row * row_size + i] - mean);
+    var /= row_size;
+
+    return {mean, var};
+}
+
+} // namespace
+
+TEST(ReferenceNormalization, WelfordMatchesTwoPass)
+{
+    // a large offset makes E[x^2] - E[x]^2 lose every digit of the variance in float
+    std::vector<float> x(1001);
+    ck::utils::FillUniformDistribution<float>{1000.f, 1001.f}(x);
+
+    double mean = 0;
+    for(float v : x)
+        mean += v;
+    mean /= x.size();
+
+    double var = 0;
+    for(float v : x)
+        var += (v - mean) * (v - mean);
+    var /= x.size();
+
+    ck::tensor_operation::host::ReferenceWelford<float> welford;
+    welford.Update(x.size(), [&](auto i) { return x[i]; });
+
+    EXPECT_NEAR(welford.GetMean(), mean, 1e-6 * mean);
+    EXPECT_NEAR(welford.GetVariance(), var, 1e-4 * var);
+}
+
+TEST(ReferenceNormalization, LayernormFwd)
+{
+    constexpr ck::index_t M = 37;
+    constexpr ck::index_t N = 1000;
+
+    Tensor<float> x({M, N});
+    Tensor<float> gamma({N});
+    Tensor<float> beta({N});
+    Tensor<float> y({M, N});
+    Tensor<float> save_mean({M});
+    Tensor<float> save_inv_std({M});
+
+    ck::utils::FillUniformDistribution<float>{-3.f, 5.f}(x);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.5f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+
+    using Ref = ck::tensor_operation::host::
+        ReferenceLayernorm<float, float, float, float, float, float, PassThrough, 2, 1>;
+
+    auto argument = Ref::MakeArgument(
+        x, gamma, beta, y, save_mean, save_inv_std, PassThrough{}, {M, N}, {1}, 1e-5f);
+    Ref::MakeInvoker().Run(argument);
+
+    for(ck::index_t m = 0; m < M; ++m)
+    {
+        const auto moments   = row_moments(x, m, N);
+        const double inv_std = 1. / std::sqrt(moments[1] + 1e-5);
+
+        EXPECT_NEAR(save_mean(m), moments[0], 1e-5);
+        EXPECT_NEAR(save_inv_std(m), inv_std, 1e-5 * inv_std);
+
+        for(ck::index_t n = 0; n < N; ++n)
+        {
+            const double expected = (x(m, n) - moments[0]) * inv_std * gamma(n) + beta(n);
+            ASSERT_NEAR(y(m, n), expected, 1e-4);
+        }
+    }
+}
+
+TEST(ReferenceNormalization, GroupnormFwd)
+{
+    constexpr ck::index_t N = 3;
+    constexpr ck::index_t H = 5;
+    constexpr ck::index_t W = 7;
+    constexpr ck::index_t G = 4;
+    constexpr ck::index_t C = 6;
+
+    Tensor<float> x({N, H, W, G, C});
+    Tensor<float> gamma({G, C});
+    Tensor<float> beta({G, C});
+    Tensor<float> y({N, H, W, G, C});
+    Tensor<float> save_mean({N, G});
+    Tensor<float> save_inv_std({N, G});
+
+    ck::utils::FillUniformDistribution<float>{-3.f, 5.f}(x);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.5f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+
+    using Ref = ck::tensor_operation::host::
+        ReferenceGroupnorm<float, float, float, float, float, float, PassThrough>;
+
+    auto argument = Ref::MakeArgument(
+        x, gamma, beta, y, save_mean, save_inv_std, PassThrough{}, {N, H, W, G, C}, 1e-5f);
+    Ref::MakeInvoker().Run(argument);
+
+    for(ck::index_t n = 0; n < N; ++n)
+    {
+        for(ck::index_t g = 0; g < G; ++g)
+        {
+            double mean = 0;
+            double var  = 0;
+            x.ForEach([&](auto& self, auto idx) {
+                if(idx[0] == std::size_t(n) && idx[3] == std::size_t(g))
+                    mean += self(idx);
+            });
+            mean /= H * W * C;
+            x.ForEach([&](auto& self, auto idx) {
+                if(idx[0] == std::size_t(n) && idx[3] == std::size_t(g))
+                    var += (self(idx) - mean) * (self(idx) - mean);
+            });
+            var /= H * W * C;
+
+            const double inv_std = 1. / std::sqrt(var + 1e-5);
+            EXPECT_NEAR(save_mean(n, g), mean, 1e-5);
+            EXPECT_NEAR(save_inv_std(n, g), inv_std, 1e-5 * inv_std);
+
+            for(ck::index_t h = 0; h < H; ++h)
+                for(ck::index_t w = 0; w < W; ++w)
+                    for(ck::index_t c = 0; c < C; ++c)
+                    {
+                        const double expected =
+                            (x(n, h, w, g, c) - mean) * inv_std * gamma(g, c) + beta(g, c);
+                        ASSERT_NEAR(y(n, h, w, g, c), expected, 1e-4);
+                    }
+        }
+    }
+}
+
+TEST(ReferenceNormalization, LayernormBwd)
+{
+    constexpr ck::index_t M = 29;
+    constexpr ck::index_t N = 300;
+
+    Tensor<float> dy({M, N});
+    Tensor<float> x({M, N});
+    Tensor<float> gamma({N});
+    Tensor<float> mean({M});
+    Tensor<float> inv_std({M});
+    Tensor<float> dgamma({N});
+    Tensor<float> dbeta({N});
+    Tensor<float> dx({M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dy);
+    ck::utils::FillUniformDistribution<float>{-3.f, 5.f, 7}(x);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.5f}(gamma);
+
+    for(ck::index_t m = 0; m < M; ++m)
+    {
+        const auto moments = row_moments(x, m, N);
+        mean(m)            = moments[0];
+        inv_std(m)         = 1. / std::sqrt(moments[1] + 1e-5);
+    }
+
+    using Ref = ck::tensor_operation::host::
+        ReferenceLayernormBwd<float, float, float, float, float, float, float, float>;
+
+    auto argument = Ref::MakeArgument(dy, x, gamma, mean, inv_std, dgamma, dbeta, dx, {M, N});
+    Ref::MakeInvoker().Run(argument);
+
+    for(ck::index_t n = 0; n < N; ++n)
+    {
+        double expected_dgamma = 0;
+        double expected_dbeta  = 0;
+        for(ck::index_t m = 0; m < M; ++m)
+        {
+            expected_dgamma += dy(m, n) * (x(m, n) - mean(m)) * inv_std(m);
+            expected_dbeta += dy(m, n);
+        }
+        EXPECT_NEAR(dgamma(n), expected_dgamma, 1e-4);
+        EXPECT_NEAR(dbeta(n), expected_dbeta, 1e-4);
+    }
+
+    // dx = rstd * (dy * gamma - mean(dy * gamma) - x_hat * mean(dy * gamma * x_hat))
+    for(ck::index_t m = 0; m < M; ++m)
+    {
+        double mean_dyg       = 0;
+        double mean_dyg_x_hat = 0;
+        for(ck::index_t n = 0; n < N; ++n)
+        {
+            const double x_hat = (x(m, n) - mean(m)) * inv_std(m);
+            mean_dyg += dy(m, n) * gamma(n) / N;
+            mean_dyg_x_hat += dy(m, n) * gamma(n) * x_hat / N;
+        }
+
+        for(ck::index_t n = 0; n < N; ++n)
+        {
+            const double x_hat = (x(m, n) - mean(m)) * inv_std(m);
+            const double expected =
+                inv_std(m) * (dy(m, n) * gamma(n) - mean_dyg - x_hat * mean_dyg_x_hat);
+            ASSERT_NEAR(dx(m, n), expected, 1e-4);
+        }
+    }
+}
+
+TEST(ReferenceNormalization, GroupnormBwdMatchesLayernormBwd)
+{
+    // with G = 1 and H = W = 1 groupnorm reduces over C like a [N, C] layernorm
+    constexpr ck::index_t N = 13;
+    constexpr ck::index_t C = 200;
+
+    Tensor<float> dy({N, 1, 1, 1, C});
+    Tensor<float> x({N, 1, 1, 1, C});
+    Tensor<float> gamma({1, C});
+    Tensor<float> mean({N, 1});
+    Tensor<float> inv_std({N, 1});
+    Tensor<float> dgamma({1, C});
+    Tensor<float> dbeta({1, C});
+    Tensor<float> dx({N, 1, 1, 1, C});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dy);
+    ck::utils::FillUniformDistribution<float>{-3.f, 5.f, 7}(x);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.5f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-0.5f, 0.5f, 3}(mean);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.f, 5}(inv_std);
+
+    using GroupnormBwd = ck::tensor_operation::host::
+        ReferenceGroupnormBwd<float, float, float, float, float, float, float, float>;
+    using LayernormBwd = ck::tensor_operation::host::
+        ReferenceLayernormBwd<float, float, float, float, float, float, float, float>;
+
+    auto argument = GroupnormBwd::MakeArgument(
+        dy, x, gamma, mean, inv_std, dgamma, dbeta, dx, {N, 1, 1, 1, C});
+    GroupnormBwd::MakeInvoker().Run(argument);
+
+    Tensor<float> dy_2d({N, C});
+    Tensor<float> x_2d({N, C});
+    Tensor<float> gamma_1d({C});
+    Tensor<float> mean_1d({N});
+    Tensor<float> inv_std_1d({N});
+    Tensor<float> dgamma_1d({C});
+    Tensor<float> dbeta_1d({C});
+    Tensor<float> dx_2d({N, C});
+
+    dy_2d.mData      = dy.mData;
+    x_2d.mData       = x.mData;
+    gamma_1d.mData   = gamma.mData;
+    mean_1d.mData    = mean.mData;
+    inv_std_1d.mData = inv_std.mData;
+
+    auto argument_2d = LayernormBwd::MakeArgument(
+        dy_2d, x_2d, gamma_1d, mean_1d, inv_std_1d, dgamma_1d, dbeta_1d, dx_2d, {N, C});
+    LayernormBwd::MakeInvoker().Run(argument_2d);
+
+    EXPECT_EQ(dgamma.mData, dgamma_1d.mData);
+    EXPECT_EQ(dbeta.mData, dbeta_1d.mData);
+    EXPECT_EQ(dx.mData, dx_2d.mData);
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+
+namespace {
+
+using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+// runs ReferenceSoftmax and checks it against a double precision softmax over reduce_dims,
+// returns whether the reduce dims folded into a contiguous axis
+bool check_softmax(const std::vector<std::size_t>& lengths,
+                   const std::vector<std::size_t>& strides,
+                   const std::vector<ck::index_t>& reduce_dims,
+                   double alpha,
+                   double beta)
+{
+    Tensor<float> in(lengths, strides);
+    Tensor<float> out(lengths, strides);
+
+    ck::utils::FillUniformDistribution<float>{-20.f, 20.f}(in);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(out);
+
+    const Tensor<float> prior_out(out);
+
+    auto argument = ReferenceSoftmax::MakeArgument(in, out, alpha, beta, reduce_dims);
+    ReferenceSoftmax::MakeInvoker().Run(argument);
+
+    auto to_scalar_idx = [&](const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> scalar_idx;
+        for(std::size_t dim = 0; dim < idx.size(); ++dim)
+        {
+            if(std::find(reduce_dims.begin(), reduce_dims.end(), dim) == reduce_dims.end())
+                scalar_idx.push_back(idx[dim]);
+        }
+        return scalar_idx;
+    };
+
+    std::map<std::vector<std::size_t>, double> max;
+    std::map<std::vector<std::size_t>, double> sum;
+
+    in.ForEach([&](auto& self, auto idx) {
+        const auto key = to_scalar_idx(idx);
+        max[key]       = max.count(key) == 0 ? self(idx) : std::max<double>(max[key], self(idx));
+    });
+    in.ForEach([&](auto& self, auto idx) {
+        const auto key = to_scalar_idx(idx);
+        sum[key] += std::exp(self(idx) - max[key]);
+    });
+
+    in.ForEach([&](auto& self, auto idx) {
+        const auto key        = to_scalar_idx(idx);
+        const double expected = alpha * std::exp(self(idx) - max[key]) / sum[key] +
+                                beta * static_cast<double>(prior_out(idx));
+        EXPECT_NEAR(out(idx), expected, 1e-5 + 1e-5 * std::abs(expected));
+    });
+
+    return ReferenceSoftmax::Invoker::GetFoldedReduceLength(argument) != 0;
+}
+
+} // namespace
+
+TEST(ReferenceSoftmax, TrailingDims)
+{
+    EXPECT_TRUE(check_softmax({3, 5, 7, 33}, {1155, 231, 33, 1}, {3}, 1., 0.));
+    EXPECT_TRUE(check_softmax({3, 5, 7, 33}, {1155, 231, 33, 1}, {2, 3}, 1., 0.));
+    EXPECT_TRUE(check_softmax({2, 3, 5, 7}, {105, 35, 7, 1}, {0, 1, 2, 3}, 1., 0.));
+}
+
+TEST(ReferenceSoftmax, AlphaBeta)
+{
+    EXPECT_TRUE(check_softmax({4, 200}, {200, 1}, {1}, 0.5, 2.));
+}
+
+TEST(ReferenceSoftmax, PermutedContiguousDims)
+{
+    // [N, C, H, W] in NHWC memory order, reducing C or H, W and C
+    EXPECT_TRUE(check_softmax({2, 70, 3, 5}, {1050, 1, 350, 70}, {1}, 1., 0.));
+    EXPECT_TRUE(check_softmax({2, 70, 3, 5}, {1050, 1, 350, 70}, {3, 1, 2}, 1., 0.));
+}
+
+TEST(ReferenceSoftmax, GenericFallback)
+{
+    // the reduce dims are not contiguous in memory
+    EXPECT_FALSE(check_softmax({3, 5, 7}, {35, 7, 1}, {1}, 1., 0.));
+    EXPECT_FALSE(check_softmax({3, 5, 7}, {35, 7, 1}, {0, 2}, 0.5, 2.));
+    // padded rows, the reduced elements of a row are contiguous but the output has holes
+    EXPECT_FALSE(check_softmax({3, 5}, {8, 1}, {1}, 1., 0.));
+}
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_tuning_db.hpp"
+
+using ck::tensor_operation::device::instance::DeviceOperationTuningDb;
+using ck::tensor_operation::device::instance::DeviceOperationTuningKey;
+using ck::tensor_operation::device::instance::DeviceOperationTuningRecord;
+
+namespace {
+
+struct MockDeviceOp : public ck::tensor_operation::device::BaseOperator
+{
+};
+
+struct MockInstance : public MockDeviceOp
+{
+    explicit MockInstance(std::string name) : name_(std::move(name)) {}
+
+    std::string GetTypeString() const override { return name_; }
+
+    std::string name_;
+};
+
+DeviceOperationTuningKey MakeKey(ck::long_index_t M)
+{
+    return {"gemm", "f16_f16_f32_f16", "RowMajor_ColumnMajor_RowMajor", {M, 256, 64}, "gfx942"};
+}
+
+class TuningDb : public ::testing::Test
+{
+    protected:
+    void SetUp() override
+    {
+        path_ = ::testing::TempDir() + "ck_tuning_db_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".txt";
+        std::remove(path_.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(path_.c_str());
+        std::remove((path_ + ".lock").c_str());
+    }
+
+    std::string path_;
+};
+
+} // namespace
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <>
+struct DeviceOperationInstanceFactory<MockDeviceOp>
+{
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<MockDeviceOp>> op_ptrs;
+        op_ptrs.push_back(std::make_unique<MockInstance>("Instance<256, 128, 128>"));
+        op_ptrs.push_back(std::make_unique<MockInstance>("Instance<256, 128, 64>"));
+        op_ptrs.push_back(std::make_unique<MockInstance>("Instance<128, 64, 64>"));
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+TEST_F(TuningDb, MissingFileIsEmpty)
+{
+    DeviceOperationTuningDb db(path_);
+
+    EXPECT_FALSE(db.Load());
+    EXPECT_EQ(db.GetNumRecord(), 0u);
+    EXPECT_FALSE(db.Find(MakeKey(128)).has_value());
+}
+
+TEST_F(TuningDb, KeepsFasterInstance)
+{
+    DeviceOperationTuningDb db(path_);
+
+    EXPECT_TRUE(db.Update(MakeKey(128), {"Instance<256, 128, 128>", 2.f, 10.f}));
+    EXPECT_TRUE(db.Update(MakeKey(128), {"Instance<256, 128, 64>", 1.f, 20.f}));
+    EXPECT_FALSE(db.Update(MakeKey(128), {"Instance<128, 64, 64>", 3.f, 5.f}));
+
+    const auto record = db.Find(MakeKey(128));
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->instance_, "Instance<256, 128, 64>");
+
+    // re-timing the recorded instance only changes the db when it got strictly faster
+    EXPECT_FALSE(db.Update(MakeKey(128), {"Instance<256, 128, 64>", 1.5f, 15.f}));
+    EXPECT_FALSE(db.Update(MakeKey(128), {"Instance<256, 128, 64>", 1.f, 20.f}));
+    EXPECT_FLOAT_EQ(db.Find(MakeKey(128))->ave_time_, 1.f);
+    EXPECT_TRUE(db.Update(MakeKey(128), {"Instance<256, 128, 64>", .5f, 40.f}));
+    EXPECT_FLOAT_EQ(db.Find(MakeKey(128))->ave_time_, .5f);
+
+    // every key field takes part in the lookup
+    auto other_arch  = MakeKey(128);
+    other_arch.arch_ = "gfx90a";
+    EXPECT_FALSE(db.Find(other_arch).has_value());
+    EXPECT_FALSE(db.Find(MakeKey(256)).has_value());
+}
+
+TEST_F(TuningDb, SaveAndLoad)
+{
+    {
+        DeviceOperationTuningDb db(path_);
+        db.Update(MakeKey(128), {"Instance<256, 128, 64>", 1.f, 20.f});
+        db.Update(MakeKey(256), {"Instance<128, 64, 64>", 2.f, 30.f});
+        ASSERT_TRUE(db.Save());
+    }
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(db.GetNumRecord(), 2u);
+
+    const auto record = db.Find(MakeKey(256));
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->instance_, "Instance<128, 64, 64>");
+    EXPECT_FLOAT_EQ(record->ave_time_, 2.f);
+    EXPECT_FLOAT_EQ(record->tflops_, 30.f);
+}
+
+TEST_F(TuningDb, SaveMergesWithFile)
+{
+    DeviceOperationTuningDb first(path_);
+    DeviceOperationTuningDb second(path_);
+
+    first.Update(MakeKey(128), {"Instance<256, 128, 64>", 1.f, 20.f});
+    ASSERT_TRUE(first.Save());
+
+    // second was loaded before first saved, it must not drop first's record
+    second.Update(MakeKey(128), {"Instance<128, 64, 64>", 4.f, 5.f});
+    second.Update(MakeKey(512), {"Instance<256, 128, 128>", 1.f, 40.f});
+    ASSERT_TRUE(second.Save());
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(db.GetNumRecord(), 2u);
+    EXPECT_EQ(db.Find(MakeKey(128))->instance_, "Instance<256, 128, 64>");
+    EXPECT_EQ(db.Find(MakeKey(512))->instance_, "Instance<256, 128, 128>");
+}
+
+TEST_F(TuningDb, AlternatingSavesKeepAllRecords)
+{
+    DeviceOperationTuningDb first(path_);
+    DeviceOperationTuningDb second(path_);
+
+    for(ck::long_index_t i = 0; i < 8; ++i)
+    {
+        auto& db = i % 2 == 0 ? first : second;
+        db.Update(MakeKey(i + 1), {"Instance<256, 128, 64>", 1.f, 20.f});
+        ASSERT_TRUE(db.Save());
+    }
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(db.GetNumRecord(), 8u);
+}
+
+TEST_F(TuningDb, ConcurrentSavesKeepAllRecords)
+{
+    constexpr ck::long_index_t NumWriter = 4;
+    constexpr ck::long_index_t NumSave   = 16;
+
+    std::vector<std::thread> writers;
+    for(ck::long_index_t w = 0; w < NumWriter; ++w)
+    {
+        writers.emplace_back([&, w] {
+            DeviceOperationTuningDb db(path_);
+            for(ck::long_index_t i = 0; i < NumSave; ++i)
+            {
+                db.Update(MakeKey(w * NumSave + i + 1), {"Instance<128, 64, 64>", 1.f, 20.f});
+                EXPECT_TRUE(db.Save());
+            }
+        });
+    }
+    for(auto& writer : writers)
+        writer.join();
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(db.GetNumRecord(), static_cast<std::size_t>(NumWriter * NumSave));
+}
+
+TEST_F(TuningDb, IgnoresMalformedLines)
+{
+    {
+        std::ofstream file(path_);
+        file << "# comment\n"
+             << "\n"
+             << "gemm\tonly\tthree\n"
+             << "gemm\tf16\tRow\t1,2,3\tgfx942\tInstance<1>\tnot-a-number\t1\n"
+             << "gemm\tf16\tRow\t1,2,3\tgfx942\tInstance<2>\t0.5\t1\n";
+    }
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(db.GetNumRecord(), 1u);
+    EXPECT_EQ(db.Find({"gemm", "f16", "Row", {1, 2, 3}, "gfx942"})->instance_, "Instance<2>");
+}
+
+TEST_F(TuningDb, GetTunedInstanceByTypeString)
+{
+    using ck::tensor_operation::device::instance::GetTunedInstance;
+
+    DeviceOperationTuningDb db(path_);
+    EXPECT_EQ(GetTunedInstance<MockDeviceOp>(db, MakeKey(128)), nullptr);
+
+    db.Update(MakeKey(128), {"Instance<128, 64, 64>", 1.f, 20.f});
+    const auto op_ptr = GetTunedInstance<MockDeviceOp>(db, MakeKey(128));
+    ASSERT_NE(op_ptr, nullptr);
+    EXPECT_EQ(op_ptr->GetTypeString(), "Instance<128, 64, 64>");
+
+    // instances that are no longer built are not returned
+    db.Update(MakeKey(256), {"Instance<64, 32, 32>", 1.f, 20.f});
+    EXPECT_EQ(GetTunedInstance<MockDeviceOp>(db, MakeKey(256)), nullptr);
+}